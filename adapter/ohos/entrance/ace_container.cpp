@@ -30,6 +30,7 @@
 #include "base/utils/utils.h"
 #include "core/common/ace_engine.h"
 #include "core/common/container_scope.h"
+#include "core/common/first_frame_layout_cache.h"
 #include "core/common/flutter/flutter_asset_manager.h"
 #include "core/common/flutter/flutter_task_executor.h"
 #include "core/common/hdc_register.h"
@@ -53,6 +54,7 @@ constexpr char QUICK_JS_ENGINE_SHARED_LIB[] = "libace_engine_qjs.z.so";
 constexpr char ARK_ENGINE_SHARED_LIB[] = "libace_engine_ark.z.so";
 constexpr char DECLARATIVE_JS_ENGINE_SHARED_LIB[] = "libace_engine_declarative.z.so";
 constexpr char DECLARATIVE_ARK_ENGINE_SHARED_LIB[] = "libace_engine_declarative_ark.z.so";
+constexpr char FIRST_FRAME_LAYOUT_CACHE_FILE[] = "/ace_first_frame_layout_cache";
 
 #ifdef _ARM64_
 const std::string ASSET_LIBARCH_PATH = "/lib/arm64";
@@ -848,6 +850,10 @@ void AceContainer::AttachView(std::unique_ptr<Window> window, AceView* view, dou
     } else if (type_ != FrontendType::JS_CARD) {
         aceView_->SetCreateTime(createTime_);
     }
+    const auto& dataDir = AceApplicationInfo::GetInstance().GetDataFileDirPath();
+    if (!isSubContainer_ && SystemProperties::GetFirstFrameLayoutCacheEnabled() && !dataDir.empty()) {
+        FirstFrameLayoutCache::GetInstance().Enable(dataDir + FIRST_FRAME_LAYOUT_CACHE_FILE, taskExecutor_);
+    }
     resRegister_ = aceView_->GetPlatformResRegister();
     pipelineContext_ = AceType::MakeRefPtr<PipelineContext>(
         std::move(window), taskExecutor_, assetManager_, resRegister_, frontend_, instanceId);
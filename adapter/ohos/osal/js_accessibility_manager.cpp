@@ -393,6 +393,9 @@ void JsAccessibilityManager::InitializeCallback()
         return;
     }
     AceApplicationInfo::GetInstance().SetAccessibilityEnabled(client->IsEnabled());
+    if (client->IsEnabled()) {
+        CreateDeferredAccessibilityNodes();
+    }
 
     SubscribeStateObserver(AccessibilityStateEventType::EVENT_ACCESSIBILITY_STATE_CHANGED);
 
@@ -1122,6 +1125,7 @@ void JsAccessibilityManager::JsAccessibilityStateObserver::OnStateChanged(const
         context->GetTaskExecutor()->PostTask(
             [jsAccessibilityManager, state]() {
                 if (state) {
+                    jsAccessibilityManager->CreateDeferredAccessibilityNodes();
                     jsAccessibilityManager->RegisterInteractionOperation(jsAccessibilityManager->GetWindowId());
                 } else {
                     jsAccessibilityManager->DeregisterInteractionOperation();
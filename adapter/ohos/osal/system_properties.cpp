@@ -99,6 +99,11 @@ bool IsDebugEnabled()
 {
     return (system::GetParameter("persist.ace.debug.enabled", "0") == "1");
 }
+
+bool IsFirstFrameLayoutCacheEnabled()
+{
+    return (system::GetParameter("persist.ace.firstframe.layoutcache.enabled", "0") == "1");
+}
 } // namespace
 
 bool SystemProperties::IsSyscapExist(const char* cap)
@@ -161,6 +166,7 @@ LongScreenType SystemProperties::LongScreen_ { LongScreenType::NOT_LONG };
 bool SystemProperties::rosenBackendEnabled_ = IsRosenBackendEnabled();
 bool SystemProperties::windowAnimationEnabled_ = IsWindowAnimationEnabled();
 bool SystemProperties::debugEnabled_ = IsDebugEnabled();
+bool SystemProperties::firstFrameLayoutCacheEnabled_ = IsFirstFrameLayoutCacheEnabled();
 int32_t SystemProperties::windowPosX_ = 0;
 int32_t SystemProperties::windowPosY_ = 0;
 
@@ -210,6 +216,7 @@ void SystemProperties::InitDeviceInfo(
     releaseType_ = system::GetParameter("hw_sc.build.os.releasetype", INVALID_PARAM);
     paramDeviceType_ = system::GetParameter("hw_sc.build.os.devicetype", INVALID_PARAM);
     debugEnabled_ = IsDebugEnabled();
+    firstFrameLayoutCacheEnabled_ = IsFirstFrameLayoutCacheEnabled();
     traceEnabled_ = IsTraceEnabled();
     accessibilityEnabled_ = IsAccessibilityEnabled();
     rosenBackendEnabled_ = IsRosenBackendEnabled();
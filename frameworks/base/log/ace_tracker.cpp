@@ -15,40 +15,335 @@
 
 #include "base/log/ace_tracker.h"
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "base/log/dump_log.h"
 #include "base/log/log.h"
 #include "base/utils/time_util.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// Must be power of 2.
+constexpr uint64_t RING_CAPACITY = 4096;
+constexpr uint64_t RING_MASK = RING_CAPACITY - 1;
+constexpr double MICRO_SEC_PER_MILLI_SEC = 1000.0;
+
+struct TrackRing {
+    uint32_t index = 0;
+    std::atomic<bool> alive { true };
+    // Only written by the owner thread, read by exporters.
+    std::atomic<uint64_t> head { 0 };
+    // Events before this sequence are dropped by Clear.
+    std::atomic<uint64_t> base { 0 };
+    // Owner thread only.
+    uint64_t frameStart = 0;
+    uint32_t depth = 0;
+    TrackEvent events[RING_CAPACITY];
+};
+
+std::atomic<bool> g_enabled { true };
+
+std::mutex g_scopeMutex;
+std::vector<std::string> g_scopeNames;
+
+std::mutex g_ringMutex;
+std::vector<std::shared_ptr<TrackRing>> g_rings;
+
+std::shared_ptr<TrackRing> AcquireRing()
+{
+    std::lock_guard<std::mutex> lock(g_ringMutex);
+    // Reuse the ring of an exited thread, so short-lived threads do not leak rings.
+    for (const auto& ring : g_rings) {
+        bool expected = false;
+        if (ring->alive.compare_exchange_strong(expected, true)) {
+            ring->frameStart = ring->head.load(std::memory_order_relaxed);
+            ring->depth = 0;
+            return ring;
+        }
+    }
+    auto ring = std::make_shared<TrackRing>();
+    ring->index = static_cast<uint32_t>(g_rings.size());
+    g_rings.emplace_back(ring);
+    return ring;
+}
+
+class LocalRing final {
+public:
+    LocalRing() = default;
+    ~LocalRing()
+    {
+        if (ring_) {
+            ring_->alive.store(false);
+        }
+    }
+
+    TrackRing* Get()
+    {
+        if (!ring_) {
+            ring_ = AcquireRing();
+        }
+        return ring_.get();
+    }
+
+private:
+    std::shared_ptr<TrackRing> ring_;
+};
+
+thread_local LocalRing t_localRing;
+// Set between Start and Stop, so the vsync profiler works even when the tracker is disabled globally.
+thread_local bool t_frameTracking = false;
+
+// Returns the first sequence whose slot is not being overwritten when the head is |head|. The owner writes the
+// slot of sequence |head| before publishing it, and that slot holds sequence |head| - RING_CAPACITY.
+uint64_t GetFirstIntactSeq(uint64_t head)
+{
+    return head + 1 > RING_CAPACITY ? head + 1 - RING_CAPACITY : 0;
+}
+
+// Copies events in [from, head) which are still held in the ring.
+void CopyEvents(const TrackRing& ring, uint64_t from, std::vector<TrackEvent>& events)
+{
+    uint64_t head = ring.head.load(std::memory_order_acquire);
+    uint64_t begin = std::max({ from, ring.base.load(std::memory_order_relaxed), GetFirstIntactSeq(head) });
+    if (begin >= head) {
+        return;
+    }
+    size_t offset = events.size();
+    for (uint64_t seq = begin; seq < head; ++seq) {
+        events.emplace_back(ring.events[seq & RING_MASK]);
+    }
+    // The owner may have wrapped around while copying, drop the slots which have been or are being overwritten.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t firstIntact = GetFirstIntactSeq(ring.head.load(std::memory_order_relaxed));
+    if (firstIntact > begin) {
+        auto overwritten = std::min<uint64_t>(firstIntact - begin, head - begin);
+        events.erase(events.begin() + offset, events.begin() + offset + overwritten);
+    }
+}
 
-std::unique_ptr<JsonValue> AceTracker::trackInfo_ = nullptr;
+std::vector<std::string> GetScopeNames()
+{
+    std::lock_guard<std::mutex> lock(g_scopeMutex);
+    return g_scopeNames;
+}
+
+std::vector<std::shared_ptr<TrackRing>> GetRings()
+{
+    std::lock_guard<std::mutex> lock(g_ringMutex);
+    return g_rings;
+}
+
+const std::string& GetScopeName(const std::vector<std::string>& names, uint32_t scopeId)
+{
+    static const std::string unknown = "unknown";
+    return scopeId < names.size() ? names[scopeId] : unknown;
+}
+
+} // namespace
+
+uint32_t AceTracker::RegisterScope(const char* name)
+{
+    std::lock_guard<std::mutex> lock(g_scopeMutex);
+    auto iter = std::find(g_scopeNames.begin(), g_scopeNames.end(), name);
+    if (iter != g_scopeNames.end()) {
+        return static_cast<uint32_t>(std::distance(g_scopeNames.begin(), iter));
+    }
+    g_scopeNames.emplace_back(name);
+    return static_cast<uint32_t>(g_scopeNames.size() - 1);
+}
+
+void AceTracker::SetEnabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool AceTracker::IsEnabled()
+{
+    return g_enabled.load(std::memory_order_relaxed) || t_frameTracking;
+}
 
 void AceTracker::Start()
 {
-    trackInfo_ = JsonUtil::Create(true);
+    auto ring = t_localRing.Get();
+    ring->frameStart = ring->head.load(std::memory_order_relaxed);
+    t_frameTracking = true;
 }
 
 std::string AceTracker::Stop()
 {
-    if (trackInfo_) {
-        auto info = trackInfo_->ToString();
-        trackInfo_.reset(nullptr);
-        return info;
+    if (!t_frameTracking) {
+        return "{}";
+    }
+    t_frameTracking = false;
+    auto ring = t_localRing.Get();
+    std::vector<TrackEvent> events;
+    CopyEvents(*ring, ring->frameStart, events);
+
+    // Keep the order in which scopes finished, and sum up scopes entered several times in one frame.
+    std::vector<std::pair<uint32_t, int64_t>> costs;
+    for (const auto& event : events) {
+        auto iter = std::find_if(costs.begin(), costs.end(),
+            [scopeId = event.scopeId](const std::pair<uint32_t, int64_t>& cost) { return cost.first == scopeId; });
+        if (iter == costs.end()) {
+            costs.emplace_back(event.scopeId, event.end - event.begin);
+        } else {
+            iter->second += event.end - event.begin;
+        }
+    }
+    auto names = GetScopeNames();
+    auto trackInfo = JsonUtil::Create(true);
+    for (const auto& cost : costs) {
+        // convert micro sec to ms with 1000.
+        trackInfo->Put(GetScopeName(names, cost.first).c_str(), cost.second / MICRO_SEC_PER_MILLI_SEC);
+    }
+    return trackInfo->ToString();
+}
+
+std::vector<TrackStat> AceTracker::GetAggregate()
+{
+    auto names = GetScopeNames();
+    std::unordered_map<uint32_t, TrackStat> statMap;
+    std::vector<TrackEvent> events;
+    for (const auto& ring : GetRings()) {
+        events.clear();
+        CopyEvents(*ring, 0, events);
+        for (const auto& event : events) {
+            auto& stat = statMap[event.scopeId];
+            auto cost = event.end - event.begin;
+            ++stat.count;
+            stat.total += cost;
+            stat.max = std::max(stat.max, cost);
+        }
+    }
+    std::vector<TrackStat> stats;
+    stats.reserve(statMap.size());
+    for (auto& [scopeId, stat] : statMap) {
+        stat.name = GetScopeName(names, scopeId);
+        stats.emplace_back(std::move(stat));
     }
-    return "{}";
+    std::sort(stats.begin(), stats.end(), [](const TrackStat& lhs, const TrackStat& rhs) {
+        return lhs.total > rhs.total;
+    });
+    return stats;
 }
 
-AceScopedTracker::AceScopedTracker(const std::string& tag) : tag_(tag)
+std::string AceTracker::ExportChromeTrace()
 {
-    if (AceTracker::trackInfo_) {
+    auto names = GetScopeNames();
+    std::string result = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    std::vector<TrackEvent> events;
+    for (const auto& ring : GetRings()) {
+        events.clear();
+        CopyEvents(*ring, 0, events);
+        for (const auto& event : events) {
+            if (!first) {
+                result.append(",");
+            }
+            first = false;
+            // Complete events nest by timestamp, depth is kept in args for the aggregate tools.
+            result.append("{\"name\":\"").append(GetScopeName(names, event.scopeId));
+            result.append("\",\"cat\":\"ace\",\"ph\":\"X\",\"pid\":0,\"tid\":").append(std::to_string(ring->index));
+            result.append(",\"ts\":").append(std::to_string(event.begin));
+            result.append(",\"dur\":").append(std::to_string(event.end - event.begin));
+            result.append(",\"args\":{\"depth\":").append(std::to_string(event.depth)).append("}}");
+        }
+    }
+    result.append("]}");
+    return result;
+}
+
+bool AceTracker::ExportChromeTrace(const std::string& path)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        LOGE("open trace file failed: %{private}s", path.c_str());
+        return false;
+    }
+    file << ExportChromeTrace();
+    return file.good();
+}
+
+void AceTracker::Dump(const std::vector<std::string>& params)
+{
+    if (params.size() > 2 && params[1] == "-chrome") {
+        if (ExportChromeTrace(params[2])) {
+            DumpLog::GetInstance().Print("Export chrome trace to " + params[2]);
+        } else {
+            DumpLog::GetInstance().Print("Error: failed to export chrome trace to " + params[2]);
+        }
+        return;
+    }
+    if (params.size() > 1 && params[1] == "-clear") {
+        Clear();
+        DumpLog::GetInstance().Print("Tracker cleared");
+        return;
+    }
+    DumpLog::GetInstance().Print(std::string("Tracker enabled: ") + (IsEnabled() ? "true" : "false"));
+    DumpLog::GetInstance().Print("scope | count | total(ms) | avg(ms) | max(ms)");
+    for (const auto& stat : GetAggregate()) {
+        std::stringstream stream;
+        stream << stat.name << " | " << stat.count << " | " << stat.total / MICRO_SEC_PER_MILLI_SEC << " | "
+               << (stat.count > 0 ? stat.total / MICRO_SEC_PER_MILLI_SEC / stat.count : 0.0) << " | "
+               << stat.max / MICRO_SEC_PER_MILLI_SEC;
+        DumpLog::GetInstance().Print(1, stream.str());
+    }
+}
+
+void AceTracker::Clear()
+{
+    for (const auto& ring : GetRings()) {
+        ring->base.store(ring->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+void AceTracker::Record(uint32_t scopeId, uint32_t depth, int64_t begin, int64_t end)
+{
+    auto ring = t_localRing.Get();
+    auto head = ring->head.load(std::memory_order_relaxed);
+    auto& event = ring->events[head & RING_MASK];
+    event.scopeId = scopeId;
+    event.depth = depth;
+    event.begin = begin;
+    event.end = end;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+uint32_t AceTracker::EnterScope()
+{
+    return t_localRing.Get()->depth++;
+}
+
+void AceTracker::LeaveScope()
+{
+    auto ring = t_localRing.Get();
+    if (ring->depth > 0) {
+        --ring->depth;
+    }
+}
+
+AceScopedTracker::AceScopedTracker(uint32_t scopeId) : scopeId_(scopeId)
+{
+    enabled_ = AceTracker::IsEnabled();
+    if (enabled_) {
+        depth_ = AceTracker::EnterScope();
         // micro sec.
         markTime_ = GetMicroTickCount();
     }
 }
+
 AceScopedTracker::~AceScopedTracker()
 {
-    if (AceTracker::trackInfo_) {
-        // convert micro sec to ms with 1000.
-        AceTracker::trackInfo_->Put(tag_.c_str(), (GetMicroTickCount() - markTime_) / 1000.0);
+    if (enabled_) {
+        AceTracker::LeaveScope();
+        AceTracker::Record(scopeId_, depth_, markTime_, GetMicroTickCount());
     }
 }
 
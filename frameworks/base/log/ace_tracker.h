@@ -20,26 +20,68 @@
 #include <cstdint>
 #include <cstdio>
 #include <string>
+#include <vector>
 
 #include "base/json/json_util.h"
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
 
-#define ACE_FUNCTION_TRACK() AceScopedTracker aceScopedTracker(__func__)
+// The scope name is interned once per call site, so a tracked scope only costs two tick reads and a ring write.
+#define ACE_FUNCTION_TRACK()                                                       \
+    static const uint32_t aceTrackerScopeId = AceTracker::RegisterScope(__func__); \
+    AceScopedTracker aceScopedTracker(aceTrackerScopeId)
 
 namespace OHOS::Ace {
 
+struct TrackEvent {
+    uint32_t scopeId = 0;
+    uint32_t depth = 0;
+    // micro sec
+    int64_t begin = 0;
+    int64_t end = 0;
+};
+
+struct TrackStat {
+    std::string name;
+    uint32_t count = 0;
+    // micro sec
+    int64_t total = 0;
+    int64_t max = 0;
+};
+
+// AceTracker keeps finished scopes in a fixed-size ring buffer per thread. Writers never take a lock, readers copy
+// the rings on demand, so the tracker can stay enabled on release builds.
 class ACE_EXPORT AceTracker final {
 public:
+    static uint32_t RegisterScope(const char* name);
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    // Marks the beginning of a frame on current thread.
     static void Start();
 
+    // Returns the time (ms) spent in each scope finished on current thread since last Start, as json.
     static std::string Stop();
 
+    // Per-scope aggregate over all events still held in the rings, sorted by total time.
+    static std::vector<TrackStat> GetAggregate();
+
+    // Exports all events still held in the rings in chrome trace event format, which Perfetto UI also loads.
+    static std::string ExportChromeTrace();
+    static bool ExportChromeTrace(const std::string& path);
+
+    static void Dump(const std::vector<std::string>& params);
+
+    static void Clear();
+
 private:
     AceTracker() = default;
     ~AceTracker() = default;
 
-    static std::unique_ptr<JsonValue> trackInfo_;
+    static void Record(uint32_t scopeId, uint32_t depth, int64_t begin, int64_t end);
+    static uint32_t EnterScope();
+    static void LeaveScope();
 
     friend class AceScopedTracker;
     ACE_DISALLOW_COPY_AND_MOVE(AceTracker);
@@ -47,11 +89,13 @@ private:
 
 class ACE_EXPORT AceScopedTracker final {
 public:
-    explicit AceScopedTracker(const std::string& tag);
+    explicit AceScopedTracker(uint32_t scopeId);
     ~AceScopedTracker();
 
 private:
-    std::string tag_;
+    uint32_t scopeId_ = 0;
+    uint32_t depth_ = 0;
+    bool enabled_ = false;
     // micro sec
     int64_t markTime_ = 0;
 
@@ -60,4 +104,4 @@ private:
 
 } // namespace OHOS::Ace
 
-#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_ACE_TRACKER_H
\ No newline at end of file
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_ACE_TRACKER_H
@@ -15,8 +15,13 @@
 
 #include "base/memory/memory_monitor.h"
 
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #if !defined(WINDOWS_PLATFORM) and !defined(MAC_PLATFORM)
 #include <malloc.h>
@@ -37,86 +42,160 @@ void PurgeMallocCache()
 }
 
 #ifdef ACE_MEMORY_MONITOR
-class MemoryMonitorImpl : public MemoryMonitor {
+namespace {
+
+// Counters are split into shards on their own cache lines, threads counting objects at the same time seldom touch
+// the same shard.
+constexpr size_t SHARD_COUNT = 8;
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+size_t GetShardIndex()
+{
+    static std::atomic<size_t> nextShard { 0 };
+    thread_local size_t shardIndex = nextShard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+    return shardIndex;
+}
+
+class ShardedCounter final {
 public:
-    void Add(void* ptr) final
+    void Increase()
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto result = memoryMap_.emplace(ptr, MemInfo());
-        if (!result.second) {
-            LOGE("Address is already in memory map");
-            return;
-        }
+        shards_[GetShardIndex()].value.fetch_add(1, std::memory_order_relaxed);
+    }
 
-        count_++;
+    void Decrease()
+    {
+        shards_[GetShardIndex()].value.fetch_sub(1, std::memory_order_relaxed);
     }
 
-    void Remove(void* ptr) final
+    int64_t Sum() const
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = memoryMap_.find(ptr);
-        if (it == memoryMap_.end()) {
-            LOGE("Address MUST be in memory map");
-            return;
+        int64_t sum = 0;
+        for (const auto& shard : shards_) {
+            sum += shard.value.load(std::memory_order_relaxed);
         }
-        count_--;
+        return sum;
+    }
 
-        if (it->second.size > 0) {
-            total_ -= it->second.size;
-            auto& info = typeMap_[it->second.typeName];
-            info.count--;
-            info.total -= it->second.size;
-        }
-        memoryMap_.erase(it);
+private:
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<int64_t> value { 0 };
+    };
+
+    Shard shards_[SHARD_COUNT];
+};
+
+// Types without type info share the id, they are told apart by size.
+using CounterKey = std::pair<TypeInfoBase::IdType, size_t>;
+
+struct CounterKeyHash {
+    size_t operator()(const CounterKey& key) const
+    {
+        return key.first ^ (std::hash<size_t> {}(key.second) << 1);
+    }
+};
+
+} // namespace
+
+struct MemoryTypeCounter {
+    MemoryTypeCounter(const char* name, size_t size) : typeName(name != nullptr ? name : "Unknown"), size(size) {}
+
+    const std::string typeName;
+    const size_t size;
+    ShardedCounter count;
+};
+
+class MemoryMonitorImpl : public MemoryMonitor {
+public:
+    void Add(void* ptr) final
+    {
+        count_.Increase();
     }
 
-    void Update(void* ptr, size_t size, const std::string& typeName) final
+    void Remove(void* ptr, MemoryTypeCounter* counter) final
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = memoryMap_.find(ptr);
-        if (it == memoryMap_.end()) {
-            LOGE("Address MUST be in memory map");
-            return;
+        count_.Decrease();
+        if (counter != nullptr) {
+            counter->count.Decrease();
         }
+    }
 
-        it->second.size = size;
-        it->second.typeName = typeName;
-
-        total_ += size;
-        auto& info = typeMap_[typeName];
-        info.count++;
-        info.total += size;
+    MemoryTypeCounter* Update(void* ptr, size_t size, TypeInfoBase::IdType typeId, const char* typeName) final
+    {
+        // Each thread keeps the counters it has used, so the lock is only taken the first time a type is met.
+        thread_local std::unordered_map<CounterKey, MemoryTypeCounter*, CounterKeyHash> localCounters;
+        CounterKey key(typeId, size);
+        MemoryTypeCounter* counter = nullptr;
+        auto iter = localCounters.find(key);
+        if (iter != localCounters.end()) {
+            counter = iter->second;
+        } else {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto& slot = counters_[key];
+                if (!slot) {
+                    slot = std::make_unique<MemoryTypeCounter>(typeName, size);
+                }
+                counter = slot.get();
+            }
+            localCounters.emplace(key, counter);
+        }
+        counter->count.Increase();
+        return counter;
     }
 
     void Dump() const final
     {
+        std::map<std::string, TypeInfo> types;
         std::lock_guard<std::mutex> lock(mutex_);
-        std::string out = "total = " + std::to_string(total_) + ", count = " + std::to_string(count_);
-        DumpLog::GetInstance().Print(0, out);
-        for (auto&& [typeName, info] : typeMap_) {
-            if (info.total == 0) {
-                continue;
+        for (const auto& [key, counter] : counters_) {
+            auto count = counter->count.Sum();
+            auto& info = types[counter->typeName];
+            info.count += count;
+            info.total += count * static_cast<int64_t>(counter->size);
+        }
+
+        int64_t total = 0;
+        std::vector<std::pair<std::string, TypeInfo>> sortedTypes;
+        for (auto& [typeName, info] : types) {
+            total += info.total;
+            auto last = lastCounts_.find(typeName);
+            info.diff = info.count - (last == lastCounts_.end() ? 0 : last->second);
+            if (info.total != 0 || info.diff != 0) {
+                sortedTypes.emplace_back(typeName, info);
             }
-            out = typeName + ": total = " + std::to_string(info.total) + ", count = " + std::to_string(info.count);
+        }
+        // Types holding the most memory first.
+        std::sort(sortedTypes.begin(), sortedTypes.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second.total > rhs.second.total; });
+
+        std::string out = "total = " + std::to_string(total) + ", count = " + std::to_string(count_.Sum());
+        DumpLog::GetInstance().Print(0, out);
+        for (const auto& [typeName, info] : sortedTypes) {
+            out = typeName + ": total = " + std::to_string(info.total) + ", count = " + std::to_string(info.count) +
+                  ", diff = " + (info.diff > 0 ? "+" : "") + std::to_string(info.diff);
             DumpLog::GetInstance().Print(1, out);
         }
+
+        lastCounts_.clear();
+        for (const auto& [typeName, info] : types) {
+            lastCounts_.emplace(typeName, info.count);
+        }
     }
 
 private:
-    struct MemInfo {
-        size_t size = 0;
-        std::string typeName = "Unknown";
-    };
-
     struct TypeInfo {
-        size_t count = 0;
-        size_t total = 0;
+        int64_t count = 0;
+        int64_t total = 0;
+        // Change of count since the last dump.
+        int64_t diff = 0;
     };
 
-    std::map<void*, MemInfo> memoryMap_;
-    std::map<std::string, TypeInfo> typeMap_;
-    size_t total_ = 0;
-    size_t count_ = 0;
+    // Counters live as long as the process, objects and threads keep pointers to them.
+    std::map<CounterKey, std::unique_ptr<MemoryTypeCounter>> counters_;
+    ShardedCounter count_;
+    // Count of each type at the last dump.
+    mutable std::map<std::string, int64_t> lastCounts_;
 
     mutable std::mutex mutex_;
 };
@@ -27,6 +27,9 @@ namespace OHOS::Ace {
 void PurgeMallocCache();
 
 #ifdef ACE_MEMORY_MONITOR
+// Live objects of one type, defined in memory_monitor.cpp.
+struct MemoryTypeCounter;
+
 class ACE_EXPORT MemoryMonitor {
 public:
     static MemoryMonitor& GetInstance();
@@ -34,16 +37,20 @@ public:
     virtual ~MemoryMonitor() = default;
 
     virtual void Add(void* ptr) = 0;
-    virtual void Remove(void* ptr) = 0;
-    virtual void Update(void* ptr, size_t size, const std::string& typeName) = 0;
+    // |counter| is the one returned by 'Update' for the object, or nullptr if the object has never been claimed.
+    virtual void Remove(void* ptr, MemoryTypeCounter* counter) = 0;
+    virtual MemoryTypeCounter* Update(void* ptr, size_t size, TypeInfoBase::IdType typeId, const char* typeName) = 0;
+    // Prints live objects of each type, and how they changed since the last dump.
     virtual void Dump() const = 0;
 
+    // Returns the counter of the type of |ptr| when it is claimed for the first time, otherwise returns nullptr.
     template<class T>
-    void Update(T* ptr, void* refPtr)
+    MemoryTypeCounter* Update(T* ptr, void* refPtr)
     {
         if (ptr != nullptr && ptr->RefCount() == 0) {
-            Update(refPtr, TypeInfo<T>::Size(ptr), TypeInfo<T>::Name(ptr));
+            return Update(refPtr, TypeInfo<T>::Size(ptr), TypeInfo<T>::Id(ptr), TypeInfo<T>::Name(ptr));
         }
+        return nullptr;
     }
 
 private:
@@ -57,6 +64,11 @@ private:
             return "Unknown";
         }
 
+        static TypeInfoBase::IdType Id(T*)
+        {
+            return 0;
+        }
+
         static size_t Size(T*)
         {
             return sizeof(T);
@@ -70,6 +82,11 @@ private:
             return TypeInfoHelper::TypeName(rawPtr);
         }
 
+        static TypeInfoBase::IdType Id(T* rawPtr)
+        {
+            return TypeInfoHelper::TypeId(rawPtr);
+        }
+
         static size_t Size(T* rawPtr)
         {
             return TypeInfoHelper::TypeSize(rawPtr);
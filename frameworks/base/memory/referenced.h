@@ -39,7 +39,10 @@ public:
     static RefPtr<T> Claim(T* rawPtr)
     {
 #ifdef ACE_MEMORY_MONITOR
-        MemoryMonitor::GetInstance().Update(rawPtr, static_cast<Referenced*>(rawPtr));
+        auto counter = MemoryMonitor::GetInstance().Update(rawPtr, static_cast<Referenced*>(rawPtr));
+        if (counter != nullptr) {
+            static_cast<Referenced*>(rawPtr)->typeCounter_ = counter;
+        }
 #endif
         return RefPtr<T>(rawPtr);
     }
@@ -99,7 +102,7 @@ protected:
         refCounter_->DecWeakRef();
         refCounter_ = nullptr;
 #ifdef ACE_MEMORY_MONITOR
-        MemoryMonitor::GetInstance().Remove(this);
+        MemoryMonitor::GetInstance().Remove(this, typeCounter_);
 #endif
     }
 
@@ -115,6 +118,10 @@ private:
     friend class WeakPtr;
 
     RefCounter* refCounter_ { nullptr };
+#ifdef ACE_MEMORY_MONITOR
+    // Kept with the object, so that the monitor needs no map of live objects to count it out.
+    MemoryTypeCounter* typeCounter_ { nullptr };
+#endif
 
     ACE_DISALLOW_COPY_AND_MOVE(Referenced);
 };
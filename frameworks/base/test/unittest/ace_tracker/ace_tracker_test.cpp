@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_util.h"
+#include "base/log/ace_tracker.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t LOOP_COUNT = 10;
+constexpr int32_t RING_OVERFLOW_COUNT = 10000;
+// Same as the capacity of the ring of a thread.
+constexpr int32_t RING_CAPACITY = 4096;
+
+void TrackedInner()
+{
+    ACE_FUNCTION_TRACK();
+}
+
+void TrackedOuter()
+{
+    ACE_FUNCTION_TRACK();
+    TrackedInner();
+}
+
+const TrackStat* FindStat(const std::vector<TrackStat>& stats, const std::string& name)
+{
+    for (const auto& stat : stats) {
+        if (stat.name == name) {
+            return &stat;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+class AceTrackerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        AceTracker::SetEnabled(true);
+        AceTracker::Clear();
+    }
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: AceTrackerTest001
+ * @tc.desc: Scope ids are interned once per name.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTrackerTest, AceTrackerTest001, TestSize.Level1)
+{
+    auto first = AceTracker::RegisterScope("AceTrackerTest001");
+    auto second = AceTracker::RegisterScope("AceTrackerTest001");
+    auto other = AceTracker::RegisterScope("AceTrackerTest001Other");
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+}
+
+/**
+ * @tc.name: AceTrackerTest002
+ * @tc.desc: Nested scopes are aggregated per scope with the right count.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTrackerTest, AceTrackerTest002, TestSize.Level1)
+{
+    for (int32_t i = 0; i < LOOP_COUNT; ++i) {
+        TrackedOuter();
+    }
+    auto stats = AceTracker::GetAggregate();
+    auto outer = FindStat(stats, "TrackedOuter");
+    auto inner = FindStat(stats, "TrackedInner");
+    ASSERT_TRUE(outer != nullptr);
+    ASSERT_TRUE(inner != nullptr);
+    EXPECT_EQ(outer->count, static_cast<uint32_t>(LOOP_COUNT));
+    EXPECT_EQ(inner->count, static_cast<uint32_t>(LOOP_COUNT));
+    EXPECT_GE(outer->total, inner->total);
+}
+
+/**
+ * @tc.name: AceTrackerTest003
+ * @tc.desc: Start and Stop report scopes of current frame as json, even when tracker is disabled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTrackerTest, AceTrackerTest003, TestSize.Level1)
+{
+    AceTracker::SetEnabled(false);
+    TrackedOuter();
+    EXPECT_TRUE(AceTracker::GetAggregate().empty());
+
+    AceTracker::Start();
+    TrackedOuter();
+    auto info = JsonUtil::ParseJsonString(AceTracker::Stop());
+    ASSERT_TRUE(info);
+    EXPECT_TRUE(info->Contains("TrackedOuter"));
+    EXPECT_TRUE(info->Contains("TrackedInner"));
+    EXPECT_EQ(AceTracker::Stop(), "{}");
+}
+
+/**
+ * @tc.name: AceTrackerTest004
+ * @tc.desc: Events of every thread are exported in chrome trace format, and the ring drops the oldest events.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTrackerTest, AceTrackerTest004, TestSize.Level1)
+{
+    std::thread worker([]() {
+        for (int32_t i = 0; i < RING_OVERFLOW_COUNT; ++i) {
+            TrackedInner();
+        }
+    });
+    worker.join();
+    TrackedOuter();
+
+    auto trace = JsonUtil::ParseJsonString(AceTracker::ExportChromeTrace());
+    ASSERT_TRUE(trace);
+    auto events = trace->GetValue("traceEvents");
+    ASSERT_TRUE(events && events->IsArray());
+    EXPECT_GT(events->GetArraySize(), 0);
+    EXPECT_LT(events->GetArraySize(), RING_OVERFLOW_COUNT);
+}
+
+/**
+ * @tc.name: AceTrackerTest005
+ * @tc.desc: The slot which the next event is written to is not exported when the ring is full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTrackerTest, AceTrackerTest005, TestSize.Level1)
+{
+    std::thread worker([]() {
+        for (int32_t i = 0; i < RING_CAPACITY; ++i) {
+            TrackedInner();
+        }
+    });
+    worker.join();
+
+    auto stats = AceTracker::GetAggregate();
+    auto inner = FindStat(stats, "TrackedInner");
+    ASSERT_TRUE(inner != nullptr);
+    EXPECT_EQ(inner->count, static_cast<uint32_t>(RING_CAPACITY - 1));
+}
+
+} // namespace OHOS::Ace
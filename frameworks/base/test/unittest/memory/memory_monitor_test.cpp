@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/log/dump_log.h"
+#include "base/log/log.h"
+#include "base/memory/memory_monitor.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+#ifdef ACE_MEMORY_MONITOR
+namespace {
+
+constexpr TypeInfoBase::IdType FIRST_TYPE_ID = 0x5a5a0001;
+constexpr TypeInfoBase::IdType SECOND_TYPE_ID = 0x5a5a0002;
+constexpr TypeInfoBase::IdType BENCH_TYPE_ID = 0x5a5a0003;
+constexpr size_t FIRST_TYPE_SIZE = 16;
+constexpr size_t SECOND_TYPE_SIZE = 24;
+constexpr size_t BENCH_TYPE_SIZE = 32;
+constexpr int32_t THREAD_COUNT = 4;
+constexpr int32_t OBJECT_COUNT = 100000;
+
+// The monitor before counters were sharded: every object in a map and every type counted under one lock.
+class LockedMonitor {
+public:
+    void Update(void* ptr, size_t size, const char* typeName)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        objects_[ptr] = typeName;
+        auto& info = types_[typeName];
+        ++info.first;
+        info.second += static_cast<int64_t>(size);
+    }
+
+    void Remove(void* ptr, size_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = objects_.find(ptr);
+        if (iter == objects_.end()) {
+            return;
+        }
+        auto& info = types_[iter->second];
+        --info.first;
+        info.second -= static_cast<int64_t>(size);
+        objects_.erase(iter);
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<void*, std::string> objects_;
+    std::map<std::string, std::pair<int64_t, int64_t>> types_;
+};
+
+std::string DumpMonitor()
+{
+    DumpLog::GetInstance().SetDumpFile(std::make_unique<std::ostringstream>());
+    MemoryMonitor::GetInstance().Dump();
+    auto out = static_cast<std::ostringstream*>(DumpLog::GetInstance().GetDumpFile().get())->str();
+    DumpLog::GetInstance().Reset();
+    return out;
+}
+
+template<class Func>
+int64_t MeasureInThreads(Func&& func)
+{
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_COUNT; ++i) {
+        threads.emplace_back(func, i);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+} // namespace
+#endif // ACE_MEMORY_MONITOR
+
+class MemoryMonitorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+#ifdef ACE_MEMORY_MONITOR
+/**
+ * @tc.name: MemoryMonitor001
+ * @tc.desc: Test live objects are counted per type, and the dump shows the change since the last dump.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryMonitorTest, MemoryMonitor001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Claim three objects of one type and two of another, then release one of the first type.
+     * @tc.expected: step1. Each type is dumped with its live objects and the bytes they hold.
+     */
+    auto& monitor = MemoryMonitor::GetInstance();
+    DumpMonitor();
+    int32_t objects[5] = { 0 };
+    std::vector<MemoryTypeCounter*> counters;
+    for (int32_t i = 0; i < 3; ++i) {
+        monitor.Add(&objects[i]);
+        counters.emplace_back(monitor.Update(&objects[i], FIRST_TYPE_SIZE, FIRST_TYPE_ID, "MonitorFirstType"));
+    }
+    for (int32_t i = 3; i < 5; ++i) {
+        monitor.Add(&objects[i]);
+        counters.emplace_back(monitor.Update(&objects[i], SECOND_TYPE_SIZE, SECOND_TYPE_ID, "MonitorSecondType"));
+    }
+    EXPECT_EQ(counters[0], counters[1]);
+    EXPECT_NE(counters[0], counters[3]);
+    monitor.Remove(&objects[0], counters[0]);
+    auto out = DumpMonitor();
+    EXPECT_NE(out.find("MonitorFirstType: total = 32, count = 2, diff = +2"), std::string::npos);
+    EXPECT_NE(out.find("MonitorSecondType: total = 48, count = 2, diff = +2"), std::string::npos);
+
+    /**
+     * @tc.steps: step2. Release the other objects and dump again.
+     * @tc.expected: step2. The first type is dumped with what it released, the second type is gone from the dump.
+     */
+    for (int32_t i = 1; i < 5; ++i) {
+        monitor.Remove(&objects[i], counters[i]);
+    }
+    out = DumpMonitor();
+    EXPECT_NE(out.find("MonitorFirstType: total = 0, count = 0, diff = -2"), std::string::npos);
+    EXPECT_NE(out.find("MonitorSecondType: total = 0, count = 0, diff = -2"), std::string::npos);
+    out = DumpMonitor();
+    EXPECT_EQ(out.find("MonitorFirstType"), std::string::npos);
+    EXPECT_EQ(out.find("MonitorSecondType"), std::string::npos);
+}
+
+/**
+ * @tc.name: MemoryMonitor002
+ * @tc.desc: Measure the cost of counting objects claimed and released in several threads.
+ * @tc.type: PERF
+ */
+HWTEST_F(MemoryMonitorTest, MemoryMonitor002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Claim and release objects of one type in several threads with the sharded counters.
+     * @tc.expected: step1. No object of the type is left.
+     */
+    auto& monitor = MemoryMonitor::GetInstance();
+    DumpMonitor();
+    std::vector<int32_t> objects(THREAD_COUNT * OBJECT_COUNT);
+    int64_t shardedCost = MeasureInThreads([&monitor, &objects](int32_t thread) {
+        for (int32_t i = 0; i < OBJECT_COUNT; ++i) {
+            auto ptr = &objects[thread * OBJECT_COUNT + i];
+            monitor.Add(ptr);
+            monitor.Remove(ptr, monitor.Update(ptr, BENCH_TYPE_SIZE, BENCH_TYPE_ID, "MonitorBenchType"));
+        }
+    });
+    EXPECT_EQ(DumpMonitor().find("MonitorBenchType"), std::string::npos);
+
+    /**
+     * @tc.steps: step2. Do the same with one lock and a map of live objects.
+     */
+    LockedMonitor lockedMonitor;
+    int64_t lockedCost = MeasureInThreads([&lockedMonitor, &objects](int32_t thread) {
+        for (int32_t i = 0; i < OBJECT_COUNT; ++i) {
+            auto ptr = &objects[thread * OBJECT_COUNT + i];
+            lockedMonitor.Update(ptr, BENCH_TYPE_SIZE, "MonitorBenchType");
+            lockedMonitor.Remove(ptr, BENCH_TYPE_SIZE);
+        }
+    });
+    LOGI("%{public}d objects in %{public}d threads: sharded counters %{public}lld us, locked map %{public}lld us",
+        OBJECT_COUNT, THREAD_COUNT, static_cast<long long>(shardedCost), static_cast<long long>(lockedCost));
+}
+#endif // ACE_MEMORY_MONITOR
+
+} // namespace OHOS::Ace
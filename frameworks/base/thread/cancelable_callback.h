@@ -51,6 +51,11 @@ public:
     {
         return impl_ && impl_->callback_;
     }
+    // Returns true if the callback has been canceled by any copy of it before it runs.
+    bool IsCanceled() const
+    {
+        return impl_ && impl_->status_.load(std::memory_order_relaxed) == CANCELED;
+    }
 
 private:
     enum : int32_t {
@@ -265,6 +265,12 @@ public:
         return windowAnimationEnabled_;
     }
 
+    // Sizes measured asynchronously, such as the size of images, are saved for the first frame of the next launches.
+    static bool GetFirstFrameLayoutCacheEnabled()
+    {
+        return firstFrameLayoutCacheEnabled_;
+    }
+
 private:
     static bool traceEnabled_;
     static bool accessibilityEnabled_;
@@ -289,6 +295,7 @@ private:
     static bool rosenBackendEnabled_;
     static bool windowAnimationEnabled_;
     static bool debugEnabled_;
+    static bool firstFrameLayoutCacheEnabled_;
     static int32_t windowPosX_;
     static int32_t windowPosY_;
 };
@@ -20,6 +20,7 @@
 
 #include "base/log/event_report.h"
 #include "core/common/thread_checker.h"
+#include "frameworks/bridge/card_frontend/card_template_pool.h"
 #include "frameworks/bridge/common/utils/utils.h"
 
 namespace OHOS::Ace {
@@ -175,7 +176,8 @@ void CardFrontend::ParsePage(const RefPtr<PipelineContext>& context, const std::
     const std::string& params, const RefPtr<Framework::JsAcePage>& page)
 {
     CHECK_RUN_ON(JS);
-    auto rootBody = Framework::ParseFileData(pageContent);
+    // Cards showing the same page share its parsed templates.
+    auto rootBody = Framework::CardTemplatePool::GetInstance().CheckOut(pageContent);
     if (!rootBody) {
         LOGE("parse index json error");
         return;
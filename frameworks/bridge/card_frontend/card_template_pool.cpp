@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frameworks/bridge/card_frontend/card_template_pool.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "base/log/ace_trace.h"
+#include "base/thread/background_task_executor.h"
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr size_t DEFAULT_WARM_POOL_SIZE = 2;
+constexpr size_t MAX_POOLED_PAGES = 8;
+// A page is warmed up when it is checked out again, which means more cards of the page are likely to start.
+constexpr size_t MIN_CHECK_OUTS_TO_WARM = 2;
+
+std::unique_ptr<JsonValue> ParseTemplate(const std::string& content)
+{
+    auto rootBody = JsonUtil::ParseJsonString(content);
+    if (!rootBody || !rootBody->IsValid()) {
+        return nullptr;
+    }
+    return rootBody;
+}
+
+} // namespace
+
+CardTemplatePool& CardTemplatePool::GetInstance()
+{
+    static CardTemplatePool instance;
+    return instance;
+}
+
+CardTemplatePool::CardTemplatePool() : warmPoolSize_(DEFAULT_WARM_POOL_SIZE) {}
+
+void CardTemplatePool::SetWarmPoolSize(size_t warmPoolSize)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    warmPoolSize_ = warmPoolSize;
+    if (warmPoolSize_ == 0) {
+        entries_.clear();
+        return;
+    }
+    for (auto& entry : entries_) {
+        while (entry.templates.size() > warmPoolSize_) {
+            entry.templates.pop_back();
+        }
+    }
+}
+
+size_t CardTemplatePool::GetWarmPoolSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return warmPoolSize_;
+}
+
+std::list<CardTemplatePool::Entry>::iterator CardTemplatePool::FindEntryLocked(
+    size_t hash, const std::string& content)
+{
+    return std::find_if(entries_.begin(), entries_.end(),
+        [hash, &content](const Entry& entry) { return entry.hash == hash && *entry.content == content; });
+}
+
+std::unique_ptr<JsonValue> CardTemplatePool::CheckOut(const std::string& content)
+{
+    ACE_SCOPED_TRACE("CardTemplatePool::CheckOut");
+    size_t hash = std::hash<std::string> {}(content);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (warmPoolSize_ > 0) {
+            auto iter = FindEntryLocked(hash, content);
+            if (iter == entries_.end()) {
+                if (entries_.size() >= MAX_POOLED_PAGES) {
+                    entries_.pop_back();
+                }
+                Entry entry;
+                entry.hash = hash;
+                entry.content = std::make_shared<const std::string>(content);
+                entries_.emplace_front(std::move(entry));
+            } else if (iter != entries_.begin()) {
+                entries_.splice(entries_.begin(), entries_, iter);
+            }
+            auto& entry = entries_.front();
+            ++entry.checkOutCount;
+            std::unique_ptr<JsonValue> rootBody;
+            if (!entry.templates.empty()) {
+                rootBody = std::move(entry.templates.front());
+                entry.templates.pop_front();
+            }
+            if (entry.checkOutCount >= MIN_CHECK_OUTS_TO_WARM) {
+                RefillLocked(entry);
+            }
+            if (rootBody) {
+                return rootBody;
+            }
+        }
+    }
+    // No template is ready, parse it on the current thread.
+    return ParseTemplate(content);
+}
+
+void CardTemplatePool::RefillLocked(Entry& entry)
+{
+    if (entry.isRefilling || entry.templates.size() >= warmPoolSize_) {
+        return;
+    }
+    entry.isRefilling = true;
+    size_t count = warmPoolSize_ - entry.templates.size();
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [hash = entry.hash, content = entry.content, count]() {
+            std::list<std::unique_ptr<JsonValue>> templates;
+            for (size_t i = 0; i < count; ++i) {
+                auto rootBody = ParseTemplate(*content);
+                if (!rootBody) {
+                    break;
+                }
+                templates.emplace_back(std::move(rootBody));
+            }
+
+            auto& pool = CardTemplatePool::GetInstance();
+            std::lock_guard<std::mutex> lock(pool.mutex_);
+            auto iter = std::find_if(pool.entries_.begin(), pool.entries_.end(),
+                [hash, &content](const Entry& entry) { return entry.hash == hash && entry.content == content; });
+            if (iter == pool.entries_.end()) {
+                // The page has been dropped from the pool.
+                return;
+            }
+            iter->isRefilling = false;
+            while (!templates.empty() && iter->templates.size() < pool.warmPoolSize_) {
+                iter->templates.emplace_back(std::move(templates.front()));
+                templates.pop_front();
+            }
+        },
+        BgTaskPriority::LOW);
+}
+
+size_t CardTemplatePool::GetWarmCount(const std::string& content) const
+{
+    size_t hash = std::hash<std::string> {}(content);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = std::find_if(entries_.begin(), entries_.end(),
+        [hash, &content](const Entry& entry) { return entry.hash == hash && *entry.content == content; });
+    return iter == entries_.end() ? 0 : iter->templates.size();
+}
+
+void CardTemplatePool::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+} // namespace OHOS::Ace::Framework
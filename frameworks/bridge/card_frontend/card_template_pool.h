@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_CARD_TEMPLATE_POOL_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_CARD_TEMPLATE_POOL_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "base/json/json_util.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::Framework {
+
+// CardTemplatePool keeps parsed templates of card pages ready for the cards to start. Cards showing the same page
+// share its content, each of them checks out a template parsed ahead on background thread, and the pool is refilled
+// after the check out. Only pages checked out more than once are kept warm, so a page shown by a single card costs no
+// parse in background. The parser modifies the template, so templates are never returned to the pool.
+class ACE_EXPORT CardTemplatePool final {
+public:
+    static CardTemplatePool& GetInstance();
+
+    // Number of parsed templates kept ready for each page, 0 disables the pool.
+    void SetWarmPoolSize(size_t warmPoolSize);
+    size_t GetWarmPoolSize() const;
+
+    // Returns the template parsed from |content|, or nullptr if the content is not a valid json.
+    std::unique_ptr<JsonValue> CheckOut(const std::string& content);
+
+    // Number of templates ready for |content|, for test.
+    size_t GetWarmCount(const std::string& content) const;
+
+    void Clear();
+
+private:
+    struct Entry {
+        size_t hash = 0;
+        std::shared_ptr<const std::string> content;
+        std::list<std::unique_ptr<JsonValue>> templates;
+        size_t checkOutCount = 0;
+        bool isRefilling = false;
+    };
+
+    CardTemplatePool();
+    ~CardTemplatePool() = default;
+
+    std::list<Entry>::iterator FindEntryLocked(size_t hash, const std::string& content);
+    void RefillLocked(Entry& entry);
+
+    mutable std::mutex mutex_;
+    size_t warmPoolSize_;
+    // Pages in the order of last use, the least recently used page is dropped when the pool is full.
+    std::list<Entry> entries_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(CardTemplatePool);
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_CARD_TEMPLATE_POOL_H
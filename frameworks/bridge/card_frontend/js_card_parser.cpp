@@ -16,6 +16,8 @@
 #include "frameworks/bridge/card_frontend/js_card_parser.h"
 
 #include <array>
+#include <cctype>
+#include <set>
 
 #include "base/i18n/localization.h"
 #include "base/resource/ace_res_config.h"
@@ -89,6 +91,31 @@ std::unique_ptr<JsonValue> GetJsonValue(
     return data;
 }
 
+// Collect names used in {{...}} of text, names of members and string literals are collected too, which is harmless.
+void CollectBindingKeys(const std::string& text, std::unordered_set<std::string>& keys)
+{
+    auto startPos = text.find("{{");
+    while (startPos != std::string::npos) {
+        auto endPos = text.find("}}", startPos + 2);
+        if (endPos == std::string::npos) {
+            return;
+        }
+        std::string name;
+        for (auto pos = startPos + 2; pos <= endPos; ++pos) {
+            auto ch = static_cast<unsigned char>(text[pos]);
+            if (std::isalpha(ch) || ch == '_' || ch == '$' || (!name.empty() && std::isdigit(ch))) {
+                name += ch;
+                continue;
+            }
+            if (!name.empty()) {
+                keys.emplace(name);
+                name.clear();
+            }
+        }
+        startPos = text.find("{{", endPos + 2);
+    }
+}
+
 std::string GetDeviceDpi(double dpi)
 {
     static const LinearMapNode<bool (*)(double)> dpiMap[] = {
@@ -1168,15 +1195,94 @@ void JsCardParser::UpdatePageData(const std::string& dataList, const RefPtr<JsAc
         LOGE("update card data error");
         return;
     }
+    std::unordered_set<std::string> changedKeys;
     while (data && data->IsValid()) {
         auto key = data->GetKey();
+        auto oldData = dataJson_->GetValue(key);
+        if (!oldData || !oldData->IsValid() || oldData->ToString() != data->ToString()) {
+            changedKeys.emplace(key);
+        }
         dataJson_->Replace(key.c_str(), data);
         repeatJson_->Replace(key.c_str(), data);
         data = data->GetNext();
     }
+    if (hasBindingIndex_ && UpdateBoundNodes(changedKeys, page)) {
+        return;
+    }
     SetUpdateStatus(page);
 }
 
+bool JsCardParser::UpdateBoundNodes(
+    const std::unordered_set<std::string>& changedKeys, const RefPtr<Framework::JsAcePage>& page)
+{
+    // Value of data may refer to other data, nodes bound to them can't be found by keys.
+    if (dataJson_->ToString().find("{{") != std::string::npos) {
+        return false;
+    }
+    std::set<size_t> boundNodes;
+    for (const auto& key : changedKeys) {
+        if (structuralKeys_.find(key) != structuralKeys_.end()) {
+            return false;
+        }
+        auto iter = keyBindings_.find(key);
+        if (iter != keyBindings_.end()) {
+            boundNodes.insert(iter->second.begin(), iter->second.end());
+        }
+    }
+    LOGD("update %{public}zu nodes bound to %{public}zu changed keys", boundNodes.size(), changedKeys.size());
+    for (auto index : boundNodes) {
+        const auto& binding = nodeBindings_[index];
+        UpdateNodeAttrsAndStyles(page, binding.node, binding.nodeId, dataJson_, styleJson_, nullptr);
+    }
+    if (!boundNodes.empty()) {
+        page->FlushCommands();
+    }
+    return true;
+}
+
+void JsCardParser::AddNodeBinding(const std::unique_ptr<JsonValue>& rootJson, int32_t nodeId)
+{
+    // Keep the node without its children, so that it can be updated alone.
+    auto node = JsonUtil::Create(true);
+    auto child = rootJson->GetChild();
+    while (child && child->IsValid()) {
+        auto key = child->GetKey();
+        if (key != "children") {
+            node->Put(key.c_str(), child);
+        }
+        child = child->GetNext();
+    }
+    std::unordered_set<std::string> keys;
+    CollectBindingKeys(node->ToString(), keys);
+    // Parameters of event actions may be bound to data too.
+    auto eventList = node->GetValue("events");
+    if (eventList && eventList->IsValid()) {
+        auto event = eventList->GetChild();
+        while (event && event->IsValid()) {
+            auto actionJson = eventJson_->GetValue(event->GetString());
+            if (actionJson && actionJson->IsValid()) {
+                CollectBindingKeys(actionJson->ToString(), keys);
+            }
+            event = event->GetNext();
+        }
+    }
+    if (keys.empty()) {
+        return;
+    }
+    auto index = nodeBindings_.size();
+    for (const auto& key : keys) {
+        keyBindings_[key].emplace_back(index);
+    }
+    nodeBindings_.emplace_back(NodeBinding { nodeId, std::move(node) });
+}
+
+void JsCardParser::AddStructuralKeys(const std::unique_ptr<JsonValue>& rootJson)
+{
+    if (rootJson && rootJson->IsValid()) {
+        CollectBindingKeys(rootJson->IsString() ? rootJson->GetString() : rootJson->ToString(), structuralKeys_);
+    }
+}
+
 void JsCardParser::UpdateStyle(const RefPtr<JsAcePage>& page)
 {
     if (!page) {
@@ -1273,11 +1379,13 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
         return;
     }
     if (rootJson->Contains("repeat") && !isRepeat_) {
+        AddStructuralKeys(rootJson);
         CreateRepeatDomNode(page, rootJson, parentId);
         return;
     }
     auto type = rootJson->GetString("type");
     if (type == "block") {
+        AddStructuralKeys(rootJson->GetValue("shown"));
         CreateBlockNode(page, rootJson, parentId);
         return;
     }
@@ -1291,9 +1399,6 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
             ++listNodeIndex_;
         }
     }
-    bool shouldShow = true;
-    bool hasShownAttr = false;
-    GetShownAttr(rootJson, dataJson, propsJson, shouldShow, hasShownAttr);
     type = rootJson->GetValue("type")->GetString();
     if (rootBody_->Contains(type)) {
         // if rootBody contains this type, it must be a customer component.
@@ -1302,6 +1407,8 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
         auto customJsonData = customJson->GetValue("data");
         auto customJsonProps = customJson->GetValue("props");
         auto customJsonStyle = customJson->GetValue("styles");
+        AddStructuralKeys(rootJson);
+        AddStructuralKeys(customJsonTemplate);
         auto attrList = rootJson->GetValue("attr");
         if (!attrList || !attrList->IsValid()) {
             return;
@@ -1317,6 +1424,29 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
         UpdateDomNode(page, customJsonTemplate, parentId, idArray, customJsonData, customJsonStyle, customJsonProps);
         return;
     }
+    // Only nodes bound to data of card itself can be updated alone.
+    if (!isRepeat_ && !propsJson && &dataJson == &dataJson_) {
+        AddNodeBinding(rootJson, selfId);
+    }
+    UpdateNodeAttrsAndStyles(page, rootJson, selfId, dataJson, styleJson, propsJson);
+
+    auto childList = rootJson->GetValue("children");
+    if (childList && childList->IsValid()) {
+        auto child = childList->GetChild();
+        while (child && child->IsValid()) {
+            UpdateDomNode(page, child, selfId, idArray, dataJson, styleJson, propsJson);
+            child = child->GetNext();
+        }
+    }
+}
+
+void JsCardParser::UpdateNodeAttrsAndStyles(const RefPtr<Framework::JsAcePage>& page,
+    const std::unique_ptr<JsonValue>& rootJson, int32_t selfId, const std::unique_ptr<JsonValue>& dataJson,
+    const std::unique_ptr<JsonValue>& styleJson, const std::unique_ptr<JsonValue>& propsJson)
+{
+    bool shouldShow = true;
+    bool hasShownAttr = false;
+    GetShownAttr(rootJson, dataJson, propsJson, shouldShow, hasShownAttr);
     std::vector<std::pair<std::string, std::string>> attrs;
     std::vector<std::pair<std::string, std::string>> styles(customStyles_);
     customStyles_.clear();
@@ -1337,15 +1467,6 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
     styleCommand->SetStyles(std::move(styles));
     page->PushCommand(attrCommand);
     page->PushCommand(styleCommand);
-
-    auto childList = rootJson->GetValue("children");
-    if (childList && childList->IsValid()) {
-        auto child = childList->GetChild();
-        while (child && child->IsValid()) {
-            UpdateDomNode(page, child, selfId, idArray, dataJson, styleJson, propsJson);
-            child = child->GetNext();
-        }
-    }
 }
 
 void JsCardParser::ParseVariable(
@@ -1925,7 +2046,11 @@ void JsCardParser::ProcessRepeatNode(const RefPtr<Framework::JsAcePage>& page,
 void JsCardParser::SetUpdateStatus(const RefPtr<Framework::JsAcePage>& page)
 {
     parsingStatus_ = ParsingStatus::UPDATE;
+    nodeBindings_.clear();
+    keyBindings_.clear();
+    structuralKeys_.clear();
     UpdateDomNode(page, rootJson_, -1);
+    hasBindingIndex_ = true;
     nodeId_ = 0;
     numberOfForNode_ = 0;
     page->FlushCommands();
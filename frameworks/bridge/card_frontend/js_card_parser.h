@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_JS_CARD_PARSER_H
 
 #include <map>
+#include <unordered_set>
 #include <vector>
 
 #include "base/memory/referenced.h"
@@ -125,7 +126,19 @@ public:
         cardHapPath_ = path;
     }
 
+    // add for test case
+    size_t GetBoundNodeCount() const
+    {
+        return nodeBindings_.size();
+    }
+
 private:
+    // A plain node of template, whose attributes, styles and events are bound to data keys.
+    struct NodeBinding {
+        int32_t nodeId = 0;
+        std::unique_ptr<JsonValue> node;
+    };
+
     void GetResImageUrl(std::string& value);
     bool GetI18nData(std::string& value);
     void GetPlurals(std::string& value);
@@ -183,6 +196,12 @@ private:
     void ProcessRepeatNode(const RefPtr<Framework::JsAcePage>& page, const std::unique_ptr<JsonValue>& rootJson,
         const std::string& key, int32_t parentId, bool hasKeyValue, std::unique_ptr<JsonValue>& repeatValue);
     void SetUpdateStatus(const RefPtr<Framework::JsAcePage>& page);
+    void UpdateNodeAttrsAndStyles(const RefPtr<Framework::JsAcePage>& page, const std::unique_ptr<JsonValue>& rootJson,
+        int32_t selfId, const std::unique_ptr<JsonValue>& dataJson, const std::unique_ptr<JsonValue>& styleJson,
+        const std::unique_ptr<JsonValue>& propsJson);
+    void AddNodeBinding(const std::unique_ptr<JsonValue>& rootJson, int32_t nodeId);
+    void AddStructuralKeys(const std::unique_ptr<JsonValue>& rootJson);
+    bool UpdateBoundNodes(const std::unordered_set<std::string>& changedKeys, const RefPtr<Framework::JsAcePage>& page);
     void GetShownAttr(const std::unique_ptr<JsonValue>& rootJson, const std::unique_ptr<JsonValue>& dataJson,
         const std::unique_ptr<JsonValue>& propsJson, bool& shouldShow, bool& hasShownAttr);
     void CreateBlockNode(
@@ -221,6 +240,13 @@ private:
     std::vector<std::pair<std::string, std::string>> customStyles_;
     MediaQueryer mediaQueryer_;
 
+    // for partial update, built on each update of the whole template.
+    bool hasBindingIndex_ = false;
+    std::vector<NodeBinding> nodeBindings_;
+    std::unordered_map<std::string, std::vector<size_t>> keyBindings_;
+    // keys which repeat, block and custom component depend on, changing them updates the whole template.
+    std::unordered_set<std::string> structuralKeys_;
+
     // for repeat attr
     bool isRepeat_ = false;
     std::string repeatIndex_;
@@ -16,8 +16,10 @@
 #include "frameworks/bridge/common/accessibility/accessibility_node_manager.h"
 
 #include "base/geometry/dimension_offset.h"
+#include "base/log/ace_trace.h"
 #include "base/log/dump_log.h"
 #include "base/log/event_report.h"
+#include "base/utils/system_properties.h"
 #include "core/accessibility/js_inspector/inspect_badge.h"
 #include "core/accessibility/js_inspector/inspect_button.h"
 #include "core/accessibility/js_inspector/inspect_camera.h"
@@ -68,6 +70,8 @@
 #include "core/accessibility/js_inspector/inspect_toolbar.h"
 #include "core/accessibility/js_inspector/inspect_toolbar_item.h"
 #include "core/accessibility/js_inspector/inspect_video.h"
+#include "core/common/ace_application_info.h"
+#include "core/components/root/root_element.h"
 #include "core/components_v2/inspector/inspector_composed_element.h"
 
 namespace OHOS::Ace::Framework {
@@ -181,6 +185,22 @@ int32_t ConvertToNodeId(int32_t cardAccessibilityId)
     return result;
 }
 
+// Render nodes look up their accessibility nodes when mounted, bind the nodes created later again. Many render nodes
+// set the actions of their accessibility nodes when updated, so the elements bound to a new node are updated again.
+void BindAccessibilityNodes(const RefPtr<Element>& element)
+{
+    if (!element) {
+        return;
+    }
+    auto renderElement = AceType::DynamicCast<RenderElement>(element);
+    if (renderElement && renderElement->BindAccessibilityNode()) {
+        renderElement->Update();
+    }
+    for (const auto& child : element->GetChildren()) {
+        BindAccessibilityNodes(child);
+    }
+}
+
 } // namespace
 
 AccessibilityNodeManager::~AccessibilityNodeManager()
@@ -311,8 +331,10 @@ RefPtr<AccessibilityNode> AccessibilityNodeManager::GetAccessibilityNodeFromPage
     return GetAccessibilityNodeById(nodeId);
 }
 
-std::string AccessibilityNodeManager::GetInspectorNodeById(NodeId nodeId) const
+std::string AccessibilityNodeManager::GetInspectorNodeById(NodeId nodeId)
 {
+    // The inspector reads the accessibility nodes, they are needed from now on.
+    CreateDeferredAccessibilityNodes();
     auto node = GetAccessibilityNodeFromPage(nodeId);
     if (!node) {
         LOGE("AccessibilityNodeManager::GetInspectorNodeById, no node with id:%{public}d", nodeId);
@@ -391,9 +413,12 @@ RefPtr<AccessibilityNode> AccessibilityNodeManager::CreateAccessibilityNode(
 {
     if (IsDeclarative()) {
         return CreateDeclarativeAccessibilityNode(tag, nodeId, parentNodeId, itemIndex);
-    } else {
-        return CreateCommonAccessibilityNode(tag, nodeId, parentNodeId, itemIndex);
     }
+    // Nodes of pages and their children are mounted in the order of creation, create the deferred ones first.
+    if (!deferredNodes_.empty() && (parentNodeId == -1 || IsDeferredNode(parentNodeId))) {
+        CreateDeferredAccessibilityNodes();
+    }
+    return CreateCommonAccessibilityNode(tag, nodeId, parentNodeId, itemIndex, rootNodeId_);
 }
 
 RefPtr<AccessibilityNode> AccessibilityNodeManager::CreateDeclarativeAccessibilityNode(
@@ -443,7 +468,7 @@ RefPtr<AccessibilityNode> AccessibilityNodeManager::CreateDeclarativeAccessibili
 }
 
 RefPtr<AccessibilityNode> AccessibilityNodeManager::CreateCommonAccessibilityNode(
-    const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex)
+    const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex, int32_t rootNodeId)
 {
     LOGD("create AccessibilityNode %{public}s, id %{public}d, parent id %{public}d, itemIndex %{public}d", tag.c_str(),
         nodeId, parentNodeId, itemIndex);
@@ -457,7 +482,7 @@ RefPtr<AccessibilityNode> AccessibilityNodeManager::CreateCommonAccessibilityNod
         }
     } else {
         // create accessibility root stack node
-        auto rootStackId = rootNodeId_ + ROOT_STACK_BASE;
+        auto rootStackId = rootNodeId + ROOT_STACK_BASE;
         parentNode = GetAccessibilityNodeById(rootStackId);
         if (!parentNode) {
             parentNode = AceType::MakeRefPtr<AccessibilityNode>(rootStackId, ROOT_STACK_TAG);
@@ -472,8 +497,8 @@ RefPtr<AccessibilityNode> AccessibilityNodeManager::CreateCommonAccessibilityNod
     }
 
     auto accessibilityNode = AceType::MakeRefPtr<AccessibilityNode>(nodeId, tag);
-    accessibilityNode->SetIsRootNode(nodeId == rootNodeId_);
-    accessibilityNode->SetPageId(rootNodeId_ - DOM_ROOT_NODE_ID_BASE);
+    accessibilityNode->SetIsRootNode(nodeId == rootNodeId);
+    accessibilityNode->SetPageId(rootNodeId - DOM_ROOT_NODE_ID_BASE);
     accessibilityNode->SetParentNode(parentNode);
     accessibilityNode->Mount(itemIndex);
     {
@@ -523,6 +548,9 @@ void AccessibilityNodeManager::RemoveAccessibilityNodes(RefPtr<AccessibilityNode
 
 void AccessibilityNodeManager::RemoveAccessibilityNodeById(NodeId nodeId)
 {
+    if (RemoveDeferredAccessibilityNode(nodeId)) {
+        return;
+    }
     auto accessibilityNode = GetAccessibilityNodeById(nodeId);
     if (!accessibilityNode) {
         LOGW("the accessibility node %{public}d is not in the map", nodeId);
@@ -533,6 +561,15 @@ void AccessibilityNodeManager::RemoveAccessibilityNodeById(NodeId nodeId)
 
 void AccessibilityNodeManager::ClearPageAccessibilityNodes(int32_t pageId)
 {
+    std::vector<NodeId> deferredPageNodes;
+    for (const auto& [nodeId, deferredNode] : deferredNodes_) {
+        if (deferredNode.parentNodeId == -1 && deferredNode.rootNodeId == pageId) {
+            deferredPageNodes.emplace_back(nodeId);
+        }
+    }
+    for (auto nodeId : deferredPageNodes) {
+        RemoveDeferredAccessibilityNode(nodeId);
+    }
     auto rootNodeId = pageId + ROOT_STACK_BASE;
     auto accessibilityNode = GetAccessibilityNodeById(rootNodeId);
     if (!accessibilityNode) {
@@ -596,6 +633,9 @@ void AccessibilityNodeManager::TriggerVisibleChangeEvent()
 
 void AccessibilityNodeManager::AddVisibleChangeNode(NodeId nodeId, double ratio, VisibleRatioCallback callback)
 {
+    // Visible ratio is calculated with the rect of the accessibility node, lazy mode ends for good.
+    CreateDeferredAccessibilityNodes();
+    lazyModeEnded_ = true;
     VisibleCallbackInfo info;
     info.callback = callback;
     info.visibleRatio = ratio;
@@ -712,6 +752,146 @@ bool AccessibilityNodeManager::IsDeclarative()
     return context->GetIsDeclarative();
 }
 
+bool AccessibilityNodeManager::IsLazyMode() const
+{
+#if defined(WINDOWS_PLATFORM) || defined(MAC_PLATFORM)
+    // The previewer inspects the accessibility nodes.
+    return false;
+#else
+    return !lazyModeEnded_ && !AceApplicationInfo::GetInstance().IsAccessibilityEnabled() &&
+           !SystemProperties::GetAccessibilityEnabled();
+#endif
+}
+
+bool AccessibilityNodeManager::DeferAccessibilityNode(const std::string& tag, int32_t nodeId, int32_t parentNodeId,
+    int32_t itemIndex, int32_t pageId, const std::vector<std::string>& events)
+{
+    if (!IsLazyMode()) {
+        return false;
+    }
+    // Children of nodes created by components, such as options, are created with their parents.
+    if (parentNodeId != -1 && !IsDeferredNode(parentNodeId)) {
+        return false;
+    }
+    DeferredNode deferredNode;
+    deferredNode.tag = tag;
+    deferredNode.parentNodeId = parentNodeId;
+    deferredNode.itemIndex = itemIndex;
+    deferredNode.rootNodeId = rootNodeId_;
+    deferredNode.pageId = pageId;
+    deferredNode.sequence = deferredSequence_++;
+    deferredNode.events = events;
+    auto result = deferredNodes_.try_emplace(nodeId, std::move(deferredNode));
+    if (!result.second) {
+        LOGW("the deferred accessibility node %{public}d is already recorded", nodeId);
+        return false;
+    }
+    deferredNodeOrder_.emplace(result.first->second.sequence, nodeId);
+    if (parentNodeId != -1) {
+        deferredNodes_[parentNodeId].children.emplace_back(nodeId);
+    }
+    return true;
+}
+
+bool AccessibilityNodeManager::UpdateDeferredAccessibilityNode(NodeId nodeId, const std::string& id,
+    const std::string& target, const std::vector<std::pair<std::string, std::string>>& attrs)
+{
+    auto iter = deferredNodes_.find(nodeId);
+    if (iter == deferredNodes_.end()) {
+        return false;
+    }
+    auto& deferredNode = iter->second;
+    if (!id.empty()) {
+        deferredNode.id = id;
+    }
+    if (!target.empty()) {
+        deferredNode.target = target;
+    }
+    // Only the last value of an attribute takes effect, so nodes updated many times are kept in a bound.
+    for (const auto& attr : attrs) {
+        auto result = deferredNode.attrIndexes.try_emplace(attr.first, deferredNode.attrs.size());
+        if (result.second) {
+            deferredNode.attrs.emplace_back(attr);
+        } else {
+            deferredNode.attrs[result.first->second].second = attr.second;
+        }
+    }
+    return true;
+}
+
+bool AccessibilityNodeManager::RemoveDeferredAccessibilityNode(NodeId nodeId)
+{
+    auto iter = deferredNodes_.find(nodeId);
+    if (iter == deferredNodes_.end()) {
+        return false;
+    }
+    auto parentIter = deferredNodes_.find(iter->second.parentNodeId);
+    if (parentIter != deferredNodes_.end()) {
+        auto& children = parentIter->second.children;
+        children.erase(std::remove(children.begin(), children.end(), nodeId), children.end());
+    }
+    RemoveDeferredNodeRecursively(nodeId);
+    return true;
+}
+
+void AccessibilityNodeManager::RemoveDeferredNodeRecursively(NodeId nodeId)
+{
+    auto iter = deferredNodes_.find(nodeId);
+    if (iter == deferredNodes_.end()) {
+        return;
+    }
+    auto children = std::move(iter->second.children);
+    deferredNodeOrder_.erase(iter->second.sequence);
+    deferredNodes_.erase(iter);
+    RemoveVisibleChangeNode(nodeId);
+    for (auto child : children) {
+        RemoveDeferredNodeRecursively(child);
+    }
+}
+
+void AccessibilityNodeManager::CreateDeferredAccessibilityNodes()
+{
+    if (deferredNodes_.empty()) {
+        return;
+    }
+    ACE_SCOPED_TRACE("CreateDeferredAccessibilityNodes %zu", deferredNodes_.size());
+    LOGI("create %{public}zu deferred accessibility nodes", deferredNodes_.size());
+    lazyModeEnded_ = true;
+    auto deferredNodes = std::move(deferredNodes_);
+    auto deferredNodeOrder = std::move(deferredNodeOrder_);
+    deferredNodes_.clear();
+    deferredNodeOrder_.clear();
+    for (const auto& [sequence, nodeId] : deferredNodeOrder) {
+        const auto& deferredNode = deferredNodes[nodeId];
+        auto accessibilityNode = CreateCommonAccessibilityNode(deferredNode.tag, nodeId, deferredNode.parentNodeId,
+            deferredNode.itemIndex, deferredNode.rootNodeId);
+        if (!accessibilityNode) {
+            continue;
+        }
+        if (!deferredNode.id.empty()) {
+            AddNodeWithId(deferredNode.id, accessibilityNode);
+        }
+        if (!deferredNode.target.empty()) {
+            AddNodeWithTarget(deferredNode.target, accessibilityNode);
+        }
+        accessibilityNode->SetAttr(deferredNode.attrs);
+        accessibilityNode->AddEvent(deferredNode.pageId, deferredNode.events);
+    }
+    HandleComponentPostBinding();
+
+    auto context = context_.Upgrade();
+    if (!context || !context->GetRootElement()) {
+        return;
+    }
+    BindAccessibilityNodes(context->GetRootElement());
+    // Rects of the accessibility nodes are updated when painted.
+    auto rootRender = context->GetRootElement()->GetRenderNode();
+    if (rootRender) {
+        rootRender->SetNeedUpdateAccessibility(true);
+        RenderNode::MarkWholeRender(rootRender, true);
+    }
+}
+
 bool AccessibilityNodeManager::GetDefaultAttrsByType(
     const std::string& type, std::unique_ptr<JsonValue>& jsonDefaultAttrs)
 {
@@ -738,6 +918,8 @@ void AccessibilityNodeManager::DumpTree(int32_t depth, NodeId nodeID)
         return;
     }
 
+    // Dumping the tree ends lazy mode for good.
+    CreateDeferredAccessibilityNodes();
     auto node = GetAccessibilityNodeFromPage(nodeID);
     if (!node) {
         DumpLog::GetInstance().Print("Error: failed to get accessibility node with ID " + std::to_string(nodeID));
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_COMMON_ACCESSIBILITY_ACCESSIBILITY_NODE_MANAGER_H
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_COMMON_ACCESSIBILITY_ACCESSIBILITY_NODE_MANAGER_H
 
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -99,7 +100,7 @@ public:
     RefPtr<AccessibilityNode> CreateAccessibilityNode(
         const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex) override;
     RefPtr<AccessibilityNode> GetAccessibilityNodeById(NodeId nodeId) const override;
-    std::string GetInspectorNodeById(NodeId nodeId) const override;
+    std::string GetInspectorNodeById(NodeId nodeId) override;
     void RemoveAccessibilityNodes(RefPtr<AccessibilityNode>& node) override;
     void RemoveAccessibilityNodeById(NodeId nodeId) override;
     void ClearPageAccessibilityNodes(int32_t pageId) override;
@@ -126,6 +127,24 @@ public:
 
     bool IsDeclarative();
 
+    // In lazy mode, the accessibility nodes of dom nodes are not created until an accessibility client is enabled or
+    // the nodes are needed. The dom nodes are recorded instead, and replayed in the order of creation. Lazy mode ends
+    // for the rest of the life of the manager once the nodes are created, including by DumpTree,
+    // GetInspectorNodeById and AddVisibleChangeNode, since nodes removed later can't be told from those still needed.
+    bool IsLazyMode() const;
+    // Returns false if the node is not deferred, then it should be created.
+    bool DeferAccessibilityNode(const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex,
+        int32_t pageId, const std::vector<std::string>& events);
+    bool UpdateDeferredAccessibilityNode(NodeId nodeId, const std::string& id, const std::string& target,
+        const std::vector<std::pair<std::string, std::string>>& attrs);
+    bool RemoveDeferredAccessibilityNode(NodeId nodeId);
+    void CreateDeferredAccessibilityNodes();
+
+    size_t GetDeferredNodeCount() const
+    {
+        return deferredNodes_.size();
+    }
+
 protected:
     static bool GetDefaultAttrsByType(const std::string& type, std::unique_ptr<JsonValue>& jsonDefaultAttrs);
     mutable std::mutex mutex_;
@@ -142,10 +161,38 @@ protected:
     bool isOhosHostCard_ = false;
 
 private:
+    struct DeferredNode {
+        std::string tag;
+        int32_t parentNodeId = -1;
+        int32_t itemIndex = -1;
+        int32_t rootNodeId = -1;
+        int32_t pageId = 0;
+        uint64_t sequence = 0;
+        std::string id;
+        std::string target;
+        // The last value of each attribute, in the order attributes are first set.
+        std::vector<std::pair<std::string, std::string>> attrs;
+        std::unordered_map<std::string, size_t> attrIndexes;
+        std::vector<std::string> events;
+        std::vector<NodeId> children;
+    };
+
     RefPtr<AccessibilityNode> CreateCommonAccessibilityNode(
-        const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex);
+        const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex, int32_t rootNodeId);
+    bool IsDeferredNode(NodeId nodeId) const
+    {
+        return deferredNodes_.find(nodeId) != deferredNodes_.end();
+    }
+    void RemoveDeferredNodeRecursively(NodeId nodeId);
     RefPtr<AccessibilityNode> CreateDeclarativeAccessibilityNode(
         const std::string& tag, int32_t nodeId, int32_t parentNodeId, int32_t itemIndex);
+
+    // Used on the UI thread only, like the dom nodes.
+    std::unordered_map<NodeId, DeferredNode> deferredNodes_;
+    std::map<uint64_t, NodeId> deferredNodeOrder_;
+    uint64_t deferredSequence_ = 0;
+    // Lazy mode ends once the deferred nodes are created, the nodes are kept in sync from then on.
+    bool lazyModeEnded_ = false;
 };
 
 } // namespace OHOS::Ace::Framework
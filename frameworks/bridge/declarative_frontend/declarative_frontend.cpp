@@ -467,6 +467,9 @@ void DeclarativeFrontend::InitializeFrontendDelegate(const RefPtr<TaskExecutor>&
     }
     if (jsEngine_) {
         delegate_->SetGroupJsBridge(jsEngine_->GetGroupJsBridge());
+        if (jsEngine_->IsDebugVersion()) {
+            delegate_->DisallowPreloadPages();
+        }
     } else {
         LOGE("the js engine is nullptr");
         EventReport::SendAppStartException(AppStartExcepType::JS_ENGINE_CREATE_ERR);
@@ -766,4 +766,14 @@ var MessageLevel
   MessageLevel[MessageLevel["Warn"] = 3] = "Warn";
   MessageLevel[MessageLevel["Error"] = 4] = "Error";
   MessageLevel[MessageLevel["Log"] = 5] = "Log";
-})(MessageLevel || (MessageLevel = {}));
\ No newline at end of file
+})(MessageLevel || (MessageLevel = {}));
+
+var BatchedAttribute;
+(function (BatchedAttribute) {
+  BatchedAttribute[BatchedAttribute["Width"] = 0] = "Width";
+  BatchedAttribute[BatchedAttribute["Height"] = 1] = "Height";
+  BatchedAttribute[BatchedAttribute["BackgroundColor"] = 2] = "BackgroundColor";
+  BatchedAttribute[BatchedAttribute["Opacity"] = 3] = "Opacity";
+  BatchedAttribute[BatchedAttribute["Padding"] = 4] = "Padding";
+  BatchedAttribute[BatchedAttribute["Margin"] = 5] = "Margin";
+})(BatchedAttribute || (BatchedAttribute = {}));
@@ -831,9 +831,12 @@ void JsiDeclarativeEngine::LoadJs(const std::string& url, const RefPtr<JsAcePage
     auto runtime = engineInstance_->GetJsRuntime();
     auto delegate = engineInstance_->GetDelegate();
 
-    // get source map
+    // the bundle of page may have been read ahead on background thread
+    std::vector<uint8_t> preloadedBin;
     std::string jsSourceMap;
-    if (delegate->GetAssetContent(url + ".map", jsSourceMap)) {
+    bool isPreloaded = !isMainPage && delegate->TakePreloadedPage(url, preloadedBin, jsSourceMap);
+    // get source map
+    if (isPreloaded || delegate->GetAssetContent(url + ".map", jsSourceMap)) {
         page->SetPageMap(jsSourceMap);
     } else {
         LOGW("js source map load failed!");
@@ -882,7 +885,10 @@ void JsiDeclarativeEngine::LoadJs(const std::string& url, const RefPtr<JsAcePage
                 LOGW("ExecuteJsBin \"app.js\" failed.");
             }
         }
-        if (!runtime->ExecuteJsBin(assetPath)) {
+        bool result = isPreloaded
+                          ? runtime->EvaluateJsCode(preloadedBin.data(), static_cast<int32_t>(preloadedBin.size()))
+                          : runtime->ExecuteJsBin(assetPath);
+        if (!result) {
             LOGE("ExecuteJsBin %{public}s failed.", urlName.c_str());
             return;
         }
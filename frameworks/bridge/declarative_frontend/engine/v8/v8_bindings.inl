@@ -86,6 +86,8 @@ void V8Class<C>::Declare(const char* name)
     constructor_ = nullptr;
     v8::Isolate* isolate = V8DeclarativeEngineInstance::GetV8Isolate();
     v8::Local<v8::FunctionTemplate> funcTemplate = v8::FunctionTemplate::New(isolate);
+    // Name the class function as the class, as the other engines do.
+    funcTemplate->SetClassName(v8::String::NewFromUtf8(isolate, name).ToLocalChecked());
     funcTemplate->InstanceTemplate()->SetInternalFieldCount(1);
     auto destroyCallback = [](v8::Isolate* isolate) {
         std::lock_guard<std::mutex> lock(mutex_);
@@ -15,6 +15,7 @@
 
 #include "frameworks/bridge/declarative_frontend/frontend_delegate_declarative.h"
 
+#include <algorithm>
 #include <atomic>
 #include <regex>
 #include <string>
@@ -49,6 +50,7 @@ constexpr int32_t CALLBACK_ERRORCODE_SUCCESS = 0;
 constexpr int32_t CALLBACK_ERRORCODE_CANCEL = 1;
 constexpr int32_t CALLBACK_ERRORCODE_COMPLETE = 2;
 constexpr int32_t CALLBACK_DATACODE_ZERO = 0;
+constexpr size_t MAX_PRELOAD_PAGES = 2;
 
 const char MANIFEST_JSON[] = "manifest.json";
 const char PAGES_JSON[] = "main_pages.json";
@@ -57,6 +59,9 @@ const char I18N_FOLDER[] = "i18n/";
 const char RESOURCES_FOLDER[] = "resources/";
 const char STYLES_FOLDER[] = "styles/";
 const char I18N_FILE_SUFFIX[] = "/properties/string.json";
+const char JS_EXT[] = ".js";
+const char BIN_EXT[] = ".abc";
+const char MAP_EXT[] = ".map";
 
 } // namespace
 
@@ -1470,6 +1475,94 @@ void FrontendDelegateDeclarative::OnPushPageSuccess(
     }
     LOGI("OnPushPageSuccess size=%{private}zu,pageId=%{private}d,url=%{private}s", pageRouteStack_.size(),
         pageRouteStack_.back().pageId, pageRouteStack_.back().url.c_str());
+    UpdatePreloadCandidates(url);
+}
+
+void FrontendDelegateDeclarative::UpdatePreloadCandidates(const std::string& url)
+{
+    if (!isPreloadAllowed_ || !manifestParser_ || !manifestParser_->GetRouter()) {
+        return;
+    }
+    // Pages following the current one in manifest are the likely targets of next push.
+    std::list<std::string> candidates;
+    const auto& router = manifestParser_->GetRouter();
+    bool found = false;
+    for (const auto& uri : router->GetPageList()) {
+        if (candidates.size() >= MAX_PRELOAD_PAGES) {
+            break;
+        }
+        auto pagePath = router->GetPagePath(uri);
+        if (!found) {
+            found = pagePath == url;
+            continue;
+        }
+        auto iter = std::find_if(pageRouteStack_.begin(), pageRouteStack_.end(),
+            [&pagePath](const PageInfo& pageInfo) { return pageInfo.url == pagePath; });
+        if (iter == pageRouteStack_.end()) {
+            candidates.emplace_back(pagePath);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(preloadMutex_);
+    for (auto iter = preloadedPages_.begin(); iter != preloadedPages_.end();) {
+        if (std::find(candidates.begin(), candidates.end(), iter->first) == candidates.end()) {
+            iter = preloadedPages_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    candidates.remove_if([this](const std::string& pagePath) { return preloadedPages_.count(pagePath) > 0; });
+    preloadCandidates_ = std::move(candidates);
+}
+
+void FrontendDelegateDeclarative::PreloadPages()
+{
+    std::string url;
+    {
+        std::lock_guard<std::mutex> lock(preloadMutex_);
+        if (isPreloading_ || preloadCandidates_.empty()) {
+            return;
+        }
+        url = preloadCandidates_.front();
+        preloadCandidates_.pop_front();
+        isPreloading_ = true;
+    }
+    // Only read the bundle one page at a time, the page is evaluated when it is pushed.
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [weak = AceType::WeakClaim(this), url] {
+            auto delegate = weak.Upgrade();
+            if (!delegate) {
+                return;
+            }
+            PreloadedPage preloadedPage;
+            auto pos = url.rfind(JS_EXT);
+            bool loaded = pos != std::string::npos && pos == url.length() - (sizeof(JS_EXT) - 1) &&
+                          delegate->GetAssetContent(url.substr(0, pos) + BIN_EXT, preloadedPage.bin);
+            if (loaded) {
+                delegate->GetAssetContent(url + MAP_EXT, preloadedPage.sourceMap);
+            }
+            std::lock_guard<std::mutex> lock(delegate->preloadMutex_);
+            delegate->isPreloading_ = false;
+            if (loaded) {
+                LOGD("page %{private}s is preloaded", url.c_str());
+                delegate->preloadedPages_[url] = std::move(preloadedPage);
+            }
+        },
+        BgTaskPriority::LOW);
+}
+
+bool FrontendDelegateDeclarative::TakePreloadedPage(
+    const std::string& url, std::vector<uint8_t>& bin, std::string& sourceMap)
+{
+    std::lock_guard<std::mutex> lock(preloadMutex_);
+    auto iter = preloadedPages_.find(url);
+    if (iter == preloadedPages_.end()) {
+        return false;
+    }
+    bin = std::move(iter->second.bin);
+    sourceMap = std::move(iter->second.sourceMap);
+    preloadedPages_.erase(iter);
+    return true;
 }
 
 void FrontendDelegateDeclarative::OnPopToPageSuccess(const std::string& url)
@@ -1972,6 +2065,12 @@ void FrontendDelegateDeclarative::AttachPipelineContext(const RefPtr<PipelineCon
             delegate->FlushAnimationTasks();
         }
     });
+    context->SetIdleCallback([weak = AceType::WeakClaim(this)](int64_t /* deadline */) {
+        auto delegate = weak.Upgrade();
+        if (delegate) {
+            delegate->PreloadPages();
+        }
+    });
     pipelineContextHolder_.Attach(context);
     jsAccessibilityManager_->SetPipelineContext(context);
     jsAccessibilityManager_->InitializeCallback();
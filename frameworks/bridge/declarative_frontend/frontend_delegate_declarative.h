@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_DECLARATIVE_FRONTEND_FRONTEND_DELEGATE_DECLARATIVE_H
 
 #include <future>
+#include <list>
 #include <mutex>
 #include <unordered_map>
 
@@ -181,6 +182,7 @@ public:
     bool GetAssetContent(const std::string& url, std::string& content) override;
     bool GetAssetContent(const std::string& url, std::vector<uint8_t>& content) override;
     std::string GetAssetPath(const std::string& url) override;
+    bool TakePreloadedPage(const std::string& url, std::vector<uint8_t>& bin, std::string& sourceMap) override;
 
     // i18n
     void GetI18nData(std::unique_ptr<JsonValue>& json) override;
@@ -234,6 +236,12 @@ public:
         groupJsBridge_ = groupJsBridge;
     }
 
+    // Preloaded bundles are run from memory without their file names, so they are not preloaded when debugging.
+    void DisallowPreloadPages()
+    {
+        isPreloadAllowed_ = false;
+    }
+
     RefPtr<JsAcePage> GetPage(int32_t pageId) const override;
 
     void RebuildAllPages();
@@ -252,6 +260,8 @@ private:
     void SetCurrentPage(int32_t pageId);
 
     void OnPushPageSuccess(const RefPtr<JsAcePage>& page, const std::string& url);
+    void UpdatePreloadCandidates(const std::string& url);
+    void PreloadPages();
     void OnPopToPageSuccess(const std::string& url);
     void PopToPage(const std::string& url);
     int32_t OnPopPageSuccess();
@@ -301,6 +311,16 @@ private:
     std::string backUri_;
     std::string backParam_;
     std::vector<PageInfo> pageRouteStack_;
+    // Bundles of pages likely to be pushed next, read on background thread when ui thread is idle.
+    struct PreloadedPage {
+        std::vector<uint8_t> bin;
+        std::string sourceMap;
+    };
+    std::list<std::string> preloadCandidates_;
+    std::unordered_map<std::string, PreloadedPage> preloadedPages_;
+    bool isPreloading_ = false;
+    bool isPreloadAllowed_ = true;
+    std::mutex preloadMutex_;
     std::unordered_map<int32_t, RefPtr<JsAcePage>> pageMap_;
     std::unordered_map<int32_t, std::string> pageParamMap_;
     std::unordered_map<int32_t, std::string> jsCallBackResult_;
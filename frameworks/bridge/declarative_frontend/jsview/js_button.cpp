@@ -190,6 +190,9 @@ void JSButton::JSBind(BindingTarget globalObj)
 
     JSClass<JSButton>::StaticMethod("createWithLabel", &JSButton::CreateWithLabel, MethodOptions::NONE);
     JSClass<JSButton>::StaticMethod("createWithChild", &JSButton::CreateWithChild, MethodOptions::NONE);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSButton>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT,
+            BatchedAttribute::BACKGROUND_COLOR, BatchedAttribute::PADDING });
     JSClass<JSButton>::Inherit<JSContainerBase>();
     JSClass<JSButton>::Inherit<JSViewAbstract>();
     JSClass<JSButton>::Bind<>(globalObj);
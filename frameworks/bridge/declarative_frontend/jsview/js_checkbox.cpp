@@ -73,6 +73,8 @@ void JSCheckbox::JSBind(BindingTarget globalObj)
     JSClass<JSCheckbox>::StaticMethod("onDeleteEvent", &JSInteractableView::JsOnDelete);
     JSClass<JSCheckbox>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSCheckbox>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSCheckbox>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT, BatchedAttribute::PADDING });
     JSClass<JSCheckbox>::Inherit<JSViewAbstract>();
     JSClass<JSCheckbox>::Bind<>(globalObj);
 }
@@ -57,6 +57,8 @@ void JSCheckboxGroup::JSBind(BindingTarget globalObj)
     JSClass<JSCheckboxGroup>::StaticMethod("onDeleteEvent", &JSInteractableView::JsOnDelete);
     JSClass<JSCheckboxGroup>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSCheckboxGroup>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSCheckboxGroup>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT, BatchedAttribute::PADDING });
     JSClass<JSCheckboxGroup>::Inherit<JSViewAbstract>();
     JSClass<JSCheckboxGroup>::Bind<>(globalObj);
 }
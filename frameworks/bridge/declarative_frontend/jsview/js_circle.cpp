@@ -83,6 +83,8 @@ void JSCircle::JSBind(BindingTarget globalObj)
     JSClass<JSCircle>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
     JSClass<JSCircle>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSCircle>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSCircle>::Inherit<JSShapeAbstract>();
     JSClass<JSCircle>::Bind(globalObj, JSCircle::ConstructorCallback, JSCircle::DestructorCallback);
 }
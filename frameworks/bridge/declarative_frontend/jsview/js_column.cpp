@@ -119,6 +119,8 @@ void JSColumn::JSBind(BindingTarget globalObj)
     JSClass<JSColumn>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
     JSClass<JSColumn>::StaticMethod("onPan", &JSInteractableView::JsOnPan);
     JSClass<JSColumn>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSColumn>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSColumn>::Inherit<JSContainerBase>();
     JSClass<JSColumn>::Inherit<JSViewAbstract>();
     JSClass<JSColumn>::Bind<>(globalObj);
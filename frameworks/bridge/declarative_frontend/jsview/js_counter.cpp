@@ -45,6 +45,8 @@ void JSCounter::JSBind(BindingTarget globalObj)
     JSClass<JSCounter>::StaticMethod("controlWidth", &JSCounter::JSControlwidth);
     JSClass<JSCounter>::StaticMethod("state", &JSCounter::JSStateChange);
     JSClass<JSCounter>::StaticMethod("backgroundColor", &JSCounter::JsBackgroundColor);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSCounter>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT, BatchedAttribute::BACKGROUND_COLOR });
     JSClass<JSCounter>::Inherit<JSContainerBase>();
     JSClass<JSCounter>::Bind(globalObj);
 }
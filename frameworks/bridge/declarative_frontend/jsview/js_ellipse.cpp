@@ -83,6 +83,8 @@ void JSEllipse::JSBind(BindingTarget globalObj)
     JSClass<JSEllipse>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
     JSClass<JSEllipse>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSEllipse>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSEllipse>::Inherit<JSShapeAbstract>();
     JSClass<JSEllipse>::Bind(globalObj, JSEllipse::ConstructorCallback, JSEllipse::DestructorCallback);
 }
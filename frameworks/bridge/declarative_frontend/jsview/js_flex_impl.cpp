@@ -264,6 +264,8 @@ void JSFlexImpl::JSBind(BindingTarget globalObj)
     JSClass<JSFlexImpl>::StaticMethod("onPan", &JSInteractableView::JsOnPan);
     JSClass<JSFlexImpl>::StaticMethod("onKeyEvent", &JSInteractableView::JsOnKey);
     JSClass<JSFlexImpl>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSFlexImpl>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSFlexImpl>::Inherit<JSContainerBase>();
     JSClass<JSFlexImpl>::Inherit<JSViewAbstract>();
     JSClass<JSFlexImpl>::Bind<>(globalObj);
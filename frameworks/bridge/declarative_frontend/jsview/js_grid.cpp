@@ -192,6 +192,7 @@ void JSGrid::JSBind(BindingTarget globalObj)
     JSClass<JSGrid>::StaticMethod("height", &JSGrid::JsGridHeight);
     JSClass<JSGrid>::StaticMethod("onItemDrop", &JSGrid::JsOnGridDrop);
     JSClass<JSGrid>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSGrid>::JSName(), { BatchedAttribute::HEIGHT });
     JSClass<JSGrid>::Inherit<JSContainerBase>();
     JSClass<JSGrid>::Inherit<JSViewAbstract>();
     JSClass<JSGrid>::Bind<>(globalObj);
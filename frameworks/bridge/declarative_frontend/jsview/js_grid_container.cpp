@@ -81,6 +81,8 @@ void JSGridContainer::JSBind(BindingTarget globalObj)
     JSClass<JSGridContainer>::Declare("GridContainer");
     JSClass<JSGridContainer>::StaticMethod("create", &JSGridContainer::Create, MethodOptions::NONE);
     JSClass<JSGridContainer>::StaticMethod("pop", &JSGridContainer::Pop, MethodOptions::NONE);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSGridContainer>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSGridContainer>::Inherit<JSColumn>();
     JSClass<JSGridContainer>::Bind<>(globalObj);
 }
@@ -423,6 +423,7 @@ void JSImage::JSBind(BindingTarget globalObj)
     JSClass<JSImage>::StaticMethod("onFinish", &JSImage::OnFinish);
     JSClass<JSImage>::StaticMethod("syncLoad", &JSImage::SetSyncLoad);
     JSClass<JSImage>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSImage>::JSName(), { BatchedAttribute::OPACITY });
     JSClass<JSImage>::Inherit<JSViewAbstract>();
     // override method
     JSClass<JSImage>::StaticMethod("opacity", &JSImage::JsOpacity);
@@ -33,6 +33,8 @@ void JSLine::JSBind(BindingTarget globalObj)
     JSClass<JSLine>::StaticMethod("startPoint", &JSLine::SetStart);
     JSClass<JSLine>::StaticMethod("endPoint", &JSLine::SetEnd);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSLine>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSLine>::Inherit<JSShapeAbstract>();
     JSClass<JSLine>::Bind<>(globalObj);
 }
@@ -155,6 +155,8 @@ void JSList::JSBind(BindingTarget globalObj)
     JSClass<JSList>::StaticMethod("onItemDrop", &JSList::ItemDropCallback);
     JSClass<JSList>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSList>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSList>::Inherit<JSContainerBase>();
     JSClass<JSList>::Inherit<JSViewAbstract>();
     JSClass<JSList>::Bind(globalObj);
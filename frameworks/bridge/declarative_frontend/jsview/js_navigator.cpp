@@ -70,6 +70,8 @@ void JSNavigator::JSBind(BindingTarget globalObj)
     JSClass<JSNavigator>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSNavigator>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
     JSClass<JSNavigator>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSNavigator>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSNavigator>::Inherit<JSContainerBase>();
     JSClass<JSNavigator>::Inherit<JSViewAbstract>();
     JSClass<JSNavigator>::Bind<>(globalObj);
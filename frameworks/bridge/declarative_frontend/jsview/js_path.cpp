@@ -95,6 +95,8 @@ void JSPath::JSBind(BindingTarget globalObj)
     JSClass<JSPath>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
     JSClass<JSPath>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSPath>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSPath>::Inherit<JSShapeAbstract>();
     JSClass<JSPath>::Bind(globalObj, JSPath::ConstructorCallback, JSPath::DestructorCallback);
 }
@@ -38,6 +38,8 @@ void JSPolygon::JSBind(BindingTarget globalObj)
     JSClass<JSPolygon>::StaticMethod("height", &JSShapeAbstract::JsHeight);
     JSClass<JSPolygon>::StaticMethod("points", &JSPolygon::JsPoints);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSPolygon>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSPolygon>::Inherit<JSShapeAbstract>();
     JSClass<JSPolygon>::Bind(globalObj);
 }
@@ -38,6 +38,8 @@ void JSPolyline::JSBind(BindingTarget globalObj)
     JSClass<JSPolyline>::StaticMethod("width", &JSShapeAbstract::JsWidth);
     JSClass<JSPolyline>::StaticMethod("height", &JSShapeAbstract::JsHeight);
     JSClass<JSPolyline>::StaticMethod("points", &JSPolyline::JSPoints);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSPolyline>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSPolyline>::Inherit<JSShapeAbstract>();
     JSClass<JSPolyline>::Bind<>(globalObj);
 }
@@ -106,6 +106,7 @@ void JSProgress::JSBind(BindingTarget globalObj)
     JSClass<JSProgress>::StaticMethod("onDeleteEvent", &JSInteractableView::JsOnDelete);
     JSClass<JSProgress>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSProgress>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSProgress>::JSName(), { BatchedAttribute::BACKGROUND_COLOR });
     JSClass<JSProgress>::Inherit<JSViewAbstract>();
     JSClass<JSProgress>::Bind(globalObj);
 }
@@ -80,6 +80,7 @@ void JSQRCode::JSBind(BindingTarget globalObj)
     JSClass<JSQRCode>::StaticMethod("onTouch", &JSInteractableView::JsOnTouch);
     JSClass<JSQRCode>::StaticMethod("onHover", &JSInteractableView::JsOnHover);
     JSClass<JSQRCode>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSQRCode>::JSName(), { BatchedAttribute::BACKGROUND_COLOR });
     JSClass<JSQRCode>::Inherit<JSContainerBase>();
     JSClass<JSQRCode>::Inherit<JSViewAbstract>();
     JSClass<JSQRCode>::Bind<>(globalObj);
@@ -65,6 +65,8 @@ void JSRadio::JSBind(BindingTarget globalObj)
     JSClass<JSRadio>::StaticMethod("onDeleteEvent", &JSInteractableView::JsOnDelete);
     JSClass<JSRadio>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSRadio>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSRadio>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT, BatchedAttribute::PADDING });
     JSClass<JSRadio>::Inherit<JSViewAbstract>();
     JSClass<JSRadio>::Bind<>(globalObj);
 }
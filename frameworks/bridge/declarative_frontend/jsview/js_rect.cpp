@@ -312,6 +312,8 @@ void JSRect::JSBind(BindingTarget globalObj)
     JSClass<JSRect>::StaticMethod("onDeleteEvent", &JSInteractableView::JsOnDelete);
     JSClass<JSRect>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSRect>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSRect>::Inherit<JSShapeAbstract>();
     JSClass<JSRect>::Bind(globalObj, JSRect::ConstructorCallback, JSRect::DestructorCallback);
 }
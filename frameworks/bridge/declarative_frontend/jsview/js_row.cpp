@@ -104,6 +104,8 @@ void JSRow::JSBind(BindingTarget globalObj)
     JSClass<JSRow>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSRow>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
     JSClass<JSRow>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSRow>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSRow>::Inherit<JSContainerBase>();
     JSClass<JSRow>::Inherit<JSViewAbstract>();
     JSClass<JSRow>::Bind<>(globalObj);
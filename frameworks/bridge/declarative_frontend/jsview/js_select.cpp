@@ -110,6 +110,8 @@ void JSSelect::JSBind(BindingTarget globalObj)
     JSClass<JSSelect>::StaticMethod("onDeleteEvent", &JSInteractableView::JsOnDelete);
     JSClass<JSSelect>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSSelect>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSSelect>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT, BatchedAttribute::PADDING });
     JSClass<JSSelect>::Inherit<JSViewAbstract>();
     JSClass<JSSelect>::Bind(globalObj);
 }
@@ -445,6 +445,8 @@ void JSShape::JSBind(BindingTarget globalObj)
     JSClass<JSShape>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSShape>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
     JSClass<JSShape>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSShape>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSShape>::Inherit<JSContainerBase>();
     JSClass<JSShape>::Inherit<JSViewAbstract>();
     JSClass<JSShape>::Bind<>(globalObj);
@@ -87,6 +87,8 @@ void JSSideBar::JSBind(BindingTarget globalObj)
     JSClass<JSSideBar>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
     JSClass<JSSideBar>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSSideBar>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSSideBar>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSSideBar>::Inherit<JSContainerBase>();
     JSClass<JSSideBar>::Inherit<JSViewAbstract>();
     JSClass<JSSideBar>::Bind(globalObj);
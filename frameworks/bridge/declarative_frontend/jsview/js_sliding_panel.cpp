@@ -85,6 +85,7 @@ void JSSlidingPanel::JSBind(BindingTarget globalObj)
     JSClass<JSSlidingPanel>::StaticMethod("onClick", &JSInteractableView::JsOnClick);
     JSClass<JSSlidingPanel>::StaticMethod("onChange", &JSSlidingPanel::SetOnSizeChange);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSSlidingPanel>::JSName(), { BatchedAttribute::BACKGROUND_COLOR });
     JSClass<JSSlidingPanel>::Inherit<JSContainerBase>();
     JSClass<JSSlidingPanel>::Inherit<JSViewAbstract>();
     JSClass<JSSlidingPanel>::Bind<>(globalObj);
@@ -177,6 +177,8 @@ void JSStack::JSBind(BindingTarget globalObj)
     JSClass<JSStack>::StaticMethod("onAppear", &JSInteractableView::JsOnAppear);
     JSClass<JSStack>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
     JSClass<JSStack>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSStack>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSStack>::Inherit<JSContainerBase>();
     JSClass<JSStack>::Inherit<JSViewAbstract>();
     JSClass<JSStack>::Bind<>(globalObj);
@@ -101,6 +101,8 @@ void JSSwiper::JSBind(BindingTarget globalObj)
     JSClass<JSSwiper>::StaticMethod("height", &JSSwiper::SetHeight);
     JSClass<JSSwiper>::StaticMethod("width", &JSSwiper::SetWidth);
     JSClass<JSSwiper>::StaticMethod("size", &JSSwiper::SetSize);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSSwiper>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT });
     JSClass<JSSwiper>::Inherit<JSContainerBase>();
     JSClass<JSSwiper>::Inherit<JSViewAbstract>();
     JSClass<JSSwiper>::Bind<>(globalObj);
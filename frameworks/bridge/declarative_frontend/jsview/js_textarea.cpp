@@ -123,6 +123,8 @@ void JSTextArea::JSBind(BindingTarget globalObj)
     JSClass<JSTextArea>::StaticMethod("onCopy", &JSTextArea::SetOnCopy);
     JSClass<JSTextArea>::StaticMethod("onCut", &JSTextArea::SetOnCut);
     JSClass<JSTextArea>::StaticMethod("onPaste", &JSTextArea::SetOnPaste);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSTextArea>::JSName(),
+        { BatchedAttribute::HEIGHT, BatchedAttribute::BACKGROUND_COLOR });
     JSClass<JSTextArea>::Inherit<JSViewAbstract>();
     JSClass<JSTextArea>::Bind(globalObj);
 }
@@ -137,6 +137,8 @@ void JSTextInput::JSBind(BindingTarget globalObj)
     JSClass<JSTextInput>::StaticMethod("onCopy", &JSTextInput::SetOnCopy);
     JSClass<JSTextInput>::StaticMethod("onCut", &JSTextInput::SetOnCut);
     JSClass<JSTextInput>::StaticMethod("onPaste", &JSTextInput::SetOnPaste);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSTextInput>::JSName(),
+        { BatchedAttribute::HEIGHT, BatchedAttribute::BACKGROUND_COLOR, BatchedAttribute::PADDING });
     JSClass<JSTextInput>::Inherit<JSViewAbstract>();
     JSClass<JSTextInput>::Bind(globalObj);
 }
@@ -36,6 +36,8 @@ void JSToggle::JSBind(BindingTarget globalObj)
     JSClass<JSToggle>::StaticMethod("size", &JSToggle::JsSize);
     JSClass<JSToggle>::StaticMethod("padding", &JSToggle::JsPadding);
     JSClass<JSToggle>::StaticMethod("switchPointColor", &JSToggle::SwitchPointColor);
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSToggle>::JSName(),
+        { BatchedAttribute::WIDTH, BatchedAttribute::HEIGHT, BatchedAttribute::PADDING });
     JSClass<JSToggle>::Inherit<JSViewAbstract>();
     JSClass<JSToggle>::Bind(globalObj);
 }
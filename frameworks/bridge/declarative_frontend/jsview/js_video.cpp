@@ -299,6 +299,7 @@ void JSVideo::JSBind(BindingTarget globalObj)
     JSClass<JSVideo>::StaticMethod("onDisAppear", &JSInteractableView::JsOnDisAppear);
     JSClass<JSVideo>::StaticMethod("remoteMessage", &JSInteractableView::JsCommonRemoteMessage);
 
+    JSViewAbstract::RegisterBatchedSetters(JSClass<JSVideo>::JSName(), { BatchedAttribute::OPACITY });
     JSClass<JSVideo>::Inherit<JSViewAbstract>();
     // override method
     JSClass<JSVideo>::StaticMethod("opacity", &JSViewAbstract::JsOpacityPassThrough);
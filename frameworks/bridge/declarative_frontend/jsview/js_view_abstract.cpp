@@ -559,6 +559,8 @@ void ParseCustomPopupParam(
 
 } // namespace
 
+thread_local std::unordered_map<std::string, uint32_t> JSViewAbstract::batchedSetterMasks_;
+
 uint32_t ColorAlphaAdapt(uint32_t origin)
 {
     uint32_t result = origin;
@@ -648,9 +650,14 @@ void JSViewAbstract::JsOpacity(const JSCallbackInfo& info)
         return;
     }
 
+    ParseAndSetOpacity(info[0]);
+}
+
+bool JSViewAbstract::ParseAndSetOpacity(const JSRef<JSVal>& jsValue)
+{
     double opacity = 0.0;
-    if (!ParseJsDouble(info[0], opacity)) {
-        return;
+    if (!ParseJsDouble(jsValue, opacity)) {
+        return false;
     }
 
     auto display = ViewStackProcessor::GetInstance()->GetDisplayComponent();
@@ -667,6 +674,7 @@ void JSViewAbstract::JsOpacity(const JSCallbackInfo& info)
                 AnimatableDouble(display->GetOpacity(), option), VisualState::NORMAL);
         }
     }
+    return true;
 }
 
 void JSViewAbstract::JsTranslate(const JSCallbackInfo& info)
@@ -968,6 +976,107 @@ bool JSViewAbstract::JsHeight(const JSRef<JSVal>& jsValue)
     return true;
 }
 
+void JSViewAbstract::JsAttributes(const JSCallbackInfo& info)
+{
+    ACE_SCOPED_TRACE("JSViewAbstract::JsAttributes");
+    if (info.Length() < 1 || !info[0]->IsArray()) {
+        LOGE("The arg is wrong, it is supposed to be an array of attributes");
+        return;
+    }
+
+    // Chained attribute calls cross the boundary between js and native once for each attribute, the attributes of a
+    // view are packed into one array instead and set natively here. Only the attributes the class of the view binds
+    // setters of its own for are set by calling those setters.
+    auto view = info.This();
+    uint32_t setterMask = 0;
+    JSRef<JSVal> className = view->GetProperty("name");
+    if (className->IsString()) {
+        auto iter = batchedSetterMasks_.find(className->ToString());
+        if (iter != batchedSetterMasks_.end()) {
+            setterMask = iter->second;
+        }
+    }
+    auto attributes = JSRef<JSArray>::Cast(info[0]);
+    size_t length = attributes->Length();
+    if (length % 2 != 0) {
+        LOGW("The value of the last attribute is missing");
+    }
+    for (size_t i = 0; i + 1 < length; i += 2) {
+        JSRef<JSVal> opcode = attributes->GetValueAt(i);
+        if (!opcode->IsNumber()) {
+            LOGE("The opcode of attribute at %{public}zu is not a number", i);
+            continue;
+        }
+        auto attribute = static_cast<BatchedAttribute>(opcode->ToNumber<int32_t>());
+        const char* name = GetBatchedAttributeName(attribute);
+        if (name == nullptr) {
+            LOGE("Unknown attribute %{public}d", static_cast<int32_t>(attribute));
+            continue;
+        }
+        JSRef<JSVal> value = attributes->GetValueAt(i + 1);
+        if ((setterMask & (1u << static_cast<uint32_t>(attribute))) == 0) {
+            SetBatchedAttribute(attribute, value);
+            continue;
+        }
+        JSRef<JSVal> setter = view->GetProperty(name);
+        if (!setter->IsFunction()) {
+            LOGE("The view has no setter of attribute %{public}s", name);
+            continue;
+        }
+        JSRef<JSFunc>::Cast(setter)->Call(view, 1, &value);
+    }
+}
+
+void JSViewAbstract::RegisterBatchedSetters(
+    const std::string& className, std::initializer_list<BatchedAttribute> attributes)
+{
+    auto& setterMask = batchedSetterMasks_[className];
+    for (auto attribute : attributes) {
+        setterMask |= 1u << static_cast<uint32_t>(attribute);
+    }
+}
+
+bool JSViewAbstract::SetBatchedAttribute(BatchedAttribute attribute, const JSRef<JSVal>& jsValue)
+{
+    switch (attribute) {
+        case BatchedAttribute::WIDTH:
+            return JsWidth(jsValue);
+        case BatchedAttribute::HEIGHT:
+            return JsHeight(jsValue);
+        case BatchedAttribute::BACKGROUND_COLOR:
+            return ParseAndSetBackgroundColor(jsValue);
+        case BatchedAttribute::OPACITY:
+            return ParseAndSetOpacity(jsValue);
+        case BatchedAttribute::PADDING:
+            return ParseAndSetPadding(jsValue);
+        case BatchedAttribute::MARGIN:
+            return ParseAndSetMargin(jsValue);
+        default:
+            LOGE("Unknown attribute %{public}d", static_cast<int32_t>(attribute));
+            return false;
+    }
+}
+
+const char* JSViewAbstract::GetBatchedAttributeName(BatchedAttribute attribute)
+{
+    switch (attribute) {
+        case BatchedAttribute::WIDTH:
+            return "width";
+        case BatchedAttribute::HEIGHT:
+            return "height";
+        case BatchedAttribute::BACKGROUND_COLOR:
+            return "backgroundColor";
+        case BatchedAttribute::OPACITY:
+            return "opacity";
+        case BatchedAttribute::PADDING:
+            return "padding";
+        case BatchedAttribute::MARGIN:
+            return "margin";
+        default:
+            return nullptr;
+    }
+}
+
 void JSViewAbstract::JsResponseRegion(const JSCallbackInfo& info)
 {
     if (info.Length() < 1) {
@@ -1542,16 +1651,22 @@ void JSViewAbstract::JsBackgroundColor(const JSCallbackInfo& info)
         LOGE("The argv is wrong, it is supposed to have at least 1 argument");
         return;
     }
+
+    ParseAndSetBackgroundColor(info[0]);
+}
+
+bool JSViewAbstract::ParseAndSetBackgroundColor(const JSRef<JSVal>& jsValue)
+{
     Color backgroundColor;
-    if (!ParseJsColor(info[0], backgroundColor)) {
-        return;
+    if (!ParseJsColor(jsValue, backgroundColor)) {
+        return false;
     }
 
     auto stack = ViewStackProcessor::GetInstance();
     auto boxComponent = stack->GetBoxComponent();
     if (!boxComponent) {
         LOGE("boxComponent is null");
-        return;
+        return false;
     }
     auto option = stack->GetImplicitAnimationOption();
     if (!stack->IsVisualStateSet()) {
@@ -1566,6 +1681,7 @@ void JSViewAbstract::JsBackgroundColor(const JSCallbackInfo& info)
                 AnimatableColor(c, option), VisualState::NORMAL);
         }
     }
+    return true;
 }
 
 void JSViewAbstract::JsBackgroundImage(const JSCallbackInfo& info)
@@ -1849,11 +1965,34 @@ void JSViewAbstract::ParseMarginOrPadding(const JSCallbackInfo& info, bool isMar
         return;
     }
 
-    if (info[0]->IsObject()) {
-        auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
+    ParseMarginOrPadding(info[0], isMargin);
+}
+
+bool JSViewAbstract::ParseAndSetPadding(const JSRef<JSVal>& jsValue)
+{
+    if (!jsValue->IsString() && !jsValue->IsNumber() && !jsValue->IsObject()) {
+        LOGE("The padding is supposed to be a string, number or object");
+        return false;
+    }
+    return ParseMarginOrPadding(jsValue, false);
+}
+
+bool JSViewAbstract::ParseAndSetMargin(const JSRef<JSVal>& jsValue)
+{
+    if (!jsValue->IsString() && !jsValue->IsNumber() && !jsValue->IsObject()) {
+        LOGE("The margin is supposed to be a string, number or object");
+        return false;
+    }
+    return ParseMarginOrPadding(jsValue, true);
+}
+
+bool JSViewAbstract::ParseMarginOrPadding(const JSRef<JSVal>& jsValue, bool isMargin)
+{
+    if (jsValue->IsObject()) {
+        auto argsPtrItem = JsonUtil::ParseJsonString(jsValue->ToString());
         if (!argsPtrItem || argsPtrItem->IsNull()) {
-            LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-            return;
+            LOGE("Js Parse object failed. argsPtr is null. %s", jsValue->ToString().c_str());
+            return false;
         }
         if (argsPtrItem->Contains("top") || argsPtrItem->Contains("bottom") || argsPtrItem->Contains("left") ||
             argsPtrItem->Contains("right")) {
@@ -1870,18 +2009,19 @@ void JSViewAbstract::ParseMarginOrPadding(const JSCallbackInfo& info, bool isMar
             } else {
                 SetPaddings(topDimen, bottomDimen, leftDimen, rightDimen);
             }
-            return;
+            return true;
         }
     }
     AnimatableDimension length;
-    if (!ParseJsAnimatableDimensionVp(info[0], length)) {
-        return;
+    if (!ParseJsAnimatableDimensionVp(jsValue, length)) {
+        return false;
     }
     if (isMargin) {
         SetMargin(length);
     } else {
         SetPadding(length);
     }
+    return true;
 }
 
 void JSViewAbstract::JsBorder(const JSCallbackInfo& info)
@@ -3664,6 +3804,7 @@ void JSViewAbstract::JSBind()
 
     JSClass<JSViewAbstract>::StaticMethod("width", &JSViewAbstract::JsWidth);
     JSClass<JSViewAbstract>::StaticMethod("height", &JSViewAbstract::JsHeight);
+    JSClass<JSViewAbstract>::StaticMethod("attributes", &JSViewAbstract::JsAttributes);
     JSClass<JSViewAbstract>::StaticMethod("responseRegion", &JSViewAbstract::JsResponseRegion);
     JSClass<JSViewAbstract>::StaticMethod("size", &JSViewAbstract::JsSize);
     JSClass<JSViewAbstract>::StaticMethod("constraintSize", &JSViewAbstract::JsConstraintSize);
@@ -17,7 +17,9 @@
 #define FRAMEWORKS_BRIDGE_DECLARATIVE_FRONTEND_JS_VIEW_JS_VIEW_ABSTRACT_H
 
 #include <functional>
+#include <initializer_list>
 #include <optional>
+#include <unordered_map>
 
 #include "base/geometry/dimension_rect.h"
 #include "base/json/json_util.h"
@@ -58,6 +60,16 @@ enum class ResponseType : int32_t {
     LONGPRESS,
 };
 
+// Opcodes of the attributes packed in one call of JSViewAbstract::JsAttributes.
+enum class BatchedAttribute : int32_t {
+    WIDTH = 0,
+    HEIGHT,
+    BACKGROUND_COLOR,
+    OPACITY,
+    PADDING,
+    MARGIN,
+};
+
 enum class JSCallbackInfoType {
     STRING,
     NUMBER,
@@ -93,6 +105,12 @@ public:
     static void ParseAndSetTransitionOption(std::unique_ptr<JsonValue>& transitionArgs);
     static void JsWidth(const JSCallbackInfo& info);
     static void JsHeight(const JSCallbackInfo& info);
+    // Set the attributes packed as [opcode, value, opcode, value, ...] in one call, see BatchedAttribute.
+    static void JsAttributes(const JSCallbackInfo& info);
+    // Records the batched attributes the class named |className| binds or inherits setters of its own for, these
+    // attributes are set through the setters of the class, the others are set natively.
+    static void RegisterBatchedSetters(
+        const std::string& className, std::initializer_list<BatchedAttribute> attributes);
     static void JsBackgroundColor(const JSCallbackInfo& info);
     static void JsBackgroundImage(const JSCallbackInfo& info);
     static void JsBackgroundImageSize(const JSCallbackInfo& info);
@@ -103,6 +121,7 @@ public:
     static void JsPadding(const JSCallbackInfo& info);
     static void JsMargin(const JSCallbackInfo& info);
     static void ParseMarginOrPadding(const JSCallbackInfo& info, bool isMargin);
+    static bool ParseMarginOrPadding(const JSRef<JSVal>& jsValue, bool isMargin);
     static void JsBorder(const JSCallbackInfo& info);
     static void JsBorderWidth(const JSCallbackInfo& info);
     static void JsBorderRadius(const JSCallbackInfo& info);
@@ -254,6 +273,14 @@ protected:
     static RefPtr<ThemeConstants> GetThemeConstants();
     static bool JsWidth(const JSRef<JSVal>& jsValue);
     static bool JsHeight(const JSRef<JSVal>& jsValue);
+    static bool ParseAndSetOpacity(const JSRef<JSVal>& jsValue);
+    static bool ParseAndSetBackgroundColor(const JSRef<JSVal>& jsValue);
+    static bool ParseAndSetPadding(const JSRef<JSVal>& jsValue);
+    static bool ParseAndSetMargin(const JSRef<JSVal>& jsValue);
+    // Returns the name the setter of |attribute| is bound with, nullptr if it is unknown.
+    static const char* GetBatchedAttributeName(BatchedAttribute attribute);
+    // Sets |attribute| as the setter of JSViewAbstract does, without calling into js.
+    static bool SetBatchedAttribute(BatchedAttribute attribute, const JSRef<JSVal>& jsValue);
     template<typename T>
     static RefPtr<T> GetTheme()
     {
@@ -274,6 +301,10 @@ protected:
         }
         return themeManager->GetTheme<T>();
     }
+
+private:
+    // Masks of the batched attributes set through the setters of the classes, keyed by the names of the classes.
+    static thread_local std::unordered_map<std::string, uint32_t> batchedSetterMasks_;
 };
 } // namespace OHOS::Ace::Framework
 #endif // JS_VIEW_ABSTRACT_H
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frameworks/bridge/js_frontend/engine/common/canvas_display_list.h"
+
+#include <cstring>
+
+#include "base/log/log.h"
+#include "core/components/custom_paint/custom_paint_component.h"
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+class DisplayListReader final {
+public:
+    explicit DisplayListReader(const std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+    ~DisplayListReader() = default;
+
+    bool HasNext() const
+    {
+        return offset_ < buffer_.size();
+    }
+
+    template<class T>
+    T Read()
+    {
+        T value {};
+        if (offset_ + sizeof(T) > buffer_.size()) {
+            LOGE("display list is truncated at %{public}zu", offset_);
+            offset_ = buffer_.size();
+            return value;
+        }
+        std::memcpy(&value, buffer_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return value;
+    }
+
+    Rect ReadRect()
+    {
+        auto left = Read<double>();
+        auto top = Read<double>();
+        auto width = Read<double>();
+        auto height = Read<double>();
+        return Rect(left, top, width, height);
+    }
+
+private:
+    const std::vector<uint8_t>& buffer_;
+    size_t offset_ = 0;
+};
+
+} // namespace
+
+void CanvasDisplayList::PushTask(const CanvasTask& task)
+{
+    if (!task) {
+        return;
+    }
+    WriteOp(Op::TASK);
+    Write(static_cast<uint32_t>(tasks_.size()));
+    tasks_.emplace_back(task);
+}
+
+void CanvasDisplayList::Replay(const RefPtr<CanvasTaskPool>& pool) const
+{
+    if (!pool) {
+        return;
+    }
+    DisplayListReader reader(buffer_);
+    while (reader.HasNext()) {
+        auto op = static_cast<Op>(reader.Read<uint8_t>());
+        switch (op) {
+            case Op::FILL_RECT:
+                pool->FillRect(reader.ReadRect());
+                break;
+            case Op::STROKE_RECT:
+                pool->StrokeRect(reader.ReadRect());
+                break;
+            case Op::CLEAR_RECT:
+                pool->ClearRect(reader.ReadRect());
+                break;
+            case Op::ADD_RECT:
+                pool->AddRect(reader.ReadRect());
+                break;
+            case Op::FILL_TEXT:
+            case Op::STROKE_TEXT: {
+                auto index = reader.Read<uint32_t>();
+                auto x = reader.Read<double>();
+                auto y = reader.Read<double>();
+                if (index >= strings_.size()) {
+                    LOGE("text index %{public}u of display list is out of range", index);
+                    return;
+                }
+                if (op == Op::FILL_TEXT) {
+                    pool->FillText(strings_[index], Offset(x, y));
+                } else {
+                    pool->StrokeText(strings_[index], Offset(x, y));
+                }
+                break;
+            }
+            case Op::BEGIN_PATH:
+                pool->BeginPath();
+                break;
+            case Op::CLOSE_PATH:
+                pool->ClosePath();
+                break;
+            case Op::MOVE_TO: {
+                auto x = reader.Read<double>();
+                pool->MoveTo(x, reader.Read<double>());
+                break;
+            }
+            case Op::LINE_TO: {
+                auto x = reader.Read<double>();
+                pool->LineTo(x, reader.Read<double>());
+                break;
+            }
+            case Op::FILL:
+                pool->Fill();
+                break;
+            case Op::STROKE:
+                pool->Stroke();
+                break;
+            case Op::CLIP:
+                pool->Clip();
+                break;
+            case Op::SAVE:
+                pool->Save();
+                break;
+            case Op::RESTORE:
+                pool->Restore();
+                break;
+            case Op::ROTATE:
+                pool->Rotate(reader.Read<double>());
+                break;
+            case Op::SCALE: {
+                auto x = reader.Read<double>();
+                pool->Scale(x, reader.Read<double>());
+                break;
+            }
+            case Op::TRANSLATE: {
+                auto x = reader.Read<double>();
+                pool->Translate(x, reader.Read<double>());
+                break;
+            }
+            case Op::FILL_COLOR:
+                pool->UpdateFillColor(Color(reader.Read<uint32_t>()));
+                break;
+            case Op::STROKE_COLOR:
+                pool->UpdateStrokeColor(Color(reader.Read<uint32_t>()));
+                break;
+            case Op::LINE_WIDTH:
+                pool->UpdateLineWidth(reader.Read<double>());
+                break;
+            case Op::GLOBAL_ALPHA:
+                pool->UpdateGlobalAlpha(reader.Read<double>());
+                break;
+            case Op::TASK: {
+                auto index = reader.Read<uint32_t>();
+                if (index >= tasks_.size()) {
+                    LOGE("task index %{public}u of display list is out of range", index);
+                    return;
+                }
+                tasks_[index](pool);
+                break;
+            }
+            default:
+                LOGE("unknown op %{public}d in display list", static_cast<int32_t>(op));
+                return;
+        }
+    }
+}
+
+} // namespace OHOS::Ace::Framework
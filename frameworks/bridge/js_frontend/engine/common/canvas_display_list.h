@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_COMMON_CANVAS_DISPLAY_LIST_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_COMMON_CANVAS_DISPLAY_LIST_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/geometry/rect.h"
+#include "base/memory/ace_type.h"
+#include "core/components/common/properties/color.h"
+
+namespace OHOS::Ace {
+class CanvasTaskPool;
+} // namespace OHOS::Ace
+
+namespace OHOS::Ace::Framework {
+
+using CanvasTask = std::function<void(const RefPtr<CanvasTaskPool>&)>;
+
+// CanvasDisplayList records the draw calls of one canvas on js thread into an append-only byte buffer, and replays
+// them on ui thread as one command. Frequent calls are encoded as an opcode with plain arguments, the others are
+// kept as tasks in a side table, so that the order of all calls is kept.
+class CanvasDisplayList final : public AceType {
+    DECLARE_ACE_TYPE(CanvasDisplayList, AceType);
+
+public:
+    enum class Op : uint8_t {
+        FILL_RECT = 0,
+        STROKE_RECT,
+        CLEAR_RECT,
+        ADD_RECT,
+        FILL_TEXT,
+        STROKE_TEXT,
+        BEGIN_PATH,
+        CLOSE_PATH,
+        MOVE_TO,
+        LINE_TO,
+        FILL,
+        STROKE,
+        CLIP,
+        SAVE,
+        RESTORE,
+        ROTATE,
+        SCALE,
+        TRANSLATE,
+        FILL_COLOR,
+        STROKE_COLOR,
+        LINE_WIDTH,
+        GLOBAL_ALPHA,
+        TASK,
+        COUNT,
+    };
+
+    CanvasDisplayList() = default;
+    ~CanvasDisplayList() override = default;
+
+    void FillRect(const Rect& rect)
+    {
+        WriteRect(Op::FILL_RECT, rect);
+    }
+
+    void StrokeRect(const Rect& rect)
+    {
+        WriteRect(Op::STROKE_RECT, rect);
+    }
+
+    void ClearRect(const Rect& rect)
+    {
+        WriteRect(Op::CLEAR_RECT, rect);
+    }
+
+    void AddRect(const Rect& rect)
+    {
+        WriteRect(Op::ADD_RECT, rect);
+    }
+
+    void FillText(const std::string& text, double x, double y)
+    {
+        WriteText(Op::FILL_TEXT, text, x, y);
+    }
+
+    void StrokeText(const std::string& text, double x, double y)
+    {
+        WriteText(Op::STROKE_TEXT, text, x, y);
+    }
+
+    void BeginPath()
+    {
+        WriteOp(Op::BEGIN_PATH);
+    }
+
+    void ClosePath()
+    {
+        WriteOp(Op::CLOSE_PATH);
+    }
+
+    void MoveTo(double x, double y)
+    {
+        WriteOp(Op::MOVE_TO);
+        Write(x);
+        Write(y);
+    }
+
+    void LineTo(double x, double y)
+    {
+        WriteOp(Op::LINE_TO);
+        Write(x);
+        Write(y);
+    }
+
+    void Fill()
+    {
+        WriteOp(Op::FILL);
+    }
+
+    void Stroke()
+    {
+        WriteOp(Op::STROKE);
+    }
+
+    void Clip()
+    {
+        WriteOp(Op::CLIP);
+    }
+
+    void Save()
+    {
+        WriteOp(Op::SAVE);
+    }
+
+    void Restore()
+    {
+        WriteOp(Op::RESTORE);
+    }
+
+    void Rotate(double angle)
+    {
+        WriteOp(Op::ROTATE);
+        Write(angle);
+    }
+
+    void Scale(double x, double y)
+    {
+        WriteOp(Op::SCALE);
+        Write(x);
+        Write(y);
+    }
+
+    void Translate(double x, double y)
+    {
+        WriteOp(Op::TRANSLATE);
+        Write(x);
+        Write(y);
+    }
+
+    void UpdateFillColor(const Color& color)
+    {
+        WriteOp(Op::FILL_COLOR);
+        Write(color.GetValue());
+    }
+
+    void UpdateStrokeColor(const Color& color)
+    {
+        WriteOp(Op::STROKE_COLOR);
+        Write(color.GetValue());
+    }
+
+    void UpdateLineWidth(double width)
+    {
+        WriteOp(Op::LINE_WIDTH);
+        Write(width);
+    }
+
+    void UpdateGlobalAlpha(double alpha)
+    {
+        WriteOp(Op::GLOBAL_ALPHA);
+        Write(alpha);
+    }
+
+    // Calls without an opcode, such as gradients, images and path2d, are recorded as tasks.
+    void PushTask(const CanvasTask& task);
+
+    void Replay(const RefPtr<CanvasTaskPool>& pool) const;
+
+    bool IsEmpty() const
+    {
+        return buffer_.empty();
+    }
+
+    size_t GetOpCount() const
+    {
+        return opCount_;
+    }
+
+    size_t GetByteSize() const
+    {
+        return buffer_.size();
+    }
+
+private:
+    void WriteOp(Op op)
+    {
+        buffer_.push_back(static_cast<uint8_t>(op));
+        ++opCount_;
+    }
+
+    template<class T>
+    void Write(T value)
+    {
+        auto bytes = reinterpret_cast<const uint8_t*>(&value);
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+    }
+
+    void WriteRect(Op op, const Rect& rect)
+    {
+        WriteOp(op);
+        Write(rect.Left());
+        Write(rect.Top());
+        Write(rect.Width());
+        Write(rect.Height());
+    }
+
+    void WriteText(Op op, const std::string& text, double x, double y)
+    {
+        WriteOp(op);
+        Write(static_cast<uint32_t>(strings_.size()));
+        Write(x);
+        Write(y);
+        strings_.emplace_back(text);
+    }
+
+    std::vector<uint8_t> buffer_;
+    std::vector<std::string> strings_;
+    std::vector<CanvasTask> tasks_;
+    size_t opCount_ = 0;
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_COMMON_CANVAS_DISPLAY_LIST_H
@@ -19,6 +19,7 @@
 #include "base/utils/string_utils.h"
 
 #include "core/components/custom_paint/offscreen_canvas.h"
+#include "frameworks/bridge/js_frontend/engine/common/canvas_display_list.h"
 #include "frameworks/bridge/js_frontend/engine/common/js_engine.h"
 #include "frameworks/bridge/js_frontend/engine/jsi/ark_js_value.h"
 #include "frameworks/bridge/js_frontend/engine/jsi/jsi_offscreen_canvas_bridge.h"
@@ -170,45 +171,46 @@ inline NodeId GetCurrentNodeId(const shared_ptr<JsRuntime>& runtime, const share
     return id < 0 ? 0 : id;
 }
 
-void PushTaskToPageById(const shared_ptr<JsRuntime>& runtime, NodeId id,
-    const std::function<void(const RefPtr<CanvasTaskPool>&)>& task)
+RefPtr<CanvasDisplayList> GetDisplayListById(const shared_ptr<JsRuntime>& runtime, NodeId id)
 {
-    auto command = Referenced::MakeRefPtr<JsCommandContextOperation>(id, task);
-    // push command
     auto engine = static_cast<JsiEngineInstance*>(runtime->GetEmbedderData());
     if (!engine) {
         LOGE("engine is null.");
-        return;
+        return nullptr;
     }
     auto page = engine->GetRunningPage();
     if (!page) {
         LOGE("page is null.");
-        return;
+        return nullptr;
     }
-    page->PushCommand(command);
+    return page->GetCanvasDisplayList(id);
 }
-void PushTaskToPage(const shared_ptr<JsRuntime>& runtime, const shared_ptr<JsValue>& value,
-    const std::function<void(const RefPtr<CanvasTaskPool>&)>& task)
+
+RefPtr<CanvasDisplayList> GetDisplayList(const shared_ptr<JsRuntime>& runtime, const shared_ptr<JsValue>& value)
 {
     if (!runtime || !value) {
         LOGE("runtime or value is null.");
-        return;
+        return nullptr;
     }
-    // get node id
-    NodeId id = GetCurrentNodeId(runtime, value);
-    auto command = Referenced::MakeRefPtr<JsCommandContextOperation>(id, task);
-    // push command
-    auto engine = static_cast<JsiEngineInstance*>(runtime->GetEmbedderData());
-    if (!engine) {
-        LOGE("engine is null.");
-        return;
+    return GetDisplayListById(runtime, GetCurrentNodeId(runtime, value));
+}
+
+void PushTaskToPageById(const shared_ptr<JsRuntime>& runtime, NodeId id,
+    const std::function<void(const RefPtr<CanvasTaskPool>&)>& task)
+{
+    auto displayList = GetDisplayListById(runtime, id);
+    if (displayList) {
+        displayList->PushTask(task);
     }
-    auto page = engine->GetRunningPage();
-    if (!page) {
-        LOGE("page is null.");
-        return;
+}
+
+void PushTaskToPage(const shared_ptr<JsRuntime>& runtime, const shared_ptr<JsValue>& value,
+    const std::function<void(const RefPtr<CanvasTaskPool>&)>& task)
+{
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->PushTask(task);
     }
-    page->PushCommand(command);
 }
 
 inline PaintState JsParseTextState(const shared_ptr<JsRuntime>& runtime, const shared_ptr<JsValue>& value)
@@ -607,8 +609,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsFillRect(const shared_ptr<JsRuntime>& run
         return runtime->NewUndefined();
     }
     Rect rect = GetJsRectParam(runtime, argc, argv);
-    auto task = [rect](const RefPtr<CanvasTaskPool>& pool) { pool->FillRect(rect); };
-    PushTaskToPage(runtime, value, std::move(task));
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->FillRect(rect);
+    }
     return runtime->NewUndefined();
 }
 
@@ -621,8 +625,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsStrokeRect(const shared_ptr<JsRuntime>& r
         return runtime->NewUndefined();
     }
     Rect rect = GetJsRectParam(runtime, argc, argv);
-    auto task = [rect](const RefPtr<CanvasTaskPool>& pool) { pool->StrokeRect(rect); };
-    PushTaskToPage(runtime, value, std::move(task));
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->StrokeRect(rect);
+    }
     return runtime->NewUndefined();
 }
 
@@ -635,8 +641,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsClearRect(const shared_ptr<JsRuntime>& ru
         return runtime->NewUndefined();
     }
     Rect rect = GetJsRectParam(runtime, argc, argv);
-    auto task = [rect](const RefPtr<CanvasTaskPool>& pool) { pool->ClearRect(rect); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->ClearRect(rect);
+    }
     return runtime->NewUndefined();
 }
 
@@ -654,8 +662,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsFillText(const shared_ptr<JsRuntime>& run
     auto text = argv[0]->ToString(runtime);
     double x = GetJsDoubleVal(runtime, argv[1]);
     double y = GetJsDoubleVal(runtime, argv[2]);
-    auto task = [text, x, y](const RefPtr<CanvasTaskPool>& pool) { pool->FillText(text, Offset(x, y)); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->FillText(text, x, y);
+    }
     return runtime->NewUndefined();
 }
 
@@ -673,8 +683,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsStrokeText(const shared_ptr<JsRuntime>& r
     auto text = argv[0]->ToString(runtime);
     double x = GetJsDoubleVal(runtime, argv[1]);
     double y = GetJsDoubleVal(runtime, argv[2]);
-    auto task = [text, x, y](const RefPtr<CanvasTaskPool>& pool) { pool->StrokeText(text, Offset(x, y)); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->StrokeText(text, x, y);
+    }
     return runtime->NewUndefined();
 }
 
@@ -738,8 +750,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsBeginPath(const shared_ptr<JsRuntime>& ru
         LOGE("argc error, argc = %{private}d", argc);
         return runtime->NewUndefined();
     }
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->BeginPath(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->BeginPath();
+    }
     return runtime->NewUndefined();
 }
 
@@ -751,8 +765,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsClosePath(const shared_ptr<JsRuntime>& ru
         LOGE("argc error, argc = %{private}d", argc);
         return runtime->NewUndefined();
     }
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->ClosePath(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->ClosePath();
+    }
     return runtime->NewUndefined();
 }
 
@@ -766,8 +782,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsMoveTo(const shared_ptr<JsRuntime>& runti
     }
     double x = GetJsDoubleVal(runtime, argv[0]);
     double y = GetJsDoubleVal(runtime, argv[1]);
-    auto task = [x, y](const RefPtr<CanvasTaskPool>& pool) { pool->MoveTo(x, y); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->MoveTo(x, y);
+    }
     return runtime->NewUndefined();
 }
 
@@ -781,8 +799,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsLineTo(const shared_ptr<JsRuntime>& runti
     }
     double x = GetJsDoubleVal(runtime, argv[0]);
     double y = GetJsDoubleVal(runtime, argv[1]);
-    auto task = [x, y](const RefPtr<CanvasTaskPool>& pool) { pool->LineTo(x, y); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->LineTo(x, y);
+    }
     return runtime->NewUndefined();
 }
 
@@ -902,8 +922,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsRect(const shared_ptr<JsRuntime>& runtime
 {
     LOGD("JsRect");
     Rect rect = GetJsRectParam(runtime, argc, argv);
-    auto task = [rect](const RefPtr<CanvasTaskPool>& pool) { pool->AddRect(rect); };
-    PushTaskToPage(runtime, value, std::move(task));
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->AddRect(rect);
+    }
     return runtime->NewUndefined();
 }
 
@@ -911,8 +933,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsFill(const shared_ptr<JsRuntime>& runtime
     const std::vector<shared_ptr<JsValue>>& argv, int32_t argc)
 {
     LOGD("JsFill");
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->Fill(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Fill();
+    }
     return runtime->NewUndefined();
 }
 
@@ -937,8 +961,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsStroke(const shared_ptr<JsRuntime>& runti
         PushTaskToPage(runtime, value, task);
         return runtime->NewUndefined();
     }
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->Stroke(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Stroke();
+    }
     return runtime->NewUndefined();
 }
 
@@ -946,8 +972,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsClip(const shared_ptr<JsRuntime>& runtime
     const std::vector<shared_ptr<JsValue>>& argv, int32_t argc)
 {
     LOGD("JsClip");
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->Clip(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Clip();
+    }
     return runtime->NewUndefined();
 }
 
@@ -959,8 +987,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsRestore(const shared_ptr<JsRuntime>& runt
         LOGE("argc error, argc = %{private}d", argc);
         return runtime->NewUndefined();
     }
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->Restore(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Restore();
+    }
     return runtime->NewUndefined();
 }
 
@@ -971,8 +1001,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsSave(const shared_ptr<JsRuntime>& runtime
         LOGE("argc error, argc = %{private}d", argc);
         return runtime->NewUndefined();
     }
-    auto task = [](const RefPtr<CanvasTaskPool>& pool) { pool->Save(); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Save();
+    }
     return runtime->NewUndefined();
 }
 
@@ -981,8 +1013,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsRotate(const shared_ptr<JsRuntime>& runti
 {
     LOGD("JsiCanvasBridge::JsRotate");
     double angle = GetJsDoubleVal(runtime, argv[0]);
-    auto task = [angle](const RefPtr<CanvasTaskPool>& pool) { pool->Rotate(angle); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Rotate(angle);
+    }
     return runtime->NewUndefined();
 }
 
@@ -996,8 +1030,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsScale(const shared_ptr<JsRuntime>& runtim
     }
     double x = GetJsDoubleVal(runtime, argv[0]);
     double y = GetJsDoubleVal(runtime, argv[1]);
-    auto task = [x, y](const RefPtr<CanvasTaskPool>& pool) { pool->Scale(x, y); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Scale(x, y);
+    }
     return runtime->NewUndefined();
 }
 
@@ -1051,8 +1087,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsTranslate(const shared_ptr<JsRuntime>& ru
     }
     double x = GetJsDoubleVal(runtime, argv[0]);
     double y = GetJsDoubleVal(runtime, argv[1]);
-    auto task = [x, y](const RefPtr<CanvasTaskPool>& pool) { pool->Translate(x, y); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->Translate(x, y);
+    }
     return runtime->NewUndefined();
 }
 
@@ -1999,8 +2037,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsFillStyleSetter(const shared_ptr<JsRuntim
     if (proto->IsString(runtime)) {
         auto colorStr = proto->ToString(runtime);
         auto color = Color::FromString(colorStr);
-        auto task = [color](const RefPtr<CanvasTaskPool>& pool) { pool->UpdateFillColor(color); };
-        PushTaskToPage(runtime, value, task);
+        auto displayList = GetDisplayList(runtime, value);
+        if (displayList) {
+            displayList->UpdateFillColor(color);
+        }
     } else {
         auto typeVal = proto->GetProperty(runtime, "__type");
         auto type = typeVal->ToString(runtime);
@@ -2039,8 +2079,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsStrokeStyleSetter(const shared_ptr<JsRunt
     if (proto->IsString(runtime)) {
         auto colorStr = proto->ToString(runtime);
         auto color = Color::FromString(colorStr);
-        auto task = [color](const RefPtr<CanvasTaskPool>& pool) { pool->UpdateStrokeColor(color); };
-        PushTaskToPage(runtime, value, task);
+        auto displayList = GetDisplayList(runtime, value);
+        if (displayList) {
+            displayList->UpdateStrokeColor(color);
+        }
     } else {
         auto typeVal = proto->GetProperty(runtime, "__type");
         auto type = typeVal->ToString(runtime);
@@ -2158,8 +2200,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsLineWidthSetter(const shared_ptr<JsRuntim
         return runtime->NewUndefined();
     }
     double lineWidth = GetJsDoubleVal(runtime, proto);
-    auto task = [lineWidth](const RefPtr<CanvasTaskPool>& pool) { pool->UpdateLineWidth(lineWidth); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->UpdateLineWidth(lineWidth);
+    }
     value->SetProperty(runtime, "__lineWidth", proto);
     return runtime->NewUndefined();
 }
@@ -2275,8 +2319,10 @@ shared_ptr<JsValue> JsiCanvasBridge::JsAlphaSetter(const shared_ptr<JsRuntime>&
         return runtime->NewUndefined();
     }
     double alpha = GetJsDoubleVal(runtime, proto);
-    auto task = [alpha](const RefPtr<CanvasTaskPool>& pool) { pool->UpdateGlobalAlpha(alpha); };
-    PushTaskToPage(runtime, value, task);
+    auto displayList = GetDisplayList(runtime, value);
+    if (displayList) {
+        displayList->UpdateGlobalAlpha(alpha);
+    }
     value->SetProperty(runtime, "__globalAlpha", proto);
     return runtime->NewUndefined();
 }
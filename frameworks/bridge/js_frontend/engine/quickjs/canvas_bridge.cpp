@@ -120,29 +120,26 @@ void PushTaskToPage(JSContext* ctx, JSValueConst value, const std::function<void
 {
     // get node id
     NodeId id = GetCurrentNodeId(ctx, value);
-    auto command = Referenced::MakeRefPtr<JsCommandContextOperation>(id, task);
-    // push command
     auto instance = static_cast<QjsEngineInstance*>(JS_GetContextOpaque(ctx));
     ACE_DCHECK(instance);
     auto page = instance->GetRunningPage();
     if (!page) {
         return;
     }
-    page->PushCommand(command);
+    // Calls following each other are sent to ui thread as one command.
+    page->GetCanvasDisplayList(id)->PushTask(task);
 }
 
 #if !defined(WINDOWS_PLATFORM) and !defined(MAC_PLATFORM)
 void PushTaskToPageById(JSContext* ctx, NodeId id, const std::function<void(const RefPtr<CanvasTaskPool>&)>& task)
 {
-    auto command = Referenced::MakeRefPtr<JsCommandContextOperation>(id, task);
-    // push command
     auto instance = static_cast<QjsEngineInstance*>(JS_GetContextOpaque(ctx));
     ACE_DCHECK(instance);
     auto page = instance->GetRunningPage();
     if (!page) {
         return;
     }
-    page->PushCommand(command);
+    page->GetCanvasDisplayList(id)->PushTask(task);
 }
 #endif
 
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "base/log/ace_trace.h"
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#include "core/image/image_cache.h"
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x51424331; // "QBC1"
+const char CACHE_FILE_PREFIX[] = "/qjs_bytecode_";
+const char TEMP_FILE_SUFFIX[] = ".tmp";
+
+struct CacheHeader {
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t sourceSize = 0;
+    uint64_t sourceHash = 0;
+    // Time to compile the source, to report the time saved when the bytecode is read instead.
+    int64_t compileCost = 0;
+};
+
+uint64_t HashSource(const char* source, size_t sourceSize)
+{
+    return std::hash<std::string_view> {}(std::string_view(source, sourceSize));
+}
+
+// Bytecode written by quickjs starts with its format version, which changes with the engine.
+uint8_t GetBytecodeVersion(JSContext* ctx)
+{
+    static std::once_flag versionFlag;
+    static uint8_t version = 0;
+    std::call_once(versionFlag, [ctx]() {
+        size_t size = 0;
+        uint8_t* buffer = JS_WriteObject(ctx, &size, JS_NewInt32(ctx, 0), 0);
+        if (buffer) {
+            version = size > 0 ? buffer[0] : 0;
+            js_free(ctx, buffer);
+        }
+    });
+    return version;
+}
+
+bool ReadCacheFile(const std::string& path, CacheHeader& header, std::vector<uint8_t>& bytecode)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != CACHE_MAGIC) {
+        return false;
+    }
+    bytecode.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !bytecode.empty();
+}
+
+void WriteCacheFile(const std::string& path, const CacheHeader& header, JSContext* ctx, JSValueConst compiled)
+{
+    size_t size = 0;
+    uint8_t* buffer = JS_WriteObject(ctx, &size, compiled, JS_WRITE_OBJ_BYTECODE);
+    if (!buffer) {
+        LOGW("write bytecode of js source failed");
+        return;
+    }
+    // Write to a temp file first, so that other instances never read a half written cache.
+    std::string tempPath = path + TEMP_FILE_SUFFIX;
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (file.is_open()) {
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(size));
+        }
+        if (!file.good()) {
+            LOGW("write bytecode cache failed");
+            js_free(ctx, buffer);
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+    js_free(ctx, buffer);
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+    }
+}
+
+} // namespace
+
+std::string QjsBytecodeCache::GetCachePath(
+    JSContext* ctx, const char* source, size_t sourceSize, const char* fileName, int32_t evalFlags)
+{
+    return GetCachePath(GetBytecodeVersion(ctx), source, sourceSize, fileName, evalFlags);
+}
+
+std::string QjsBytecodeCache::GetCachePath(
+    uint8_t bytecodeVersion, const char* source, size_t sourceSize, const char* fileName, int32_t evalFlags)
+{
+    auto cacheDir = ImageCache::GetImageCacheFilePath();
+    if (cacheDir.empty()) {
+        return "";
+    }
+    std::string key = std::to_string(bytecodeVersion) + "_" + std::to_string(evalFlags) + "_" +
+                      std::string(fileName ? fileName : "") + "_" + std::to_string(HashSource(source, sourceSize));
+    return cacheDir + CACHE_FILE_PREFIX + std::to_string(std::hash<std::string> {}(key));
+}
+
+JSValue QjsBytecodeCache::Compile(JSContext* ctx, const char* source, size_t sourceSize, const char* fileName,
+    int32_t evalFlags, int64_t& savedTime)
+{
+    ACE_SCOPED_TRACE("QjsBytecodeCache::Compile");
+    savedTime = 0;
+    int64_t begin = GetMicroTickCount();
+    auto path = GetCachePath(ctx, source, sourceSize, fileName, evalFlags);
+    CacheHeader header;
+    header.sourceSize = static_cast<uint32_t>(sourceSize);
+    header.sourceHash = HashSource(source, sourceSize);
+    if (!path.empty()) {
+        CacheHeader cachedHeader;
+        std::vector<uint8_t> bytecode;
+        if (ReadCacheFile(path, cachedHeader, bytecode) && cachedHeader.sourceSize == header.sourceSize &&
+            cachedHeader.sourceHash == header.sourceHash) {
+            JSValue compiled = JS_ReadObject(ctx, bytecode.data(), bytecode.size(), JS_READ_OBJ_BYTECODE);
+            if (!JS_IsException(compiled)) {
+                // Reading a large bytecode may cost more than compiling a small source.
+                savedTime = std::max<int64_t>(cachedHeader.compileCost - (GetMicroTickCount() - begin), 0);
+                return compiled;
+            }
+            // The cache can't be read by this engine, compile the source again and replace it.
+            LOGW("read bytecode cache of %{public}s failed", fileName ? fileName : "");
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        }
+    }
+
+    JSValue compiled = JS_Eval(ctx, source, sourceSize, fileName, evalFlags | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(compiled) || path.empty()) {
+        return compiled;
+    }
+    header.compileCost = GetMicroTickCount() - begin;
+    WriteCacheFile(path, header, ctx, compiled);
+    return compiled;
+}
+
+JSValue QjsBytecodeCache::Run(JSContext* ctx, JSValue compiled)
+{
+    if (JS_IsException(compiled)) {
+        return compiled;
+    }
+    // Module values are owned by the context and must not be freed here.
+    if (JS_VALUE_GET_TAG(compiled) == JS_TAG_MODULE && JS_ResolveModule(ctx, compiled) < 0) {
+        return JS_EXCEPTION;
+    }
+    return JS_EvalFunction(ctx, compiled);
+}
+
+} // namespace OHOS::Ace::Framework
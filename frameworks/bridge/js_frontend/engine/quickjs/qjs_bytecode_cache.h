@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_QUICKJS_QJS_BYTECODE_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_QUICKJS_QJS_BYTECODE_CACHE_H
+
+#include <cstdint>
+#include <string>
+
+#include "third_party/quickjs/quickjs.h"
+
+namespace OHOS::Ace::Framework {
+
+// QjsBytecodeCache keeps the bytecode of js sources compiled at runtime on disk, so that a source is parsed only
+// once. Entries are keyed by the bytecode version of quickjs, the file name and the content of source, so they never
+// go stale when the app or the engine is updated.
+class QjsBytecodeCache final {
+public:
+    // Compile the source without running it, or read its bytecode from cache.
+    // The compile time saved by the cache is returned in |savedTime| in microseconds.
+    static JSValue Compile(JSContext* ctx, const char* source, size_t sourceSize, const char* fileName,
+        int32_t evalFlags, int64_t& savedTime);
+
+    // Run the result of Compile, modules are resolved before evaluation.
+    static JSValue Run(JSContext* ctx, JSValue compiled);
+
+private:
+    static std::string GetCachePath(
+        JSContext* ctx, const char* source, size_t sourceSize, const char* fileName, int32_t evalFlags);
+    static std::string GetCachePath(uint8_t bytecodeVersion, const char* source, size_t sourceSize,
+        const char* fileName, int32_t evalFlags);
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_QUICKJS_QJS_BYTECODE_CACHE_H
@@ -53,6 +53,7 @@
 #include "frameworks/bridge/js_frontend/engine/quickjs/image_animator_bridge.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/intl/intl_support.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/list_bridge.h"
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/offscreen_canvas_bridge.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_group_js_bridge.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_utils.h"
@@ -95,6 +96,23 @@ int32_t CallEvalBuf(
     return ret;
 }
 
+// Eval a source which is compiled at runtime, its bytecode is cached on disk for next start.
+int32_t CallEvalBufWithCache(JSContext* ctx, const std::string& source, const char* filename, int32_t evalFlags,
+    int32_t instanceId, int64_t& savedTime)
+{
+    JSValue val = QjsBytecodeCache::Run(
+        ctx, QjsBytecodeCache::Compile(ctx, source.c_str(), source.size(), filename, evalFlags, savedTime));
+    int32_t ret = JS_CALL_SUCCESS;
+    if (JS_IsException(val)) {
+        LOGE("[Qjs Native] EvalBuf failed!");
+        QJSUtils::JsStdDumpErrorAce(ctx, JsErrorType::EVAL_BUFFER_ERROR, instanceId);
+        ret = JS_CALL_FAIL;
+    }
+    JS_FreeValue(ctx, val);
+    js_std_loop(ctx);
+    return ret;
+}
+
 JSValue CallReadObject(JSContext* ctx, const uint8_t* buf, size_t bufLen, bool persist = false, int32_t instanceId = 0,
     const char* pageUrl = nullptr)
 {
@@ -3264,22 +3282,26 @@ void QjsEngine::GetLoadOptions(std::string& optionStr, bool isMainPage, const Re
 
     if (isMainPage) {
         JSContext* ctx = engineInstance_->GetQjsContext();
+        int64_t commonsSavedTime = 0;
+        int64_t vendorsSavedTime = 0;
         std::string commonsJsContent;
         if (engineInstance_->GetDelegate()->GetAssetContent("commons.js", commonsJsContent)) {
-            auto commonsJsResult = CallEvalBuf(ctx, commonsJsContent.c_str(), commonsJsContent.size(),
-                "commons.js", JS_EVAL_TYPE_MODULE, instanceId_);
+            auto commonsJsResult = CallEvalBufWithCache(
+                ctx, commonsJsContent, "commons.js", JS_EVAL_TYPE_MODULE, instanceId_, commonsSavedTime);
             if (commonsJsResult == JS_CALL_FAIL) {
                 LOGE("fail to excute load commonsjs script");
             }
         }
         std::string vendorsJsContent;
         if (engineInstance_->GetDelegate()->GetAssetContent("vendors.js", vendorsJsContent)) {
-            bool vendorsJsResult = CallEvalBuf(ctx, vendorsJsContent.c_str(), vendorsJsContent.size(),
-                "vendors.js", JS_EVAL_TYPE_MODULE, instanceId_);
+            auto vendorsJsResult = CallEvalBufWithCache(
+                ctx, vendorsJsContent, "vendors.js", JS_EVAL_TYPE_MODULE, instanceId_, vendorsSavedTime);
             if (vendorsJsResult == JS_CALL_FAIL) {
                 LOGE("fail to excute load vendorsjs script");
             }
         }
+        LOGI("QjsEngine bytecode cache saved %{public}lld us of startup",
+            static_cast<long long>(commonsSavedTime + vendorsSavedTime));
         std::string code;
         std::string appMap;
         if (engineInstance_->GetDelegate()->GetAssetContent("app.js.map", appMap)) {
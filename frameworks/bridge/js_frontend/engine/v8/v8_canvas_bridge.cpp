@@ -76,13 +76,12 @@ void PushTaskToPage(const v8::Local<v8::Context>& context, v8::Local<v8::Object>
     v8::HandleScope handleScope(isolate);
     NodeId id = GetCurrentNodeId(context, value);
 
-    auto command = Referenced::MakeRefPtr<JsCommandContextOperation>(id, task);
-    // push command
     auto page = static_cast<RefPtr<JsAcePage>*>(isolate->GetData(V8EngineInstance::RUNNING_PAGE));
     if (!page) {
         return;
     }
-    (*page)->PushCommand(command);
+    // Calls following each other are sent to ui thread as one command.
+    (*page)->GetCanvasDisplayList(id)->PushTask(task);
 }
 
 void PushTaskToPageById(const v8::Local<v8::Context>& context, NodeId id,
@@ -91,13 +90,11 @@ void PushTaskToPageById(const v8::Local<v8::Context>& context, NodeId id,
     v8::Isolate* isolate = context->GetIsolate();
     v8::HandleScope handleScope(isolate);
 
-    auto command = Referenced::MakeRefPtr<JsCommandContextOperation>(id, task);
-    // push command
     auto page = static_cast<RefPtr<JsAcePage>*>(isolate->GetData(V8EngineInstance::RUNNING_PAGE));
     if (!page) {
         return;
     }
-    (*page)->PushCommand(command);
+    (*page)->GetCanvasDisplayList(id)->PushTask(task);
 }
 
 inline std::vector<double> GetDashValue(const v8::FunctionCallbackInfo<v8::Value>& args, uint32_t index)
@@ -142,6 +142,12 @@ public:
     virtual bool GetAssetContent(const std::string& url, std::vector<uint8_t>& content) = 0;
     virtual std::string GetAssetPath(const std::string& url) = 0;
 
+    // Take the bundle of page which has been read ahead of router push, false if the page is not preloaded.
+    virtual bool TakePreloadedPage(const std::string& url, std::vector<uint8_t>& bin, std::string& sourceMap)
+    {
+        return false;
+    }
+
     virtual void WaitTimer(const std::string& callbackId, const std::string& delay, bool isInterval, bool isFirst) = 0;
     virtual void ClearTimer(const std::string& callbackId) = 0;
 
@@ -181,6 +181,20 @@ void JsAcePage::SwapBackgroundDecoration(const RefPtr<PageTransitionComponent>&
     box->SetBackDecoration(nullptr);
 }
 
+RefPtr<CanvasDisplayList> JsAcePage::GetCanvasDisplayList(NodeId nodeId)
+{
+    // Only append to the last command, otherwise the draw calls would be moved before other commands of the page.
+    if (lastDisplayListCommand_ && !jsCommands_.empty() &&
+        jsCommands_.back().GetRawPtr() == lastDisplayListCommand_.GetRawPtr() &&
+        lastDisplayListCommand_->GetNodeId() == nodeId) {
+        return lastDisplayListCommand_->GetDisplayList();
+    }
+    auto displayList = AceType::MakeRefPtr<CanvasDisplayList>();
+    lastDisplayListCommand_ = Referenced::MakeRefPtr<JsCommandCanvasDisplayList>(nodeId, displayList);
+    jsCommands_.emplace_back(lastDisplayListCommand_);
+    return displayList;
+}
+
 RefPtr<BaseCanvasBridge> JsAcePage::GetBridgeById(NodeId nodeId)
 {
     std::unique_lock<std::mutex> lock(bridgeMutex_);
@@ -89,6 +89,10 @@ public:
         jsCommands_.emplace_back(jsCommand);
     }
 
+    // Returns the display list of the canvas to record draw calls into. Calls following each other are appended to
+    // the same list, so that they are sent to ui thread as one command.
+    RefPtr<CanvasDisplayList> GetCanvasDisplayList(NodeId nodeId);
+
     void PopAllCommands(std::vector<RefPtr<JsCommand>>& jsCommands)
     {
         jsCommands = std::move(jsCommands_);
@@ -377,6 +381,7 @@ private:
     std::string pluginComponentJsonData_;
 
     std::vector<RefPtr<JsCommand>> jsCommands_;
+    RefPtr<JsCommandCanvasDisplayList> lastDisplayListCommand_;
     std::vector<NodeId> dirtyNodesOrderedByTime_;
     std::unordered_set<NodeId> dirtyNodes_;
     std::mutex cmdMutex_;
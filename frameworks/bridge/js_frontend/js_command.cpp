@@ -17,6 +17,7 @@
 
 #include "base/log/event_report.h"
 #include "base/log/log.h"
+#include "frameworks/bridge/common/accessibility/accessibility_node_manager.h"
 #include "frameworks/bridge/common/dom/dom_proxy.h"
 #include "frameworks/bridge/common/dom/dom_search.h"
 #include "frameworks/bridge/common/dom/dom_textarea.h"
@@ -38,6 +39,22 @@ inline RefPtr<DOMNode> GetNodeFromPage(const RefPtr<JsAcePage>& page, NodeId nod
     return nullptr;
 }
 
+RefPtr<CanvasTaskPool> GetCanvasTaskPool(const RefPtr<JsAcePage>& page, NodeId nodeId)
+{
+    auto canvas = AceType::DynamicCast<DOMCanvas>(GetNodeFromPage(page, nodeId));
+    if (!canvas) {
+        LOGE("Node %{private}d not exists or not a canvas", nodeId);
+        return nullptr;
+    }
+    auto paintChild = AceType::DynamicCast<CustomPaintComponent>(canvas->GetSpecializedComponent());
+    ACE_DCHECK(paintChild);
+    auto pool = paintChild->GetTaskPool();
+    if (!pool) {
+        LOGE("canvas get pool failed");
+    }
+    return pool;
+}
+
 inline RefPtr<AccessibilityManager> GetAccessibilityManager(const RefPtr<JsAcePage>& page)
 {
     if (!page) {
@@ -400,6 +417,12 @@ void JsCommandCreateDomBody::Execute(const RefPtr<JsAcePage>& page) const
     }
 
     accessibilityManager->SetRootNodeId(domDocument->GetRootNodeId());
+    auto nodeManager = AceType::DynamicCast<AccessibilityNodeManager>(accessibilityManager);
+    if (nodeManager &&
+        nodeManager->DeferAccessibilityNode(tagName_, nodeId_, -1, itemIndex_, page->GetPageId(), events_)) {
+        nodeManager->UpdateDeferredAccessibilityNode(nodeId_, id_, target_, attrs_);
+        return;
+    }
     auto accessibilityNode = accessibilityManager->CreateAccessibilityNode(tagName_, nodeId_, -1, itemIndex_);
     if (!accessibilityNode) {
         LOGD("Failed to create accessibility node %{public}s", tagName_.c_str());
@@ -463,6 +486,12 @@ void JsCommandAddDomElement::Execute(const RefPtr<JsAcePage>& page) const
     if (tagName_ == DOM_NODE_TAG_OPTION) {
         return; // option of menu and select for popup do not need auto creating
     }
+    auto nodeManager = AceType::DynamicCast<AccessibilityNodeManager>(accessibilityManager);
+    if (nodeManager && nodeManager->DeferAccessibilityNode(
+                           tagName_, nodeId_, parentNodeId_, itemIndex_, page->GetPageId(), events_)) {
+        nodeManager->UpdateDeferredAccessibilityNode(nodeId_, id_, target_, attrs_);
+        return;
+    }
     auto accessibilityNode =
         accessibilityManager->CreateAccessibilityNode(tagName_, nodeId_, parentNodeId_, itemIndex_);
     if (!accessibilityNode) {
@@ -514,6 +543,10 @@ void JsCommandRemoveDomElement::Execute(const RefPtr<JsAcePage>& page) const
         LOGW("accessibilityManager not exists");
         return;
     }
+    auto nodeManager = AceType::DynamicCast<AccessibilityNodeManager>(accessibilityManager);
+    if (nodeManager && nodeManager->RemoveDeferredAccessibilityNode(nodeId_)) {
+        return;
+    }
     auto accessibilityNode = accessibilityManager->GetAccessibilityNodeById(nodeId_);
     if (!accessibilityNode) {
         LOGE("Accessibility Node %{private}d not exists", nodeId_);
@@ -588,6 +621,10 @@ void JsCommandUpdateDomElementAttrs::Execute(const RefPtr<JsAcePage>& page) cons
         LOGW("accessibilityManager not exists");
         return;
     }
+    auto nodeManager = AceType::DynamicCast<AccessibilityNodeManager>(accessibilityManager);
+    if (nodeManager && nodeManager->UpdateDeferredAccessibilityNode(nodeId_, id_, target_, attrs_)) {
+        return;
+    }
     auto accessibilityNode = accessibilityManager->GetAccessibilityNodeById(nodeId_);
     if (!accessibilityNode) {
         LOGE("Accessibility Node %{private}d not exists", nodeId_);
@@ -653,19 +690,23 @@ void JsCommandContextOperation::Execute(const RefPtr<JsAcePage>& page) const
     if (!task_) {
         return;
     }
-    auto canvas = AceType::DynamicCast<DOMCanvas>(GetNodeFromPage(page, nodeId_));
-    if (!canvas) {
-        LOGE("Node %{private}d not exists or not a canvas", nodeId_);
+    auto pool = GetCanvasTaskPool(page, nodeId_);
+    if (!pool) {
         return;
     }
-    auto paintChild = AceType::DynamicCast<CustomPaintComponent>(canvas->GetSpecializedComponent());
-    ACE_DCHECK(paintChild);
-    auto pool = paintChild->GetTaskPool();
+    task_(pool);
+}
+
+void JsCommandCanvasDisplayList::Execute(const RefPtr<JsAcePage>& page) const
+{
+    if (!displayList_ || displayList_->IsEmpty()) {
+        return;
+    }
+    auto pool = GetCanvasTaskPool(page, nodeId_);
     if (!pool) {
-        LOGE("canvas get pool failed");
         return;
     }
-    task_(pool);
+    displayList_->Replay(pool);
 }
 
 void JsCommandXComponentOperation::Execute(const RefPtr<JsAcePage>& page) const
@@ -34,6 +34,7 @@
 #include "frameworks/bridge/common/dom/dom_stepper.h"
 #include "frameworks/bridge/common/dom/dom_stepper_item.h"
 #include "frameworks/bridge/common/dom/dom_xcomponent.h"
+#include "frameworks/bridge/js_frontend/engine/common/canvas_display_list.h"
 
 namespace OHOS::Ace::Framework {
 
@@ -333,6 +334,30 @@ private:
     std::function<void(const RefPtr<CanvasTaskPool>&)> task_;
 };
 
+// Replays all draw calls recorded for a canvas since last command, instead of one command per call.
+class ACE_EXPORT JsCommandCanvasDisplayList final : public JsCommand {
+public:
+    JsCommandCanvasDisplayList(NodeId nodeId, const RefPtr<CanvasDisplayList>& displayList)
+        : nodeId_(nodeId), displayList_(displayList)
+    {}
+    ~JsCommandCanvasDisplayList() final = default;
+    void Execute(const RefPtr<JsAcePage>& page) const final;
+
+    NodeId GetNodeId() const
+    {
+        return nodeId_;
+    }
+
+    const RefPtr<CanvasDisplayList>& GetDisplayList() const
+    {
+        return displayList_;
+    }
+
+private:
+    NodeId nodeId_ = -1;
+    RefPtr<CanvasDisplayList> displayList_;
+};
+
 class ACE_EXPORT JsCommandXComponentOperation final : public JsCommand {
 public:
     JsCommandXComponentOperation(NodeId nodeId, std::function<void(const RefPtr<XComponentTaskPool>&)> task)
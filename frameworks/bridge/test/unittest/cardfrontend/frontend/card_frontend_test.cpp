@@ -15,7 +15,18 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#define private public
+#include "frameworks/bridge/card_frontend/card_template_pool.h"
+#undef private
 #include "frameworks/bridge/card_frontend/js_card_parser.h"
+#include "frameworks/bridge/common/dom/dom_document.h"
 #include "frameworks/bridge/common/utils/utils.h"
 
 using namespace testing;
@@ -25,6 +36,67 @@ namespace OHOS::Ace::Framework {
 namespace {
 
 constexpr int32_t COMMAND_SIZE = 1;
+constexpr size_t WARM_POOL_SIZE = 2;
+constexpr size_t CONCURRENT_CARDS = 30;
+constexpr int32_t REFILL_WAIT_TIMES = 100;
+constexpr int32_t REFILL_WAIT_MS = 10;
+const std::string POOLED_CARD = "{\n"
+                                "\t\"template\": {\n"
+                                "\t\t\"type\": \"div\",\n"
+                                "\t\t\"children\": [{\n"
+                                "\t\t\t\"attr\": {\"value\": \"{{title}}\"},\n"
+                                "\t\t\t\"type\": \"text\"\n"
+                                "\t\t}]\n"
+                                "\t},\n"
+                                "\t\"styles\": {},\n"
+                                "\t\"actions\": {},\n"
+                                "\t\"data\": {\n"
+                                "\t\t\"title\": \"hello\"\n"
+                                "\t}\n"
+                                "}";
+
+void WaitForRefill(const std::string& content, size_t count)
+{
+    for (int32_t i = 0; i < REFILL_WAIT_TIMES; ++i) {
+        if (CardTemplatePool::GetInstance().GetWarmCount(content) >= count) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(REFILL_WAIT_MS));
+    }
+}
+
+// Returns the template to be checked out next for |content|, or nullptr if the pool holds none.
+const JsonValue* GetNextWarmTemplate(const std::string& content)
+{
+    auto& pool = CardTemplatePool::GetInstance();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    auto iter = pool.FindEntryLocked(std::hash<std::string> {}(content), content);
+    if (iter == pool.entries_.end() || iter->templates.empty()) {
+        return nullptr;
+    }
+    return iter->templates.front().get();
+}
+
+int64_t StartCards(size_t count)
+{
+    int64_t begin = GetMicroTickCount();
+    std::vector<std::thread> cards;
+    for (size_t i = 0; i < count; ++i) {
+        cards.emplace_back([]() {
+            auto rootBody = CardTemplatePool::GetInstance().CheckOut(POOLED_CARD);
+            ASSERT_TRUE(rootBody);
+            auto jsCardParser = AceType::MakeRefPtr<JsCardParser>(nullptr, nullptr, std::move(rootBody));
+            ASSERT_TRUE(jsCardParser->Initialize());
+            auto page = AceType::MakeRefPtr<JsAcePage>(0, AceType::MakeRefPtr<DOMDocument>(0), "");
+            jsCardParser->UpdatePageData("{\"title\": \"world\"}", page);
+            EXPECT_GT(page->GetCommandSize(), 0UL);
+        });
+    }
+    for (auto& card : cards) {
+        card.join();
+    }
+    return GetMicroTickCount() - begin;
+}
 
 } // namespace
 
@@ -1421,4 +1493,156 @@ HWTEST_F(CardFrontendTest, CardFrontendDataBindingTest016, TestSize.Level1)
     ASSERT_EQ(value, "true");
 }
 
-} // namespace OHOS::Ace::Framework
\ No newline at end of file
+/**
+ * @tc.name: CardFrontendPartialUpdateTest001
+ * @tc.desc: Test data update only updates nodes bound to the changed keys.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardFrontendPartialUpdateTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. construct a card with a static div and two texts bound to different keys.
+     */
+    const std::string rootJson = "{\n"
+                                 "\t\"template\": {\n"
+                                 "\t\t\"type\": \"div\",\n"
+                                 "\t\t\"children\": [{\n"
+                                 "\t\t\t\"attr\": {\"value\": \"{{title}}\"},\n"
+                                 "\t\t\t\"type\": \"text\"\n"
+                                 "\t\t}, {\n"
+                                 "\t\t\t\"attr\": {\"value\": \"$f({{count}} of {{title}})\"},\n"
+                                 "\t\t\t\"type\": \"text\"\n"
+                                 "\t\t}]\n"
+                                 "\t},\n"
+                                 "\t\"styles\": {},\n"
+                                 "\t\"actions\": {},\n"
+                                 "\t\"data\": {\n"
+                                 "\t\t\"title\": \"hello\",\n"
+                                 "\t\t\"count\": \"1\",\n"
+                                 "\t\t\"unused\": \"1\"\n"
+                                 "\t}\n"
+                                 "}";
+    auto rootBody = JsonUtil::ParseJsonString(rootJson);
+    auto jsCardParser = AceType::MakeRefPtr<JsCardParser>(nullptr, nullptr, std::move(rootBody));
+    ASSERT_TRUE(jsCardParser->Initialize());
+    auto document = AceType::MakeRefPtr<DOMDocument>(0);
+    auto page = AceType::MakeRefPtr<JsAcePage>(0, document, "");
+
+    /**
+     * @tc.steps: step2. push data for the first time.
+     * @tc.expected: step2. the whole template is updated and bound nodes are indexed.
+     */
+    jsCardParser->UpdatePageData("{\"title\": \"world\"}", page);
+    EXPECT_EQ(page->GetCommandSize(), 6UL);
+    EXPECT_EQ(jsCardParser->GetBoundNodeCount(), 2UL);
+
+    /**
+     * @tc.steps: step3. push data of a key bound to the second text only.
+     * @tc.expected: step3. only attrs and styles of the second text are updated.
+     */
+    jsCardParser->UpdatePageData("{\"count\": \"2\"}", page);
+    EXPECT_EQ(page->GetCommandSize(), 8UL);
+
+    /**
+     * @tc.steps: step4. push unchanged data and data of a key bound to no node.
+     * @tc.expected: step4. nothing is updated.
+     */
+    jsCardParser->UpdatePageData("{\"count\": \"2\", \"unused\": \"2\"}", page);
+    EXPECT_EQ(page->GetCommandSize(), 8UL);
+
+    /**
+     * @tc.steps: step5. push data of a key bound to both texts.
+     * @tc.expected: step5. both texts are updated.
+     */
+    jsCardParser->UpdatePageData("{\"title\": \"again\"}", page);
+    EXPECT_EQ(page->GetCommandSize(), 12UL);
+}
+
+/**
+ * @tc.name: CardTemplatePoolTest001
+ * @tc.desc: Test cards of the same page check out independent templates from the pool.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardTemplatePoolTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. check out the template of a page for the first time.
+     * @tc.expected: step1. the template is parsed and the page is not warmed up.
+     */
+    auto& pool = CardTemplatePool::GetInstance();
+    pool.Clear();
+    pool.SetWarmPoolSize(WARM_POOL_SIZE);
+    auto first = pool.CheckOut(POOLED_CARD);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(pool.GetWarmCount(POOLED_CARD), 0UL);
+
+    /**
+     * @tc.steps: step2. check out the template of the page again.
+     * @tc.expected: step2. the template is parsed and the pool is refilled in background.
+     */
+    auto second = pool.CheckOut(POOLED_CARD);
+    ASSERT_TRUE(second);
+    WaitForRefill(POOLED_CARD, WARM_POOL_SIZE);
+    EXPECT_EQ(pool.GetWarmCount(POOLED_CARD), WARM_POOL_SIZE);
+
+    /**
+     * @tc.steps: step3. check out the template once more and modify the first one.
+     * @tc.expected: step3. the third template is taken from the pool and not affected.
+     */
+    auto warmTemplate = GetNextWarmTemplate(POOLED_CARD);
+    ASSERT_TRUE(warmTemplate);
+    auto third = pool.CheckOut(POOLED_CARD);
+    ASSERT_TRUE(third);
+    EXPECT_EQ(third.get(), warmTemplate);
+    first->GetValue("data")->Replace("title", "world");
+    EXPECT_EQ(third->GetValue("data")->GetString("title"), "hello");
+    EXPECT_EQ(third->ToString(), JsonUtil::ParseJsonString(POOLED_CARD)->ToString());
+
+    /**
+     * @tc.steps: step4. check out an invalid page and disable the pool.
+     * @tc.expected: step4. the invalid page gets no template and no template is kept after disabled.
+     */
+    EXPECT_FALSE(pool.CheckOut("{\"template\": "));
+    pool.SetWarmPoolSize(0);
+    EXPECT_EQ(pool.GetWarmCount(POOLED_CARD), 0UL);
+    EXPECT_TRUE(pool.CheckOut(POOLED_CARD));
+    EXPECT_EQ(pool.GetWarmCount(POOLED_CARD), 0UL);
+    pool.SetWarmPoolSize(WARM_POOL_SIZE);
+}
+
+/**
+ * @tc.name: CardTemplatePoolTest002
+ * @tc.desc: Measure the time to first frame data of cards started concurrently.
+ * @tc.type: PERF
+ */
+HWTEST_F(CardFrontendTest, CardTemplatePoolTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. start cards of the same page concurrently without pool.
+     */
+    auto& pool = CardTemplatePool::GetInstance();
+    pool.Clear();
+    pool.SetWarmPoolSize(0);
+    int64_t coldCost = StartCards(CONCURRENT_CARDS);
+
+    /**
+     * @tc.steps: step2. start them again with a warm pool.
+     * @tc.expected: step2. the page is warmed up after checked out twice, the next card is served from the pool and
+     *                    every card gets its template and renders its data.
+     */
+    pool.SetWarmPoolSize(WARM_POOL_SIZE);
+    pool.CheckOut(POOLED_CARD);
+    pool.CheckOut(POOLED_CARD);
+    WaitForRefill(POOLED_CARD, WARM_POOL_SIZE);
+    ASSERT_EQ(pool.GetWarmCount(POOLED_CARD), WARM_POOL_SIZE);
+    auto warmTemplate = GetNextWarmTemplate(POOLED_CARD);
+    ASSERT_TRUE(warmTemplate);
+    auto rootBody = pool.CheckOut(POOLED_CARD);
+    EXPECT_EQ(rootBody.get(), warmTemplate);
+    WaitForRefill(POOLED_CARD, WARM_POOL_SIZE);
+    int64_t warmCost = StartCards(CONCURRENT_CARDS);
+    LOGI("time to first frame of %{public}zu cards: %{public}lld us without pool, %{public}lld us with pool",
+        CONCURRENT_CARDS, static_cast<long long>(coldCost), static_cast<long long>(warmCost));
+}
+
+} // namespace OHOS::Ace::Framework
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "frameworks/bridge/declarative_frontend/frontend_delegate_declarative.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+const std::string MANIFEST = R"({ "pages": [ "pages/index", "pages/first", "pages/second", "pages/third" ] })";
+const std::string INDEX_PAGE = "pages/index.js";
+const std::string FIRST_PAGE = "pages/first.js";
+const std::string SECOND_PAGE = "pages/second.js";
+const std::string THIRD_PAGE = "pages/third.js";
+const std::string SOURCE_MAP = "{}";
+const std::vector<uint8_t> BUNDLE = { 0x50, 0x41, 0x4e, 0x44, 0x41 };
+
+RefPtr<FrontendDelegateDeclarative> CreateDelegate()
+{
+    auto delegate = AceType::MakeRefPtr<FrontendDelegateDeclarative>(nullptr, nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+        nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    delegate->manifestParser_->Parse(MANIFEST);
+    return delegate;
+}
+
+void PushRoute(const RefPtr<FrontendDelegateDeclarative>& delegate, int32_t pageId, const std::string& url)
+{
+    PageInfo pageInfo;
+    pageInfo.pageId = pageId;
+    pageInfo.url = url;
+    delegate->pageRouteStack_.emplace_back(pageInfo);
+}
+
+void AddPreloadedPage(const RefPtr<FrontendDelegateDeclarative>& delegate, const std::string& url)
+{
+    FrontendDelegateDeclarative::PreloadedPage preloadedPage;
+    preloadedPage.bin = BUNDLE;
+    preloadedPage.sourceMap = SOURCE_MAP;
+    delegate->preloadedPages_[url] = std::move(preloadedPage);
+}
+
+} // namespace
+
+class FrontendDelegateDeclarativeTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: PreloadPages001
+ * @tc.desc: Test the pages following the current page in manifest are the candidates of preloading.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrontendDelegateDeclarativeTest, PreloadPages001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Push the first page of manifest.
+     * @tc.expected: step1. The next two pages are the candidates.
+     */
+    auto delegate = CreateDelegate();
+    PushRoute(delegate, 0, INDEX_PAGE);
+    delegate->UpdatePreloadCandidates(INDEX_PAGE);
+    EXPECT_EQ(delegate->preloadCandidates_, std::list<std::string>({ FIRST_PAGE, SECOND_PAGE }));
+
+    /**
+     * @tc.steps: step2. Push the second page of manifest over a route stack which has the third page.
+     * @tc.expected: step2. Pages on the route stack are not candidates.
+     */
+    PushRoute(delegate, 1, THIRD_PAGE);
+    PushRoute(delegate, 2, FIRST_PAGE);
+    delegate->UpdatePreloadCandidates(FIRST_PAGE);
+    EXPECT_EQ(delegate->preloadCandidates_, std::list<std::string>({ SECOND_PAGE }));
+
+    /**
+     * @tc.steps: step3. Push the last page of manifest, then a page which is not in manifest.
+     * @tc.expected: step3. There is no candidate.
+     */
+    delegate->UpdatePreloadCandidates(THIRD_PAGE);
+    EXPECT_TRUE(delegate->preloadCandidates_.empty());
+    delegate->UpdatePreloadCandidates("pages/unknown.js");
+    EXPECT_TRUE(delegate->preloadCandidates_.empty());
+}
+
+/**
+ * @tc.name: PreloadPages002
+ * @tc.desc: Test preloaded pages are taken once and dropped when they are no longer candidates.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrontendDelegateDeclarativeTest, PreloadPages002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Preload the two pages following the first page.
+     * @tc.expected: step1. Preloaded pages are not candidates again.
+     */
+    auto delegate = CreateDelegate();
+    PushRoute(delegate, 0, INDEX_PAGE);
+    AddPreloadedPage(delegate, FIRST_PAGE);
+    AddPreloadedPage(delegate, SECOND_PAGE);
+    delegate->UpdatePreloadCandidates(INDEX_PAGE);
+    EXPECT_TRUE(delegate->preloadCandidates_.empty());
+    EXPECT_EQ(delegate->preloadedPages_.size(), 2u);
+
+    /**
+     * @tc.steps: step2. Take the first page twice.
+     * @tc.expected: step2. The bundle and source map are taken the first time only.
+     */
+    std::vector<uint8_t> bin;
+    std::string sourceMap;
+    EXPECT_TRUE(delegate->TakePreloadedPage(FIRST_PAGE, bin, sourceMap));
+    EXPECT_EQ(bin, BUNDLE);
+    EXPECT_EQ(sourceMap, SOURCE_MAP);
+    bin.clear();
+    sourceMap.clear();
+    EXPECT_FALSE(delegate->TakePreloadedPage(FIRST_PAGE, bin, sourceMap));
+    EXPECT_TRUE(bin.empty());
+    EXPECT_TRUE(sourceMap.empty());
+
+    /**
+     * @tc.steps: step3. Push the second page.
+     * @tc.expected: step3. The preloaded second page is dropped and the third page is the candidate.
+     */
+    PushRoute(delegate, 1, SECOND_PAGE);
+    delegate->UpdatePreloadCandidates(SECOND_PAGE);
+    EXPECT_TRUE(delegate->preloadedPages_.empty());
+    EXPECT_EQ(delegate->preloadCandidates_, std::list<std::string>({ THIRD_PAGE }));
+    EXPECT_FALSE(delegate->TakePreloadedPage(SECOND_PAGE, bin, sourceMap));
+}
+
+/**
+ * @tc.name: PreloadPages003
+ * @tc.desc: Test pages are not preloaded when preloading is disallowed for debugging.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrontendDelegateDeclarativeTest, PreloadPages003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Disallow preloading, then push the first page.
+     * @tc.expected: step1. There is no candidate and no page to take.
+     */
+    auto delegate = CreateDelegate();
+    delegate->DisallowPreloadPages();
+    PushRoute(delegate, 0, INDEX_PAGE);
+    delegate->UpdatePreloadCandidates(INDEX_PAGE);
+    EXPECT_TRUE(delegate->preloadCandidates_.empty());
+    delegate->PreloadPages();
+    std::vector<uint8_t> bin;
+    std::string sourceMap;
+    EXPECT_FALSE(delegate->TakePreloadedPage(FIRST_PAGE, bin, sourceMap));
+}
+
+} // namespace OHOS::Ace::Framework
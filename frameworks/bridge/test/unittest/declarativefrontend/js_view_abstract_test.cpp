@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#include "core/components/text/text_component.h"
+#include "frameworks/bridge/declarative_frontend/jsview/js_view_register.h"
+#include "frameworks/bridge/declarative_frontend/view_stack_processor.h"
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_utils.h"
+#define private public
+#include "frameworks/bridge/declarative_frontend/jsview/js_view_abstract.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+// Opcodes of BatchedAttribute, as exported to js by jsEnumStyle.js.
+constexpr int32_t WIDTH = 0;
+constexpr int32_t HEIGHT = 1;
+constexpr int32_t BACKGROUND_COLOR = 2;
+constexpr int32_t OPACITY = 3;
+constexpr int32_t PADDING = 4;
+constexpr int32_t MARGIN = 5;
+constexpr int32_t UNKNOWN_ATTRIBUTE = 100;
+constexpr double WIDTH_VALUE = 100.0;
+constexpr double HEIGHT_VALUE = 50.0;
+constexpr double OPACITY_VALUE = 0.5;
+constexpr double PADDING_VALUE = 4.0;
+constexpr double MARGIN_VALUE = 8.0;
+constexpr int32_t BENCHMARK_VIEWS = 10000;
+
+std::string Opcode(int32_t attribute)
+{
+    return std::to_string(attribute);
+}
+
+const std::string ATTRIBUTES = "[" + Opcode(WIDTH) + ", 100, " + Opcode(HEIGHT) + ", 50, " +
+                               Opcode(BACKGROUND_COLOR) + ", 0xFF0000FF, " + Opcode(OPACITY) + ", 0.5, " +
+                               Opcode(PADDING) + ", 4, " + Opcode(MARGIN) + ", 8]";
+
+bool RunScript(JSContext* ctx, const std::string& script)
+{
+    JSValue result = JS_Eval(ctx, script.c_str(), script.length(), "js_view_abstract_test", JS_EVAL_TYPE_GLOBAL);
+    bool isException = JS_IsException(result);
+    if (isException) {
+        JSValue exception = JS_GetException(ctx);
+        const char* message = JS_ToCString(ctx, exception);
+        LOGE("run script failed: %{public}s", message ? message : "");
+        JS_FreeCString(ctx, message);
+        JS_FreeValue(ctx, exception);
+    }
+    JS_FreeValue(ctx, result);
+    return !isException;
+}
+
+RefPtr<TextComponent> PushText()
+{
+    auto text = AceType::MakeRefPtr<TextComponent>("");
+    ViewStackProcessor::GetInstance()->Push(text);
+    return text;
+}
+
+} // namespace
+
+class JsViewAbstractTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    JSRuntime* runtime_ = nullptr;
+    JSContext* context_ = nullptr;
+};
+
+void JsViewAbstractTest::SetUp()
+{
+    runtime_ = JS_NewRuntime();
+    ASSERT_TRUE(runtime_ != nullptr);
+    context_ = JS_NewContext(runtime_);
+    ASSERT_TRUE(context_ != nullptr);
+    QJSContext::Scope scope(context_);
+    JSValue globalObj = JS_GetGlobalObject(context_);
+    JsRegisterViews(globalObj);
+    JS_FreeValue(context_, globalObj);
+}
+
+void JsViewAbstractTest::TearDown()
+{
+    if (context_) {
+        JS_FreeContext(context_);
+        context_ = nullptr;
+    }
+    if (runtime_) {
+        JS_FreeRuntime(runtime_);
+        runtime_ = nullptr;
+    }
+}
+
+/**
+ * @tc.name: JsAttributes001
+ * @tc.desc: Test the batched attributes are set as the chained calls set them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsViewAbstractTest, JsAttributes001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Set the attributes of a text in one call.
+     * @tc.expected: step1. Every attribute is set on the wrapping components of the text.
+     */
+    QJSContext::Scope scope(context_);
+    ScopedViewStackProcessor viewStackProcessor;
+    auto text = PushText();
+    ASSERT_TRUE(RunScript(context_, "Text.attributes(" + ATTRIBUTES + ");"));
+    auto stack = ViewStackProcessor::GetInstance();
+    auto box = stack->GetBoxComponent();
+    EXPECT_EQ(box->GetWidthDimension(), Dimension(WIDTH_VALUE, DimensionUnit::VP));
+    EXPECT_EQ(box->GetHeightDimension(), Dimension(HEIGHT_VALUE, DimensionUnit::VP));
+    EXPECT_EQ(box->GetColor(), Color::BLUE);
+    EXPECT_DOUBLE_EQ(stack->GetDisplayComponent()->GetOpacity(), OPACITY_VALUE);
+    EXPECT_EQ(box->GetPadding().Top(), Dimension(PADDING_VALUE, DimensionUnit::VP));
+    EXPECT_EQ(box->GetMargin().Top(), Dimension(MARGIN_VALUE, DimensionUnit::VP));
+
+    /**
+     * @tc.steps: step2. Check the parts of width and height which only the setters of Text set.
+     * @tc.expected: step2. Width and height are set through the setters bound by Text.
+     */
+    EXPECT_TRUE(text->GetMaxWidthLayout());
+    EXPECT_TRUE(box->GetBoxClipFlag());
+}
+
+/**
+ * @tc.name: JsAttributes002
+ * @tc.desc: Test only the attributes a class binds setters of its own for are set through js.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsViewAbstractTest, JsAttributes002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Get the batched attributes registered for Text and Image.
+     * @tc.expected: step1. Only width and height of Text, and opacity of Image go through their setters.
+     */
+    auto& setterMasks = JSViewAbstract::batchedSetterMasks_;
+    ASSERT_EQ(setterMasks.count("Text"), 1UL);
+    EXPECT_EQ(setterMasks["Text"], (1u << WIDTH) | (1u << HEIGHT));
+    ASSERT_EQ(setterMasks.count("Image"), 1UL);
+    EXPECT_EQ(setterMasks["Image"], 1u << OPACITY);
+
+    /**
+     * @tc.steps: step2. Get the batched attributes registered for Divider, which binds no setter of its own.
+     * @tc.expected: step2. Nothing is registered, every attribute of it is set natively.
+     */
+    EXPECT_EQ(setterMasks.count("Divider"), 0UL);
+}
+
+/**
+ * @tc.name: JsAttributes003
+ * @tc.desc: Test malformed attributes are skipped and the others are still set.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsViewAbstractTest, JsAttributes003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Set attributes with an unknown opcode, an opcode which is not a number and a missing value.
+     * @tc.expected: step1. The malformed attributes are skipped, the width is set.
+     */
+    QJSContext::Scope scope(context_);
+    ScopedViewStackProcessor viewStackProcessor;
+    PushText();
+    std::string attributes = "[" + Opcode(UNKNOWN_ATTRIBUTE) + ", 1, 'width', 1, " + Opcode(WIDTH) + ", 100, " +
+                             Opcode(OPACITY) + "]";
+    ASSERT_TRUE(RunScript(context_, "Text.attributes(" + attributes + ");"));
+    auto stack = ViewStackProcessor::GetInstance();
+    EXPECT_EQ(stack->GetBoxComponent()->GetWidthDimension(), Dimension(WIDTH_VALUE, DimensionUnit::VP));
+    EXPECT_DOUBLE_EQ(stack->GetDisplayComponent()->GetOpacity(), 1.0);
+
+    /**
+     * @tc.steps: step2. Set attributes with values of wrong types, and call attributes without an array.
+     * @tc.expected: step2. Nothing is set, and no exception is thrown to js.
+     */
+    auto box = stack->GetBoxComponent();
+    Edge padding = box->GetPadding();
+    Color color = box->GetColor();
+    attributes = "[" + Opcode(PADDING) + ", true, " + Opcode(BACKGROUND_COLOR) + ", undefined]";
+    ASSERT_TRUE(RunScript(context_, "Text.attributes(" + attributes + "); Text.attributes(1);"));
+    EXPECT_EQ(box->GetPadding(), padding);
+    EXPECT_EQ(box->GetColor(), color);
+}
+
+/**
+ * @tc.name: JsAttributesBenchmark001
+ * @tc.desc: Compare setting the attributes of views in one call with setting them by chained calls.
+ * @tc.type: PERF
+ */
+HWTEST_F(JsViewAbstractTest, JsAttributesBenchmark001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Set six attributes of many texts by chained calls, then in one call for each text.
+     * @tc.expected: step1. Both scripts run, the cost of each is logged.
+     */
+    QJSContext::Scope scope(context_);
+    ScopedViewStackProcessor viewStackProcessor;
+    PushText();
+    std::string count = std::to_string(BENCHMARK_VIEWS);
+    std::string chained = "for (let i = 0; i < " + count + "; i++) { Text.width(100); Text.height(50); "
+                          "Text.backgroundColor(0xFF0000FF); Text.opacity(0.5); Text.padding(4); Text.margin(8); }";
+    std::string batched = "for (let i = 0; i < " + count + "; i++) { Text.attributes(" + ATTRIBUTES + "); }";
+    int64_t begin = GetMicroTickCount();
+    ASSERT_TRUE(RunScript(context_, chained));
+    int64_t chainedCost = GetMicroTickCount() - begin;
+    begin = GetMicroTickCount();
+    ASSERT_TRUE(RunScript(context_, batched));
+    int64_t batchedCost = GetMicroTickCount() - begin;
+    LOGI("time to set attributes of %{public}d views: %{public}lld us chained, %{public}lld us batched",
+        BENCHMARK_VIEWS, static_cast<long long>(chainedCost), static_cast<long long>(batchedCost));
+}
+
+} // namespace OHOS::Ace::Framework
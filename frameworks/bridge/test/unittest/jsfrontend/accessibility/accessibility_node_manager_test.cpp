@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "base/log/log.h"
+#include "base/json/json_util.h"
+#include "core/common/ace_application_info.h"
+#define private public
+#define protected public
+#include "frameworks/bridge/common/accessibility/accessibility_node_manager.h"
+#undef private
+#undef protected
+#include "frameworks/bridge/common/dom/dom_type.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr int32_t PAGE_ID = 1;
+const int32_t ROOT_NODE_ID = DOM_ROOT_NODE_ID_BASE + PAGE_ID;
+const int32_t DIV_NODE_ID = ROOT_NODE_ID + 1;
+const int32_t TEXT_NODE_ID = ROOT_NODE_ID + 2;
+const int32_t REMOVED_NODE_ID = ROOT_NODE_ID + 3;
+constexpr int32_t PERF_NODE_COUNT = 5000;
+constexpr int32_t UPDATE_COUNT = 100;
+
+RefPtr<AccessibilityNodeManager> CreateManager()
+{
+    auto manager = AceType::MakeRefPtr<AccessibilityNodeManager>();
+    manager->SetRootNodeId(ROOT_NODE_ID);
+    return manager;
+}
+
+int64_t GetElapsedMicroseconds(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+class AccessibilityNodeManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp()
+    {
+        AceApplicationInfo::GetInstance().SetAccessibilityEnabled(false);
+    }
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: DeferredAccessibilityNode001
+ * @tc.desc: Test the accessibility nodes of dom nodes are recorded in lazy mode and created in order later.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AccessibilityNodeManagerTest, DeferredAccessibilityNode001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Record a page with a div, which has two texts, then update and remove the texts.
+     * @tc.expected: step1. No accessibility node is created.
+     */
+    auto manager = CreateManager();
+    ASSERT_TRUE(manager->IsLazyMode());
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1, PAGE_ID, {}));
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, DIV_NODE_ID, ROOT_NODE_ID, -1, PAGE_ID, {}));
+    EXPECT_TRUE(
+        manager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, TEXT_NODE_ID, DIV_NODE_ID, -1, PAGE_ID, { "click" }));
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, REMOVED_NODE_ID, DIV_NODE_ID, -1, PAGE_ID, {}));
+    EXPECT_TRUE(manager->UpdateDeferredAccessibilityNode(TEXT_NODE_ID, "", "", { { "value", "first" } }));
+    EXPECT_TRUE(manager->UpdateDeferredAccessibilityNode(TEXT_NODE_ID, "", "", { { "value", "second" } }));
+    EXPECT_TRUE(manager->RemoveDeferredAccessibilityNode(REMOVED_NODE_ID));
+    EXPECT_EQ(manager->GetDeferredNodeCount(), 3u);
+    EXPECT_EQ(manager->GetAccessibilityNodeById(ROOT_NODE_ID), nullptr);
+    EXPECT_EQ(manager->GetAccessibilityNodeById(TEXT_NODE_ID), nullptr);
+
+    /**
+     * @tc.steps: step2. Create the deferred nodes.
+     * @tc.expected: step2. The nodes are created with the tree, attributes and events recorded.
+     */
+    manager->CreateDeferredAccessibilityNodes();
+    EXPECT_EQ(manager->GetDeferredNodeCount(), 0u);
+    auto rootNode = manager->GetAccessibilityNodeById(ROOT_NODE_ID);
+    auto divNode = manager->GetAccessibilityNodeById(DIV_NODE_ID);
+    auto textNode = manager->GetAccessibilityNodeById(TEXT_NODE_ID);
+    ASSERT_TRUE(rootNode && divNode && textNode);
+    EXPECT_EQ(manager->GetAccessibilityNodeById(REMOVED_NODE_ID), nullptr);
+    EXPECT_EQ(divNode->GetParentId(), ROOT_NODE_ID);
+    EXPECT_EQ(textNode->GetParentId(), DIV_NODE_ID);
+    EXPECT_EQ(divNode->GetChildList().size(), 1u);
+    EXPECT_EQ(textNode->GetText(), "second");
+    EXPECT_TRUE(textNode->GetClickableState());
+
+    /**
+     * @tc.steps: step3. Record another node after the nodes are created.
+     * @tc.expected: step3. Lazy mode has ended, the node is not deferred.
+     */
+    EXPECT_FALSE(manager->IsLazyMode());
+    EXPECT_FALSE(manager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, REMOVED_NODE_ID, DIV_NODE_ID, -1, PAGE_ID, {}));
+}
+
+/**
+ * @tc.name: DeferredAccessibilityNode002
+ * @tc.desc: Test nodes under created nodes are not deferred and unknown nodes are left alone.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AccessibilityNodeManagerTest, DeferredAccessibilityNode002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Record a child of a node which is not deferred.
+     * @tc.expected: step1. The child is not deferred, it is created with its parent.
+     */
+    auto manager = CreateManager();
+    EXPECT_FALSE(manager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, TEXT_NODE_ID, DIV_NODE_ID, -1, PAGE_ID, {}));
+
+    /**
+     * @tc.steps: step2. Update and remove nodes which are not deferred, and record a node twice.
+     * @tc.expected: step2. They are not handled as deferred nodes.
+     */
+    EXPECT_FALSE(manager->UpdateDeferredAccessibilityNode(TEXT_NODE_ID, "", "", { { "value", "text" } }));
+    EXPECT_FALSE(manager->RemoveDeferredAccessibilityNode(TEXT_NODE_ID));
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1, PAGE_ID, {}));
+    EXPECT_FALSE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1, PAGE_ID, {}));
+    EXPECT_EQ(manager->GetDeferredNodeCount(), 1u);
+
+    /**
+     * @tc.steps: step3. Remove the root of the page.
+     * @tc.expected: step3. Nothing is left to create.
+     */
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, DIV_NODE_ID, ROOT_NODE_ID, -1, PAGE_ID, {}));
+    EXPECT_TRUE(manager->RemoveDeferredAccessibilityNode(ROOT_NODE_ID));
+    EXPECT_EQ(manager->GetDeferredNodeCount(), 0u);
+    manager->CreateDeferredAccessibilityNodes();
+    EXPECT_EQ(manager->GetAccessibilityNodeById(DIV_NODE_ID), nullptr);
+    EXPECT_TRUE(manager->IsLazyMode());
+}
+
+/**
+ * @tc.name: DeferredAccessibilityNode003
+ * @tc.desc: Measure recording dom nodes against creating their accessibility nodes.
+ * @tc.type: PERF
+ */
+HWTEST_F(AccessibilityNodeManagerTest, DeferredAccessibilityNode003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create the accessibility nodes of a page eagerly.
+     */
+    auto eagerManager = CreateManager();
+    auto start = std::chrono::steady_clock::now();
+    eagerManager->CreateAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1);
+    for (int32_t i = 1; i <= PERF_NODE_COUNT; ++i) {
+        eagerManager->CreateAccessibilityNode(DOM_NODE_TAG_TEXT, ROOT_NODE_ID + i, ROOT_NODE_ID, -1);
+    }
+    int64_t eagerTime = GetElapsedMicroseconds(start);
+
+    /**
+     * @tc.steps: step2. Record the same page in lazy mode.
+     * @tc.expected: step2. No accessibility node is created.
+     */
+    auto lazyManager = CreateManager();
+    start = std::chrono::steady_clock::now();
+    lazyManager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1, PAGE_ID, {});
+    for (int32_t i = 1; i <= PERF_NODE_COUNT; ++i) {
+        lazyManager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, ROOT_NODE_ID + i, ROOT_NODE_ID, -1, PAGE_ID, {});
+    }
+    int64_t lazyTime = GetElapsedMicroseconds(start);
+    EXPECT_EQ(lazyManager->GetDeferredNodeCount(), static_cast<size_t>(PERF_NODE_COUNT + 1));
+    EXPECT_EQ(lazyManager->GetAccessibilityNodeById(ROOT_NODE_ID + PERF_NODE_COUNT), nullptr);
+    ASSERT_NE(eagerManager->GetAccessibilityNodeById(ROOT_NODE_ID + PERF_NODE_COUNT), nullptr);
+
+    /**
+     * @tc.steps: step3. Create the recorded nodes, as done when a client is enabled.
+     * @tc.expected: step3. All the nodes are created.
+     */
+    start = std::chrono::steady_clock::now();
+    lazyManager->CreateDeferredAccessibilityNodes();
+    int64_t replayTime = GetElapsedMicroseconds(start);
+    EXPECT_NE(lazyManager->GetAccessibilityNodeById(ROOT_NODE_ID + PERF_NODE_COUNT), nullptr);
+    GTEST_LOG_(INFO) << PERF_NODE_COUNT << " nodes, created eagerly in " << eagerTime << " us, recorded in "
+                     << lazyTime << " us, created from records in " << replayTime << " us, "
+                     << sizeof(AccessibilityNode) * (PERF_NODE_COUNT + 1)
+                     << " bytes of accessibility nodes not allocated while lazy";
+}
+
+/**
+ * @tc.name: DeferredAccessibilityNode004
+ * @tc.desc: Test a deferred node updated many times keeps only the last id, target and value of each attribute.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AccessibilityNodeManagerTest, DeferredAccessibilityNode004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Record a text and update its id, target and attributes many times.
+     * @tc.expected: step1. One value of each attribute is kept, in the order attributes are first set.
+     */
+    auto manager = CreateManager();
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1, PAGE_ID, {}));
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, TEXT_NODE_ID, ROOT_NODE_ID, -1, PAGE_ID, {}));
+    for (int32_t i = 0; i < UPDATE_COUNT; ++i) {
+        auto index = std::to_string(i);
+        EXPECT_TRUE(manager->UpdateDeferredAccessibilityNode(TEXT_NODE_ID, "id" + index, "target" + index,
+            { { "value", "text" + index }, { "disabled", i % 2 == 0 ? "true" : "false" } }));
+    }
+    EXPECT_TRUE(manager->UpdateDeferredAccessibilityNode(TEXT_NODE_ID, "", "", { { "show", "true" } }));
+    const auto& deferredNode = manager->deferredNodes_[TEXT_NODE_ID];
+    auto lastIndex = std::to_string(UPDATE_COUNT - 1);
+    EXPECT_EQ(deferredNode.id, "id" + lastIndex);
+    EXPECT_EQ(deferredNode.target, "target" + lastIndex);
+    ASSERT_EQ(deferredNode.attrs.size(), 3u);
+    EXPECT_EQ(deferredNode.attrs[0].first, "value");
+    EXPECT_EQ(deferredNode.attrs[0].second, "text" + lastIndex);
+    EXPECT_EQ(deferredNode.attrs[1].first, "disabled");
+    EXPECT_EQ(deferredNode.attrs[1].second, "false");
+    EXPECT_EQ(deferredNode.attrs[2].first, "show");
+
+    /**
+     * @tc.steps: step2. Create the deferred nodes.
+     * @tc.expected: step2. The text is created with the last values, and found by the last id and target.
+     */
+    manager->CreateDeferredAccessibilityNodes();
+    auto textNode = manager->GetAccessibilityNodeById(TEXT_NODE_ID);
+    ASSERT_TRUE(textNode);
+    EXPECT_EQ(textNode->GetText(), "text" + lastIndex);
+    EXPECT_TRUE(textNode->GetEnabledState());
+    EXPECT_EQ(manager->nodeWithIdMap_.count("id" + lastIndex), 1u);
+    EXPECT_EQ(manager->nodeWithIdMap_.count("id0"), 0u);
+    EXPECT_EQ(manager->nodeWithTargetMap_.count("target" + lastIndex), 1u);
+    EXPECT_EQ(manager->nodeWithTargetMap_.count("target0"), 0u);
+}
+
+/**
+ * @tc.name: DeferredAccessibilityNode005
+ * @tc.desc: Test the inspector gets deferred nodes, which are created when inspected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AccessibilityNodeManagerTest, DeferredAccessibilityNode005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Record a page with a text in lazy mode.
+     */
+    auto manager = CreateManager();
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_DIV, ROOT_NODE_ID, -1, -1, PAGE_ID, {}));
+    EXPECT_TRUE(manager->DeferAccessibilityNode(DOM_NODE_TAG_TEXT, TEXT_NODE_ID, ROOT_NODE_ID, -1, PAGE_ID, {}));
+    EXPECT_TRUE(manager->UpdateDeferredAccessibilityNode(TEXT_NODE_ID, "", "", { { "value", "inspected" } }));
+
+    /**
+     * @tc.steps: step2. Inspect the text.
+     * @tc.expected: step2. The nodes are created, the text is inspected with its type and attributes.
+     */
+    auto inspector = JsonUtil::ParseJsonString(manager->GetInspectorNodeById(TEXT_NODE_ID));
+    ASSERT_TRUE(inspector && inspector->IsObject());
+    EXPECT_EQ(inspector->GetString("$type"), DOM_NODE_TAG_TEXT);
+    EXPECT_EQ(inspector->GetInt("$ID"), TEXT_NODE_ID);
+    auto attrs = inspector->GetObject("$attrs");
+    ASSERT_TRUE(attrs && attrs->IsObject());
+    EXPECT_EQ(attrs->GetString("value"), "inspected");
+    EXPECT_EQ(manager->GetDeferredNodeCount(), 0u);
+    EXPECT_FALSE(manager->IsLazyMode());
+}
+
+} // namespace OHOS::Ace::Framework
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#include "core/components/custom_paint/custom_paint_component.h"
+#include "frameworks/bridge/js_frontend/engine/common/canvas_display_list.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr size_t DRAW_CALLS = 10000;
+constexpr size_t OPS_PER_CALL = 4;
+constexpr double RECT_SIZE = 10.0;
+
+} // namespace
+
+class CanvasDisplayListTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: CanvasDisplayList001
+ * @tc.desc: Verify recorded calls are replayed to the task pool in order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CanvasDisplayListTest, CanvasDisplayList001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record encoded calls and tasks alternately.
+     */
+    auto displayList = AceType::MakeRefPtr<CanvasDisplayList>();
+    std::vector<size_t> order;
+    auto task = [&order](const RefPtr<CanvasTaskPool>& pool) { order.emplace_back(pool->GetTasks().size()); };
+    displayList->FillRect(Rect(0.0, 0.0, RECT_SIZE, RECT_SIZE));
+    displayList->PushTask(task);
+    displayList->FillText("text", RECT_SIZE, RECT_SIZE);
+    displayList->UpdateFillColor(Color::RED);
+    displayList->PushTask(task);
+    EXPECT_EQ(displayList->GetOpCount(), 5UL);
+
+    /**
+     * @tc.steps: step2. replay to a task pool without render node.
+     * @tc.expected: step2. every encoded call is pushed to the pool and tasks run between them.
+     */
+    auto pool = AceType::MakeRefPtr<CanvasTaskPool>();
+    displayList->Replay(pool);
+    EXPECT_EQ(pool->GetTasks().size(), 3UL);
+    ASSERT_EQ(order.size(), 2UL);
+    EXPECT_EQ(order[0], 1UL);
+    EXPECT_EQ(order[1], 3UL);
+}
+
+/**
+ * @tc.name: CanvasDisplayList002
+ * @tc.desc: Measure recording and replaying a frame of many draw calls.
+ * @tc.type: PERF
+ */
+HWTEST_F(CanvasDisplayListTest, CanvasDisplayList002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record a frame of a chart drawing many small paths.
+     * @tc.expected: step1. each call only takes its opcode and arguments in the buffer.
+     */
+    auto displayList = AceType::MakeRefPtr<CanvasDisplayList>();
+    int64_t begin = GetMicroTickCount();
+    for (size_t i = 0; i < DRAW_CALLS; ++i) {
+        displayList->BeginPath();
+        displayList->MoveTo(i, 0.0);
+        displayList->LineTo(i, RECT_SIZE);
+        displayList->Stroke();
+    }
+    int64_t recordCost = GetMicroTickCount() - begin;
+    EXPECT_EQ(displayList->GetOpCount(), DRAW_CALLS * OPS_PER_CALL);
+    EXPECT_EQ(displayList->GetByteSize(), DRAW_CALLS * (OPS_PER_CALL + 4 * sizeof(double)));
+
+    /**
+     * @tc.steps: step2. replay the frame.
+     * @tc.expected: step2. all calls reach the task pool.
+     */
+    auto pool = AceType::MakeRefPtr<CanvasTaskPool>();
+    begin = GetMicroTickCount();
+    displayList->Replay(pool);
+    int64_t replayCost = GetMicroTickCount() - begin;
+    EXPECT_EQ(pool->GetTasks().size(), DRAW_CALLS * OPS_PER_CALL);
+    LOGI("display list of %{public}zu calls: record %{public}lld us, replay %{public}lld us",
+        DRAW_CALLS * OPS_PER_CALL, static_cast<long long>(recordCost), static_cast<long long>(replayCost));
+}
+
+} // namespace OHOS::Ace::Framework
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "core/image/image_cache.h"
+#define private public
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+const char CACHE_DIR[] = "/data/local/tmp";
+const char FILE_NAME[] = "qjs_bytecode_cache_test.js";
+const char SOURCE[] = "var result = 1 + 2; result;";
+const char OTHER_SOURCE[] = "var result = 3 + 4; result;";
+constexpr int32_t SOURCE_RESULT = 3;
+constexpr int32_t OTHER_SOURCE_RESULT = 7;
+constexpr int64_t LARGE_COMPILE_COST = 1000000000;
+// The cache file starts with the magic, the size and hash of source, then the compile cost and the bytecode.
+constexpr std::streamoff COMPILE_COST_OFFSET = 16;
+constexpr std::streamoff BYTECODE_OFFSET = 24;
+
+std::string GetCachePath(JSContext* ctx, const char* source)
+{
+    return QjsBytecodeCache::GetCachePath(ctx, source, strlen(source), FILE_NAME, JS_EVAL_TYPE_GLOBAL);
+}
+
+bool IsFileExist(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return file.is_open();
+}
+
+void WriteAt(const std::string& path, std::streamoff offset, const char* data, size_t size)
+{
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    ASSERT_TRUE(file.is_open());
+    file.seekp(offset);
+    file.write(data, static_cast<std::streamsize>(size));
+}
+
+// A cache hit reports the compile cost written in cache as saved, set it large so that the hit is seen.
+void SetCompileCost(const std::string& path, int64_t compileCost)
+{
+    WriteAt(path, COMPILE_COST_OFFSET, reinterpret_cast<const char*>(&compileCost), sizeof(compileCost));
+}
+
+int32_t CompileAndRun(JSContext* ctx, const char* source, int64_t& savedTime)
+{
+    JSValue compiled =
+        QjsBytecodeCache::Compile(ctx, source, strlen(source), FILE_NAME, JS_EVAL_TYPE_GLOBAL, savedTime);
+    JSValue result = QjsBytecodeCache::Run(ctx, compiled);
+    int32_t value = -1;
+    if (JS_ToInt32(ctx, &value, result) < 0) {
+        value = -1;
+    }
+    JS_FreeValue(ctx, result);
+    return value;
+}
+
+} // namespace
+
+class QjsBytecodeCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    JSRuntime* runtime_ = nullptr;
+    JSContext* context_ = nullptr;
+};
+
+void QjsBytecodeCacheTest::SetUpTestCase()
+{
+    // The cache dir is set only once in a process.
+    ImageCache::SetImageCacheFilePath(CACHE_DIR);
+}
+
+void QjsBytecodeCacheTest::SetUp()
+{
+    runtime_ = JS_NewRuntime();
+    ASSERT_TRUE(runtime_ != nullptr);
+    context_ = JS_NewContext(runtime_);
+    ASSERT_TRUE(context_ != nullptr);
+    std::remove(GetCachePath(context_, SOURCE).c_str());
+    std::remove(GetCachePath(context_, OTHER_SOURCE).c_str());
+}
+
+void QjsBytecodeCacheTest::TearDown()
+{
+    if (context_) {
+        std::remove(GetCachePath(context_, SOURCE).c_str());
+        std::remove(GetCachePath(context_, OTHER_SOURCE).c_str());
+        JS_FreeContext(context_);
+        context_ = nullptr;
+    }
+    if (runtime_) {
+        JS_FreeRuntime(runtime_);
+        runtime_ = nullptr;
+    }
+}
+
+/**
+ * @tc.name: Compile001
+ * @tc.desc: Test the bytecode of a source is read from cache when it is compiled again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QjsBytecodeCacheTest, Compile001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Compile and run a source.
+     * @tc.expected: step1. The source runs, nothing is saved and its bytecode is written to cache.
+     */
+    int64_t savedTime = -1;
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    EXPECT_EQ(savedTime, 0);
+    auto path = GetCachePath(context_, SOURCE);
+    ASSERT_TRUE(IsFileExist(path));
+
+    /**
+     * @tc.steps: step2. Compile and run the source again.
+     * @tc.expected: step2. The bytecode is read from cache and runs the same.
+     */
+    SetCompileCost(path, LARGE_COMPILE_COST);
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    EXPECT_GT(savedTime, 0);
+
+    /**
+     * @tc.steps: step3. Compile the source again when reading the cache costs more than compiling it did.
+     * @tc.expected: step3. The saved time is not negative.
+     */
+    SetCompileCost(path, 0);
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    EXPECT_EQ(savedTime, 0);
+}
+
+/**
+ * @tc.name: Compile002
+ * @tc.desc: Test the cache is missed after the source of a file is changed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QjsBytecodeCacheTest, Compile002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Compile a source, then compile another source of the same file.
+     * @tc.expected: step1. The other source is kept in another entry and runs as itself.
+     */
+    int64_t savedTime = -1;
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    auto path = GetCachePath(context_, SOURCE);
+    auto otherPath = GetCachePath(context_, OTHER_SOURCE);
+    EXPECT_NE(path, otherPath);
+    SetCompileCost(path, LARGE_COMPILE_COST);
+    EXPECT_EQ(CompileAndRun(context_, OTHER_SOURCE, savedTime), OTHER_SOURCE_RESULT);
+    EXPECT_EQ(savedTime, 0);
+
+    /**
+     * @tc.steps: step2. Put the entry of the first source in the place of the other one, and compile the other one.
+     * @tc.expected: step2. The hash of source does not match, so the other source is compiled and cached again.
+     */
+    ASSERT_EQ(std::rename(path.c_str(), otherPath.c_str()), 0);
+    EXPECT_EQ(CompileAndRun(context_, OTHER_SOURCE, savedTime), OTHER_SOURCE_RESULT);
+    EXPECT_EQ(savedTime, 0);
+    SetCompileCost(otherPath, LARGE_COMPILE_COST);
+    EXPECT_EQ(CompileAndRun(context_, OTHER_SOURCE, savedTime), OTHER_SOURCE_RESULT);
+    EXPECT_GT(savedTime, 0);
+}
+
+/**
+ * @tc.name: Compile003
+ * @tc.desc: Test the cache is missed after the bytecode version of the engine is changed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QjsBytecodeCacheTest, Compile003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Compile a source, and get the entry of the source for another bytecode version.
+     * @tc.expected: step1. The entries of different versions are kept apart.
+     */
+    int64_t savedTime = -1;
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    auto path = GetCachePath(context_, SOURCE);
+    char version = 0;
+    {
+        std::ifstream file(path, std::ios::binary);
+        ASSERT_TRUE(file.is_open());
+        file.seekg(BYTECODE_OFFSET);
+        ASSERT_TRUE(file.read(&version, sizeof(version)));
+    }
+    auto otherVersion = static_cast<uint8_t>(version + 1);
+    EXPECT_NE(QjsBytecodeCache::GetCachePath(otherVersion, SOURCE, strlen(SOURCE), FILE_NAME, JS_EVAL_TYPE_GLOBAL),
+        path);
+
+    /**
+     * @tc.steps: step2. Mark the cached bytecode with another version, as if it was written by another engine.
+     * @tc.expected: step2. The bytecode is not read, the source is compiled and cached again.
+     */
+    auto otherVersionByte = static_cast<char>(otherVersion);
+    WriteAt(path, BYTECODE_OFFSET, &otherVersionByte, sizeof(otherVersionByte));
+    SetCompileCost(path, LARGE_COMPILE_COST);
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    EXPECT_EQ(savedTime, 0);
+    SetCompileCost(path, LARGE_COMPILE_COST);
+    EXPECT_EQ(CompileAndRun(context_, SOURCE, savedTime), SOURCE_RESULT);
+    EXPECT_GT(savedTime, 0);
+}
+
+} // namespace OHOS::Ace::Framework
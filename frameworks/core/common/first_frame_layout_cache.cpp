@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/common/first_frame_layout_cache.h"
+
+#include "base/log/log.h"
+#include "base/utils/string_utils.h"
+#include "base/utils/system_properties.h"
+#include "core/common/ace_application_info.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr char SIZE_SEPARATOR = ',';
+constexpr char SCOPE_SEPARATOR = '|';
+
+std::string SizeToString(const Size& size)
+{
+    return std::to_string(size.Width()) + SIZE_SEPARATOR + std::to_string(size.Height());
+}
+
+bool StringToSize(const std::string& value, Size& size)
+{
+    auto pos = value.find(SIZE_SEPARATOR);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    size.SetWidth(StringUtils::StringToDouble(value.substr(0, pos)));
+    size.SetHeight(StringUtils::StringToDouble(value.substr(pos + 1)));
+    return size.IsValid() && !size.IsInfinite();
+}
+
+} // namespace
+
+FirstFrameLayoutCache& FirstFrameLayoutCache::GetInstance()
+{
+    static FirstFrameLayoutCache instance;
+    return instance;
+}
+
+void FirstFrameLayoutCache::Enable(const std::string& path, const RefPtr<TaskExecutor>& taskExecutor)
+{
+    if (path.empty()) {
+        LOGW("path of first frame layout cache is empty");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (storage_ && path_ == path) {
+        // Enabled by another container of the process, which may be gone.
+        storage_->SetTaskExecutor(taskExecutor);
+        return;
+    }
+    storage_ = AceType::MakeRefPtr<LogStorage>(path, taskExecutor);
+    path_ = path;
+}
+
+void FirstFrameLayoutCache::Disable()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    storage_ = nullptr;
+    path_.clear();
+}
+
+bool FirstFrameLayoutCache::IsEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return storage_ != nullptr;
+}
+
+std::string FirstFrameLayoutCache::MakeScopedKey(const std::string& key)
+{
+    return std::to_string(SystemProperties::GetResolution()) + SCOPE_SEPARATOR +
+           AceApplicationInfo::GetInstance().GetLocaleTag() + SCOPE_SEPARATOR + key;
+}
+
+bool FirstFrameLayoutCache::GetSize(const std::string& key, Size& size) const
+{
+    RefPtr<LogStorage> storage;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        storage = storage_;
+    }
+    if (!storage) {
+        return false;
+    }
+    return StringToSize(storage->Get(MakeScopedKey(key)), size);
+}
+
+void FirstFrameLayoutCache::PutSize(const std::string& key, const Size& size)
+{
+    RefPtr<LogStorage> storage;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        storage = storage_;
+    }
+    if (!storage || !size.IsValid() || size.IsInfinite()) {
+        return;
+    }
+    // The storage skips the write if the size is the same as saved.
+    storage->Set(MakeScopedKey(key), SizeToString(size));
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FIRST_FRAME_LAYOUT_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FIRST_FRAME_LAYOUT_CACHE_H
+
+#include <mutex>
+#include <string>
+
+#include "base/geometry/size.h"
+#include "base/thread/task_executor.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "core/common/storage/log_storage.h"
+
+namespace OHOS::Ace {
+
+// FirstFrameLayoutCache keeps sizes measured asynchronously across launches, such as the size of images which is known
+// only after the image is decoded. The first frame is laid out with the sizes measured by the last launches instead
+// of empty ones, and each size is checked and saved again once it is measured. Sizes are scoped by density and
+// locale, which select the resources to load.
+class ACE_EXPORT FirstFrameLayoutCache final {
+public:
+    static FirstFrameLayoutCache& GetInstance();
+
+    // The cache is opt-in, sizes are saved in |path| and loaded from it by the next launches. Enabled again with the
+    // same path, the sizes are written by |taskExecutor| from then on.
+    void Enable(const std::string& path, const RefPtr<TaskExecutor>& taskExecutor);
+    void Disable();
+    bool IsEnabled() const;
+
+    // Returns false if |key| has not been measured by the last launches.
+    bool GetSize(const std::string& key, Size& size) const;
+    void PutSize(const std::string& key, const Size& size);
+
+private:
+    FirstFrameLayoutCache() = default;
+    ~FirstFrameLayoutCache() = default;
+
+    static std::string MakeScopedKey(const std::string& key);
+
+    mutable std::mutex mutex_;
+    RefPtr<LogStorage> storage_;
+    std::string path_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FirstFrameLayoutCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FIRST_FRAME_LAYOUT_CACHE_H
@@ -38,6 +38,7 @@
 #include "base/thread/background_task_executor.h"
 #include "core/common/container.h"
 #include "core/common/container_scope.h"
+#include "core/common/stall_sampler.h"
 
 namespace OHOS::Ace {
 namespace {
@@ -55,6 +56,7 @@ TaskExecutor::Task WrapTaskWithContainer(TaskExecutor::Task&& task, int32_t id)
 {
     auto wrappedTask = [originTask = std::move(task), id]() {
         ContainerScope scope(id);
+        StallSampler::TaskScope stallScope(id);
         if (originTask) {
             originTask();
         }
@@ -17,6 +17,9 @@
 
 namespace OHOS::Ace {
 
+std::mutex FontLoader::loadedFontsMutex_;
+std::set<std::string> FontLoader::loadedFonts_;
+
 FontLoader::FontLoader(const std::string& familyName, const std::string& familySrc)
     : familyName_(familyName), familySrc_(familySrc) {}
 
@@ -47,4 +50,46 @@ void FontLoader::SetVariationChanged(const std::function<void()>& variationChang
     variationChanged_ = variationChanged;
 }
 
+void FontLoader::NotifyLoaded()
+{
+    isLoaded_ = true;
+    if (!collectionKey_.empty()) {
+        std::lock_guard<std::mutex> lock(loadedFontsMutex_);
+        loadedFonts_.emplace(collectionKey_);
+    }
+    // The font manager batches the relayout of all fonts loaded in the same frame.
+    if (variationChanged_) {
+        variationChanged_();
+        return;
+    }
+    std::set<WeakPtr<RenderNode>> notifiedNodes;
+    NotifyCallbacks(notifiedNodes);
+}
+
+void FontLoader::NotifyCallbacks(std::set<WeakPtr<RenderNode>>& notifiedNodes)
+{
+    // When font is already loaded, notify all which used this font.
+    auto callbacks = std::move(callbacks_);
+    callbacks_.clear();
+    for (const auto& [node, callback] : callbacks) {
+        if (callback && notifiedNodes.emplace(node).second) {
+            callback();
+        }
+    }
+}
+
+void FontLoader::SetFontPath(const std::string& fontPath)
+{
+    collectionKey_ = fontPath.empty() ? "" : familyName_ + "\n" + fontPath;
+}
+
+bool FontLoader::IsLoadedInCollection() const
+{
+    if (collectionKey_.empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(loadedFontsMutex_);
+    return loadedFonts_.find(collectionKey_) != loadedFonts_.end();
+}
+
 } // namespace OHOS::Ace
\ No newline at end of file
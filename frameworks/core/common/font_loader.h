@@ -16,6 +16,9 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_LOADER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_LOADER_H
 
+#include <mutex>
+#include <set>
+
 #include "base/memory/ace_type.h"
 #include "core/pipeline/pipeline_context.h"
 
@@ -37,12 +40,32 @@ public:
     void RemoveCallback(const WeakPtr<RenderNode>& node);
     void SetVariationChanged(const std::function<void()>& variationChanged);
 
+    // Runs callbacks of nodes using this font, except the nodes already notified by other fonts.
+    void NotifyCallbacks(std::set<WeakPtr<RenderNode>>& notifiedNodes);
+
 protected:
+    // Called on UI thread once the font is in the font collection.
+    void NotifyLoaded();
+
+    // Sets where the font is read from: the url of a font from the network, or the absolute path of an asset. The
+    // same relative asset path names different fonts in different bundles and modules, so it can't be used.
+    void SetFontPath(const std::string& fontPath);
+
+    // The font collection is shared by all containers of the process, so a font loaded by one container does not need
+    // to be fetched again by others. Always false before the path of the font is set.
+    bool IsLoadedInCollection() const;
+
     std::string familyName_;
     std::string familySrc_;
     std::map<WeakPtr<RenderNode>, std::function<void()>> callbacks_;
     bool isLoaded_ = false;
     std::function<void()> variationChanged_;
+
+private:
+    std::string collectionKey_;
+
+    static std::mutex loadedFontsMutex_;
+    static std::set<std::string> loadedFonts_;
 };
 
 } // namespace OHOS::Ace
@@ -38,15 +38,59 @@ void FontManager::RegisterFont(
         }
     }
     RefPtr<FontLoader> fontLoader = FontLoader::Create(familyName, familySrc);
+    if (!fontLoader) {
+        return;
+    }
+    context_ = context;
     fontLoaders_.emplace_back(fontLoader);
-    fontLoader->AddFont(context);
-
     fontLoader->SetVariationChanged([weak = WeakClaim(this), familyName]() {
         auto fontManager = weak.Upgrade();
         if (fontManager) {
-            fontManager->VaryFontCollectionWithFontWeightScale();
+            fontManager->OnFontLoaded(familyName);
         }
     });
+    fontLoader->AddFont(context);
+}
+
+void FontManager::OnFontLoaded(const std::string& familyName)
+{
+    loadedFamilies_.emplace(familyName);
+    if (isFlushPosted_) {
+        return;
+    }
+    auto context = context_.Upgrade();
+    if (!context || !context->GetTaskExecutor()) {
+        FlushLoadedFonts();
+        return;
+    }
+    // Fonts of a page are fetched in parallel and usually land within a few tasks of each other, apply them together.
+    isFlushPosted_ = true;
+    context->GetTaskExecutor()->PostTask(
+        [weak = WeakClaim(this)]() {
+            auto fontManager = weak.Upgrade();
+            if (fontManager) {
+                fontManager->FlushLoadedFonts();
+            }
+        },
+        TaskExecutor::TaskType::UI);
+}
+
+void FontManager::FlushLoadedFonts()
+{
+    isFlushPosted_ = false;
+    if (loadedFamilies_.empty()) {
+        return;
+    }
+    VaryFontCollectionWithFontWeightScale();
+
+    // Only the nodes using the loaded families need relayout.
+    std::set<WeakPtr<RenderNode>> notifiedNodes;
+    for (const auto& fontLoader : fontLoaders_) {
+        if (loadedFamilies_.find(fontLoader->GetFamilyName()) != loadedFamilies_.end()) {
+            fontLoader->NotifyCallbacks(notifiedNodes);
+        }
+    }
+    loadedFamilies_.clear();
 }
 
 void FontManager::RegisterCallback(
@@ -105,6 +149,7 @@ void FontManager::UpdateFontWeightScale()
     if (!NearEqual(fontWeightScale, fontWeightScale_)) {
         fontWeightScale_ = fontWeightScale;
         VaryFontCollectionWithFontWeightScale();
+        NotifyVariationNodes();
     }
 }
 
@@ -18,6 +18,7 @@
 
 #include <list>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "base/memory/ace_type.h"
@@ -33,6 +34,7 @@ public:
     FontManager() = default;
     ~FontManager() override = default;
 
+    // Applies the weight scale to the font collection, callers relayout the affected nodes.
     virtual void VaryFontCollectionWithFontWeightScale() = 0;
 
     virtual void LoadSystemFont() = 0;
@@ -57,11 +59,18 @@ protected:
     static float fontWeightScale_;
 
 private:
+    void OnFontLoaded(const std::string& familyName);
+    void FlushLoadedFonts();
+
     std::list<RefPtr<FontLoader>> fontLoaders_;
     std::vector<std::string> fontNames_;
     std::set<WeakPtr<RenderNode>> fontNodes_;
     // Render nodes need to layout when wght scale is changed.
     std::set<WeakPtr<RenderNode>> variationNodes_;
+    // Fonts loaded since last flush, all of them are applied with one relayout of the nodes using them.
+    std::set<std::string> loadedFamilies_;
+    bool isFlushPosted_ = false;
+    WeakPtr<PipelineContext> context_;
 };
 
 } // namespace OHOS::Ace
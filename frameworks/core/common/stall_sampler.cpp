@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/common/stall_sampler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <map>
+
+#if defined(OHOS_PLATFORM) || defined(ANDROID_PLATFORM)
+#include <cerrno>
+#include <csignal>
+#include <dlfcn.h>
+#include <sys/syscall.h>
+#include <ucontext.h>
+#include <unistd.h>
+#if defined(__aarch64__) || defined(__arm__) || defined(__x86_64__)
+#define ENABLE_STALL_SAMPLING
+#endif
+#endif
+
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// Two frames of 60 fps.
+constexpr uint32_t DEFAULT_STALL_THRESHOLD = 32;
+constexpr int64_t MICROSECONDS_PER_MILLISECOND = 1000;
+constexpr size_t MAX_SAMPLES = 64;
+constexpr size_t MAX_REPORTED_STACKS = 3;
+
+thread_local RefPtr<StalledThread> g_currentThread;
+
+int64_t GetNowMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#ifdef ENABLE_STALL_SAMPLING
+// A real time signal dedicated to the sampler, so that profilers using SIGPROF are not disturbed.
+constexpr int32_t SAMPLE_SIGNAL_OFFSET = 5;
+constexpr size_t MAX_FRAMES = 32;
+constexpr int64_t SAMPLE_TIMEOUT = 10 * MICROSECONDS_PER_MILLISECOND;
+constexpr auto SAMPLE_WAIT_INTERVAL = std::chrono::microseconds(100);
+
+enum SampleState : int32_t {
+    SAMPLE_IDLE = 0,
+    SAMPLE_REQUESTED,
+    SAMPLE_WRITING,
+    SAMPLE_READY,
+};
+
+// Written by the signal handler on the sampled thread, only one sample is taken at a time.
+struct SampleBuffer {
+    std::atomic<int32_t> state { SAMPLE_IDLE };
+    // Thread the sample is requested for, a late signal of an earlier request is not taken by another thread.
+    std::atomic<pid_t> targetTid { 0 };
+    uintptr_t stackLow = 0;
+    uintptr_t stackHigh = 0;
+    uintptr_t frames[MAX_FRAMES] = { 0 };
+    size_t count = 0;
+};
+
+SampleBuffer g_sampleBuffer;
+struct sigaction g_previousAction = {};
+
+int32_t GetSampleSignal()
+{
+    return SIGRTMIN + SAMPLE_SIGNAL_OFFSET;
+}
+
+pid_t GetCurrentTid()
+{
+    return static_cast<pid_t>(syscall(SYS_gettid));
+}
+
+// Reads the registers of the interrupted code, the frame pointer is 0 if frame records can't be walked.
+void GetContextRegisters(const ucontext_t* context, uintptr_t& pc, uintptr_t& fp, uintptr_t& lr)
+{
+#if defined(__aarch64__)
+    pc = static_cast<uintptr_t>(context->uc_mcontext.pc);
+    fp = static_cast<uintptr_t>(context->uc_mcontext.regs[29]);
+    lr = 0;
+#elif defined(__arm__)
+    // Frame records of arm and thumb code are laid out differently, only the caller is taken.
+    pc = static_cast<uintptr_t>(context->uc_mcontext.arm_pc);
+    fp = 0;
+    lr = static_cast<uintptr_t>(context->uc_mcontext.arm_lr);
+#else
+    pc = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+    fp = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RBP]);
+    lr = 0;
+#endif
+}
+
+// Walks the frame records linked by the frame pointer, only reads memory inside of the stack of the thread. Only
+// async signal safe code runs here, frames are symbolized by the sampler thread later.
+void WalkFrames(const ucontext_t* context)
+{
+    uintptr_t pc = 0;
+    uintptr_t fp = 0;
+    uintptr_t lr = 0;
+    GetContextRegisters(context, pc, fp, lr);
+    g_sampleBuffer.count = 0;
+    g_sampleBuffer.frames[g_sampleBuffer.count++] = pc;
+    if (lr != 0) {
+        g_sampleBuffer.frames[g_sampleBuffer.count++] = lr;
+    }
+    constexpr uintptr_t recordSize = 2 * sizeof(uintptr_t);
+    while (g_sampleBuffer.count < MAX_FRAMES && fp >= g_sampleBuffer.stackLow &&
+           fp + recordSize <= g_sampleBuffer.stackHigh && fp % sizeof(uintptr_t) == 0) {
+        // A frame record is the frame pointer of the caller followed by the return address.
+        const auto* record = reinterpret_cast<const uintptr_t*>(fp);
+        uintptr_t nextFp = record[0];
+        uintptr_t returnAddress = record[1];
+        if (returnAddress == 0) {
+            break;
+        }
+        g_sampleBuffer.frames[g_sampleBuffer.count++] = returnAddress;
+        // The stack grows down, a frame record of a caller is always above the callee.
+        if (nextFp <= fp) {
+            break;
+        }
+        fp = nextFp;
+    }
+}
+
+void ChainSignal(int32_t sigNum, siginfo_t* info, void* context)
+{
+    if ((g_previousAction.sa_flags & SA_SIGINFO) != 0) {
+        if (g_previousAction.sa_sigaction != nullptr) {
+            g_previousAction.sa_sigaction(sigNum, info, context);
+        }
+    } else if (g_previousAction.sa_handler != SIG_DFL && g_previousAction.sa_handler != SIG_IGN) {
+        g_previousAction.sa_handler(sigNum);
+    }
+}
+
+void OnSampleSignal(int32_t sigNum, siginfo_t* info, void* context)
+{
+    int32_t savedErrno = errno;
+    // Signals not sent by the sampler of this process belong to the previous handler.
+    if (info == nullptr || info->si_code != SI_TKILL || info->si_pid != getpid()) {
+        ChainSignal(sigNum, info, context);
+        errno = savedErrno;
+        return;
+    }
+    if (context == nullptr || g_sampleBuffer.targetTid.load(std::memory_order_acquire) != GetCurrentTid()) {
+        errno = savedErrno;
+        return;
+    }
+    int32_t expected = SAMPLE_REQUESTED;
+    // Skip the signal if the sampler has given up waiting.
+    if (!g_sampleBuffer.state.compare_exchange_strong(expected, SAMPLE_WRITING)) {
+        errno = savedErrno;
+        return;
+    }
+    WalkFrames(static_cast<const ucontext_t*>(context));
+    g_sampleBuffer.state.store(SAMPLE_READY, std::memory_order_release);
+    errno = savedErrno;
+}
+
+bool InstallSampleHandler()
+{
+    struct sigaction action = {};
+    action.sa_sigaction = OnSampleSignal;
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(GetSampleSignal(), &action, &g_previousAction) != 0) {
+        LOGE("Failed to install stall sample handler, errno = %{public}d", errno);
+        return false;
+    }
+    return true;
+}
+
+void UninstallSampleHandler()
+{
+    if (sigaction(GetSampleSignal(), &g_previousAction, nullptr) != 0) {
+        LOGE("Failed to restore the handler of stall sample signal, errno = %{public}d", errno);
+    }
+}
+
+bool GetStackRange(uintptr_t& stackLow, uintptr_t& stackHigh)
+{
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+        return false;
+    }
+    void* stackAddr = nullptr;
+    size_t stackSize = 0;
+    bool result = pthread_attr_getstack(&attr, &stackAddr, &stackSize) == 0;
+    pthread_attr_destroy(&attr);
+    if (result) {
+        stackLow = reinterpret_cast<uintptr_t>(stackAddr);
+        stackHigh = stackLow + stackSize;
+    }
+    return result;
+}
+#endif // ENABLE_STALL_SAMPLING
+
+// Describes the frame as the module and the offset in it, which are symbolized offline.
+std::string DescribeFrame(uintptr_t pc)
+{
+    char buffer[256] = { 0 };
+#ifdef ENABLE_STALL_SAMPLING
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(pc), &info) != 0 && info.dli_fname != nullptr) {
+        const char* module = strrchr(info.dli_fname, '/');
+        module = module != nullptr ? module + 1 : info.dli_fname;
+        if (snprintf(buffer, sizeof(buffer), "%s+0x%" PRIxPTR, module,
+            pc - reinterpret_cast<uintptr_t>(info.dli_fbase)) > 0) {
+            return buffer;
+        }
+    }
+#endif
+    if (snprintf(buffer, sizeof(buffer), "0x%" PRIxPTR, pc) > 0) {
+        return buffer;
+    }
+    return "";
+}
+
+} // namespace
+
+StalledThread::StalledThread(const std::string& name) : name_(name), thread_(pthread_self())
+{
+#ifdef ENABLE_STALL_SAMPLING
+    tid_ = GetCurrentTid();
+    if (!GetStackRange(stackLow_, stackHigh_)) {
+        LOGW("Failed to get the stack of thread %{public}s, only the top frame is sampled", name.c_str());
+    }
+#endif
+}
+
+std::string StalledThread::GetLastReport() const
+{
+    std::lock_guard<std::mutex> lock(reportMutex_);
+    return lastReport_;
+}
+
+StallSampler::TaskScope::TaskScope(int32_t traceId)
+{
+    auto thread = Referenced::RawPtr(g_currentThread);
+    if (thread == nullptr) {
+        return;
+    }
+    thread_ = thread;
+    // Tasks run synchronously inside of a task belong to the outer one.
+    if (thread->taskDepth_++ == 0) {
+        thread->taskTraceId_.store(traceId, std::memory_order_relaxed);
+        thread->taskBeginTime_.store(GetNowMicroseconds(), std::memory_order_release);
+        StallSampler::GetInstance().OnTaskBegin(thread);
+    }
+}
+
+StallSampler::TaskScope::~TaskScope()
+{
+    if (thread_ != nullptr && --thread_->taskDepth_ == 0) {
+        thread_->taskBeginTime_.store(0, std::memory_order_release);
+    }
+}
+
+StallSampler& StallSampler::GetInstance()
+{
+    static StallSampler instance;
+    return instance;
+}
+
+StallSampler::StallSampler() : threshold_(DEFAULT_STALL_THRESHOLD)
+{
+#ifdef ENABLE_STALL_SAMPLING
+    canSample_ = InstallSampleHandler();
+#endif
+    samplerThread_ = std::thread([this]() { Run(); });
+}
+
+StallSampler::~StallSampler()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    condition_.notify_all();
+    if (samplerThread_.joinable()) {
+        samplerThread_.join();
+    }
+#ifdef ENABLE_STALL_SAMPLING
+    if (canSample_) {
+        UninstallSampleHandler();
+    }
+#endif
+}
+
+RefPtr<StalledThread> StallSampler::WatchCurrentThread(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!g_currentThread) {
+        g_currentThread = Referenced::MakeRefPtr<StalledThread>(name);
+    }
+    if (g_currentThread->watchCount_++ == 0) {
+        threads_.emplace_back(g_currentThread);
+    }
+    return g_currentThread;
+}
+
+void StallSampler::Unwatch(const RefPtr<StalledThread>& thread)
+{
+    if (!thread) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (thread->watchCount_ > 0 && --thread->watchCount_ == 0) {
+        thread->sampledTaskBeginTime_ = 0;
+        thread->samples_.clear();
+        threads_.remove(thread);
+    }
+}
+
+void StallSampler::SetThreshold(uint32_t threshold)
+{
+    threshold_.store(threshold, std::memory_order_relaxed);
+    condition_.notify_all();
+}
+
+void StallSampler::OnTaskBegin(StalledThread* thread)
+{
+    if (!idle_.load() || threshold_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    // Wake up the sampler which sleeps while all the watched threads are idle.
+    std::lock_guard<std::mutex> lock(mutex_);
+    condition_.notify_one();
+}
+
+void StallSampler::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_) {
+        uint32_t threshold = threshold_.load(std::memory_order_relaxed);
+        if (threshold > 0 && CheckThreadsLocked(GetNowMicroseconds())) {
+            condition_.wait_for(lock, std::chrono::milliseconds(threshold));
+            continue;
+        }
+        idle_.store(true);
+        // Check again, a task may begin before the sampler is marked idle.
+        if (threshold == 0 || !CheckThreadsLocked(GetNowMicroseconds())) {
+            condition_.wait(lock);
+        }
+        idle_.store(false);
+    }
+}
+
+bool StallSampler::CheckThreadsLocked(int64_t now)
+{
+    int64_t threshold = threshold_.load(std::memory_order_relaxed) * MICROSECONDS_PER_MILLISECOND;
+    bool isBusy = false;
+    for (const auto& thread : threads_) {
+        int64_t beginTime = thread->taskBeginTime_.load(std::memory_order_acquire);
+        if (thread->sampledTaskBeginTime_ != 0 && thread->sampledTaskBeginTime_ != beginTime) {
+            // The stalled task has ended.
+            Report(*thread);
+        }
+        if (beginTime == 0) {
+            continue;
+        }
+        isBusy = true;
+        if (now - beginTime < threshold) {
+            continue;
+        }
+        if (thread->sampledTaskBeginTime_ != beginTime) {
+            thread->sampledTaskBeginTime_ = beginTime;
+            thread->sampledTraceId_ = thread->taskTraceId_.load(std::memory_order_relaxed);
+        }
+        thread->sampledDuration_ = now - beginTime;
+        TakeSample(*thread);
+    }
+    return isBusy;
+}
+
+void StallSampler::TakeSample(StalledThread& thread)
+{
+#ifdef ENABLE_STALL_SAMPLING
+    if (!canSample_ || thread.samples_.size() >= MAX_SAMPLES) {
+        return;
+    }
+    g_sampleBuffer.stackLow = thread.stackLow_;
+    g_sampleBuffer.stackHigh = thread.stackHigh_;
+    // The target is set before the request, so the handler never takes a request for another thread.
+    g_sampleBuffer.targetTid.store(thread.tid_, std::memory_order_release);
+    g_sampleBuffer.state.store(SAMPLE_REQUESTED, std::memory_order_release);
+    if (pthread_kill(thread.GetThread(), GetSampleSignal()) != 0) {
+        g_sampleBuffer.state.store(SAMPLE_IDLE);
+        g_sampleBuffer.targetTid.store(0);
+        return;
+    }
+    int64_t deadline = GetNowMicroseconds() + SAMPLE_TIMEOUT;
+    while (g_sampleBuffer.state.load(std::memory_order_acquire) != SAMPLE_READY) {
+        if (GetNowMicroseconds() > deadline) {
+            int32_t expected = SAMPLE_REQUESTED;
+            if (g_sampleBuffer.state.compare_exchange_strong(expected, SAMPLE_IDLE)) {
+                g_sampleBuffer.targetTid.store(0);
+                return;
+            }
+            // The handler is writing the sample, wait for it.
+        }
+        std::this_thread::sleep_for(SAMPLE_WAIT_INTERVAL);
+    }
+    thread.samples_.emplace_back(g_sampleBuffer.frames, g_sampleBuffer.frames + g_sampleBuffer.count);
+    g_sampleBuffer.targetTid.store(0);
+    g_sampleBuffer.state.store(SAMPLE_IDLE);
+#endif
+}
+
+void StallSampler::Report(StalledThread& thread)
+{
+    // The same stack sampled repeatedly is where the task spends its time.
+    std::map<std::vector<uintptr_t>, int32_t> stacks;
+    for (const auto& sample : thread.samples_) {
+        ++stacks[sample];
+    }
+    std::vector<std::pair<const std::vector<uintptr_t>*, int32_t>> sortedStacks;
+    for (const auto& [stack, count] : stacks) {
+        sortedStacks.emplace_back(&stack, count);
+    }
+    std::sort(sortedStacks.begin(), sortedStacks.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+    std::string report = "Stalled thread = " + thread.GetName() + ", trace id = " +
+                         std::to_string(thread.sampledTraceId_) + ", lasted over " +
+                         std::to_string(thread.sampledDuration_ / MICROSECONDS_PER_MILLISECOND) + " ms, samples = " +
+                         std::to_string(thread.samples_.size()) + "\n";
+    size_t reportedCount = std::min(sortedStacks.size(), MAX_REPORTED_STACKS);
+    for (size_t i = 0; i < reportedCount; ++i) {
+        report += "Stack sampled " + std::to_string(sortedStacks[i].second) + " times:\n";
+        for (auto pc : *sortedStacks[i].first) {
+            report += "  " + DescribeFrame(pc) + "\n";
+        }
+    }
+    LOGW("%{public}s", report.c_str());
+    {
+        std::lock_guard<std::mutex> lock(thread.reportMutex_);
+        thread.lastReport_ = std::move(report);
+    }
+
+    thread.sampledTaskBeginTime_ = 0;
+    thread.sampledTraceId_ = -1;
+    thread.sampledDuration_ = 0;
+    thread.samples_.clear();
+}
+
+} // namespace OHOS::Ace
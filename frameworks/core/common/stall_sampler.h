@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STALL_SAMPLER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STALL_SAMPLER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#include "base/memory/referenced.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// A thread watched by the stall sampler, the task running on it is stamped by 'StallSampler::TaskScope'.
+class StalledThread final : public Referenced {
+public:
+    // Must be created on the thread it stands for.
+    explicit StalledThread(const std::string& name);
+    ~StalledThread() override = default;
+
+    const std::string& GetName() const
+    {
+        return name_;
+    }
+
+    pthread_t GetThread() const
+    {
+        return thread_;
+    }
+
+    // Report of the last task running longer than the threshold.
+    std::string GetLastReport() const;
+
+private:
+    friend class StallSampler;
+
+    const std::string name_;
+    const pthread_t thread_;
+    // Kernel id and stack range of the thread, which bound the frame records walked by the sample handler.
+    pid_t tid_ = 0;
+    uintptr_t stackLow_ = 0;
+    uintptr_t stackHigh_ = 0;
+    // Start time of the running task in microseconds, 0 if the thread is idle.
+    std::atomic<int64_t> taskBeginTime_ { 0 };
+    std::atomic<int32_t> taskTraceId_ { -1 };
+    int32_t taskDepth_ = 0;
+
+    // Used by the sampler only.
+    int32_t watchCount_ = 0;
+    int64_t sampledTaskBeginTime_ = 0;
+    int32_t sampledTraceId_ = -1;
+    int64_t sampledDuration_ = 0;
+    // Return addresses from the top of the stack of each sample.
+    std::vector<std::vector<uintptr_t>> samples_;
+
+    mutable std::mutex reportMutex_;
+    std::string lastReport_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(StalledThread);
+};
+
+// StallSampler finds tasks which keep the watched threads busy longer than a threshold. While such a task runs, the
+// stack of its thread is sampled periodically. When it ends the samples are logged as module and offset pairs, to be
+// symbolized offline with the symbols of the build, together with the trace id of the task.
+class ACE_EXPORT StallSampler final {
+public:
+    // Marks the task running on the current thread, it costs a thread local read if the thread is not watched.
+    class TaskScope final {
+    public:
+        explicit TaskScope(int32_t traceId);
+        ~TaskScope();
+
+    private:
+        StalledThread* thread_ = nullptr;
+
+        ACE_DISALLOW_COPY_AND_MOVE(TaskScope);
+    };
+
+    static StallSampler& GetInstance();
+
+    // Watches the current thread, must be called on it.
+    RefPtr<StalledThread> WatchCurrentThread(const std::string& name);
+    void Unwatch(const RefPtr<StalledThread>& thread);
+
+    // A task running longer than |threshold| milliseconds is sampled, 0 disables sampling.
+    void SetThreshold(uint32_t threshold);
+    uint32_t GetThreshold() const
+    {
+        return threshold_.load(std::memory_order_relaxed);
+    }
+
+private:
+    StallSampler();
+    ~StallSampler();
+
+    void OnTaskBegin(StalledThread* thread);
+    void Run();
+    // Returns true if any of the watched threads is running a task.
+    bool CheckThreadsLocked(int64_t now);
+    void TakeSample(StalledThread& thread);
+    void Report(StalledThread& thread);
+
+    std::atomic<uint32_t> threshold_;
+    std::atomic<bool> idle_ { true };
+    bool stopped_ = false;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::list<RefPtr<StalledThread>> threads_;
+    bool canSample_ = false;
+    std::thread samplerThread_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(StallSampler);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STALL_SAMPLER_H
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/common/storage/log_storage.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef WINDOWS_PLATFORM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "base/log/ace_trace.h"
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// A record is [type: 1 byte][key size: 4 bytes][value size: 4 bytes][key][value].
+constexpr size_t RECORD_HEADER_SIZE = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t);
+// The log is compacted once it is larger than this and more than half of it is stale.
+constexpr size_t COMPACT_MIN_LOG_SIZE = 256 * 1024;
+const char TEMP_FILE_SUFFIX[] = ".tmp";
+
+size_t GetRecordSize(const std::string& key, const std::string& value)
+{
+    return RECORD_HEADER_SIZE + key.size() + value.size();
+}
+
+void EncodeRecord(std::string& out, uint8_t type, const std::string& key, const std::string& value)
+{
+    auto keySize = static_cast<uint32_t>(key.size());
+    auto valueSize = static_cast<uint32_t>(value.size());
+    out.push_back(static_cast<char>(type));
+    out.append(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+    out.append(reinterpret_cast<const char*>(&valueSize), sizeof(valueSize));
+    out.append(key);
+    out.append(value);
+}
+
+bool WriteFile(const std::string& path, const std::string& content, bool append)
+{
+    FILE* file = std::fopen(path.c_str(), append ? "ab" : "wb");
+    if (!file) {
+        LOGE("open storage file failed");
+        return false;
+    }
+    bool result = content.empty() || std::fwrite(content.data(), 1, content.size(), file) == content.size();
+    result = (std::fclose(file) == 0) && result;
+    if (!result) {
+        LOGE("write storage file failed");
+    }
+    return result;
+}
+
+// Calls |visitor| with each complete record of the log, returns the size of the complete records.
+template<typename Visitor>
+size_t ParseRecords(const char* data, size_t size, Visitor&& visitor)
+{
+    size_t offset = 0;
+    while (offset + RECORD_HEADER_SIZE <= size) {
+        auto type = static_cast<uint8_t>(data[offset]);
+        uint32_t keySize = 0;
+        uint32_t valueSize = 0;
+        std::memcpy(&keySize, data + offset + sizeof(uint8_t), sizeof(keySize));
+        std::memcpy(&valueSize, data + offset + sizeof(uint8_t) + sizeof(keySize), sizeof(valueSize));
+        size_t recordSize = RECORD_HEADER_SIZE + static_cast<size_t>(keySize) + valueSize;
+        if (recordSize > size - offset) {
+            // The last record is torn by a crash while writing.
+            break;
+        }
+        const char* key = data + offset + RECORD_HEADER_SIZE;
+        if (!visitor(type, std::string(key, keySize), std::string(key + keySize, valueSize))) {
+            break;
+        }
+        offset += recordSize;
+    }
+    return offset;
+}
+
+} // namespace
+
+LogStorage::LogStorage(const std::string& path, const RefPtr<TaskExecutor>& taskExecutor)
+    : Storage(taskExecutor), path_(path)
+{
+    Load();
+}
+
+LogStorage::~LogStorage()
+{
+    Flush();
+}
+
+void LogStorage::Load()
+{
+    ACE_SCOPED_TRACE("LogStorage::Load");
+    auto visitor = [this](uint8_t type, std::string&& key, std::string&& value) {
+        if (type != static_cast<uint8_t>(RecordType::SET_VALUE) &&
+            type != static_cast<uint8_t>(RecordType::DELETE_KEY)) {
+            LOGE("unknown record type %{public}u in storage", type);
+            return false;
+        }
+        auto iter = values_.find(key);
+        if (iter != values_.end()) {
+            liveSize_ -= GetRecordSize(iter->first, iter->second);
+        }
+        if (type == static_cast<uint8_t>(RecordType::DELETE_KEY)) {
+            if (iter != values_.end()) {
+                values_.erase(iter);
+            }
+            return true;
+        }
+        liveSize_ += GetRecordSize(key, value);
+        if (iter != values_.end()) {
+            iter->second = std::move(value);
+        } else {
+            values_.emplace(std::move(key), std::move(value));
+        }
+        return true;
+    };
+
+    size_t fileSize = 0;
+    size_t validSize = 0;
+#ifndef WINDOWS_PLATFORM
+    // Map the log instead of reading it into a buffer, most of it is copied into the index only once.
+    int fd = open(path_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        fileSize = static_cast<size_t>(fileStat.st_size);
+        void* data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            validSize = ParseRecords(static_cast<const char*>(data), fileSize, visitor);
+            munmap(data, fileSize);
+        } else {
+            LOGE("map storage file failed");
+        }
+    }
+    close(fd);
+#else
+    std::ifstream file(path_, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    fileSize = content.size();
+    validSize = ParseRecords(content.data(), content.size(), visitor);
+#endif
+    logSize_ = validSize;
+    if (validSize != fileSize) {
+        // Drop the broken tail, otherwise records appended later can't be parsed.
+        LOGW("storage log is broken at %{public}zu of %{public}zu", validSize, fileSize);
+        Compact();
+    }
+}
+
+void LogStorage::Set(const std::string& key, const std::string& value)
+{
+    bool scheduled = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = values_.find(key);
+        if (iter != values_.end()) {
+            if (iter->second == value) {
+                return;
+            }
+            liveSize_ -= GetRecordSize(key, iter->second);
+            iter->second = value;
+        } else {
+            values_.emplace(key, value);
+        }
+        liveSize_ += GetRecordSize(key, value);
+        AppendRecordLocked(RecordType::SET_VALUE, key, value);
+        scheduled = ScheduleFlushLocked();
+    }
+    if (!scheduled) {
+        Flush();
+    }
+}
+
+std::string LogStorage::Get(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = values_.find(key);
+    return iter == values_.end() ? "" : iter->second;
+}
+
+void LogStorage::Clear()
+{
+    bool scheduled = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        values_.clear();
+        pendingRecords_.clear();
+        liveSize_ = 0;
+        logSize_ = 0;
+        truncatePending_ = true;
+        scheduled = ScheduleFlushLocked();
+    }
+    if (!scheduled) {
+        Flush();
+    }
+}
+
+void LogStorage::Delete(const std::string& key)
+{
+    bool scheduled = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = values_.find(key);
+        if (iter == values_.end()) {
+            return;
+        }
+        liveSize_ -= GetRecordSize(key, iter->second);
+        values_.erase(iter);
+        AppendRecordLocked(RecordType::DELETE_KEY, key, "");
+        scheduled = ScheduleFlushLocked();
+    }
+    if (!scheduled) {
+        Flush();
+    }
+}
+
+void LogStorage::AppendRecordLocked(RecordType type, const std::string& key, const std::string& value)
+{
+    EncodeRecord(pendingRecords_, static_cast<uint8_t>(type), key, value);
+    logSize_ += GetRecordSize(key, value);
+}
+
+bool LogStorage::ScheduleFlushLocked()
+{
+    if (flushScheduled_) {
+        return true;
+    }
+    if (!taskExecutor_) {
+        return false;
+    }
+    // Changes made before the task runs are written together.
+    flushScheduled_ = taskExecutor_->PostTask(
+        [weak = AceType::WeakClaim(this)]() {
+            auto storage = weak.Upgrade();
+            if (storage) {
+                storage->Flush();
+            }
+        },
+        TaskExecutor::TaskType::IO);
+    return flushScheduled_;
+}
+
+void LogStorage::SetTaskExecutor(const RefPtr<TaskExecutor>& taskExecutor)
+{
+    bool scheduled = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (taskExecutor_ == taskExecutor) {
+            return;
+        }
+        taskExecutor_ = taskExecutor;
+        if (!flushScheduled_) {
+            return;
+        }
+        flushScheduled_ = false;
+        scheduled = ScheduleFlushLocked();
+    }
+    if (!scheduled) {
+        Flush();
+    }
+}
+
+bool LogStorage::NeedCompactLocked() const
+{
+    return logSize_ > COMPACT_MIN_LOG_SIZE && liveSize_ * 2 < logSize_;
+}
+
+void LogStorage::Flush()
+{
+    std::lock_guard<std::mutex> fileLock(fileMutex_);
+    std::string records;
+    bool truncate = false;
+    bool needCompact = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records.swap(pendingRecords_);
+        truncate = truncatePending_;
+        truncatePending_ = false;
+        flushScheduled_ = false;
+        needCompact = NeedCompactLocked();
+    }
+    if (needCompact) {
+        // The rewritten log already holds the records taken above.
+        Compact();
+        return;
+    }
+    if (records.empty() && !truncate) {
+        return;
+    }
+    ACE_SCOPED_TRACE("LogStorage::Flush %zu bytes", records.size());
+    WriteFile(path_, records, !truncate);
+}
+
+void LogStorage::Compact()
+{
+    ACE_SCOPED_TRACE("LogStorage::Compact");
+    std::string content;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        content.reserve(liveSize_);
+        for (const auto& [key, value] : values_) {
+            EncodeRecord(content, static_cast<uint8_t>(RecordType::SET_VALUE), key, value);
+        }
+        pendingRecords_.clear();
+        truncatePending_ = false;
+        liveSize_ = content.size();
+        logSize_ = content.size();
+    }
+    // Write to a temp file first, so that a crash never leaves a half written log.
+    std::string tempPath = path_ + TEMP_FILE_SUFFIX;
+    if (!WriteFile(tempPath, content, false)) {
+        std::remove(tempPath.c_str());
+        // Rewrite the whole log with the next flush instead.
+        std::lock_guard<std::mutex> lock(mutex_);
+        pendingRecords_.insert(0, content);
+        truncatePending_ = true;
+        return;
+    }
+#ifdef WINDOWS_PLATFORM
+    std::remove(path_.c_str());
+#endif
+    if (std::rename(tempPath.c_str(), path_.c_str()) != 0) {
+        LOGE("replace storage log failed");
+        std::remove(tempPath.c_str());
+    }
+}
+
+size_t LogStorage::GetKeyCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return values_.size();
+}
+
+size_t LogStorage::GetLogSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return logSize_;
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STORAGE_LOG_STORAGE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STORAGE_LOG_STORAGE_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "core/common/storage/storage.h"
+
+namespace OHOS::Ace {
+
+// LogStorage is the built-in storage used when the platform supplies none. Changes are appended to a log file and
+// the latest value of each key is kept in memory, so Get never touches the disk. Changes made in a frame are written
+// together by one task on the io thread, and the log is rewritten with the live keys only when most of it is stale.
+class ACE_EXPORT LogStorage : public Storage {
+    DECLARE_ACE_TYPE(LogStorage, Storage);
+
+public:
+    LogStorage(const std::string& path, const RefPtr<TaskExecutor>& taskExecutor);
+    ~LogStorage() override;
+
+    void Set(const std::string& key, const std::string& value) override;
+    std::string Get(const std::string& key) override;
+    void Clear() override;
+    void Delete(const std::string& key) override;
+
+    // Write the pending changes on the current thread.
+    void Flush();
+    // Write the changes on the io thread of |taskExecutor| from now on, the storage may outlive the container it is
+    // created for. A flush posted to the previous executor is posted again, since it may never run.
+    void SetTaskExecutor(const RefPtr<TaskExecutor>& taskExecutor);
+
+    size_t GetKeyCount() const;
+    size_t GetLogSize() const;
+
+private:
+    enum class RecordType : uint8_t {
+        SET_VALUE = 1,
+        DELETE_KEY,
+    };
+
+    void Load();
+    void AppendRecordLocked(RecordType type, const std::string& key, const std::string& value);
+    // Returns false if the flush can't be posted to the io thread.
+    bool ScheduleFlushLocked();
+    bool NeedCompactLocked() const;
+    void Compact();
+
+    const std::string path_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::string> values_;
+    // Bytes of the records in the log which are still the latest value of their keys.
+    size_t liveSize_ = 0;
+    size_t logSize_ = 0;
+    // Records waiting to be appended to the log.
+    std::string pendingRecords_;
+    bool truncatePending_ = false;
+    bool flushScheduled_ = false;
+
+    // Serializes writing of the log file.
+    std::mutex fileMutex_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(LogStorage);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STORAGE_LOG_STORAGE_H
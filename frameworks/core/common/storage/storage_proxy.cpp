@@ -15,7 +15,15 @@
 
 #include "core/common/storage/storage_proxy.h"
 
+#include "base/log/log.h"
+#include "core/common/ace_application_info.h"
+
 namespace OHOS::Ace {
+namespace {
+
+const char DEFAULT_STORAGE_FILE[] = "/ace_persistent_storage";
+
+} // namespace
 
 StorageProxy* StorageProxy::inst_ = nullptr;
 
@@ -35,9 +43,26 @@ void StorageProxy::SetDelegate(std::unique_ptr<StorageInterface>&& delegate)
 RefPtr<Storage> StorageProxy::GetStorage(const RefPtr<TaskExecutor>& taskExecutor) const
 {
     if (!delegate_) {
-        return nullptr;
+        return GetDefaultStorage(taskExecutor);
     }
     return delegate_->GetStorage(taskExecutor);
 }
 
+RefPtr<Storage> StorageProxy::GetDefaultStorage(const RefPtr<TaskExecutor>& taskExecutor) const
+{
+    std::lock_guard<std::mutex> lock(defaultStorageMutex_);
+    if (defaultStorage_) {
+        // The storage is shared by the containers of the process, changes are written by the one in use.
+        defaultStorage_->SetTaskExecutor(taskExecutor);
+        return defaultStorage_;
+    }
+    const auto& dataDir = AceApplicationInfo::GetInstance().GetDataFileDirPath();
+    if (dataDir.empty()) {
+        LOGW("data file dir is not set, storage is unavailable");
+        return nullptr;
+    }
+    defaultStorage_ = AceType::MakeRefPtr<LogStorage>(dataDir + DEFAULT_STORAGE_FILE, taskExecutor);
+    return defaultStorage_;
+}
+
 } // namespace OHOS::Ace
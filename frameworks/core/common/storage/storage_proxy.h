@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STORAGE_STORAGE_PROXY_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_STORAGE_STORAGE_PROXY_H
 
+#include <mutex>
+
 #include "base/utils/singleton.h"
+#include "core/common/storage/log_storage.h"
 #include "core/common/storage/storage_interface.h"
 
 namespace OHOS::Ace {
@@ -30,7 +33,12 @@ public:
     ~StorageProxy() = default;
 
 private:
+    // Storage built in the engine, used when the platform supplies none.
+    RefPtr<Storage> GetDefaultStorage(const RefPtr<TaskExecutor>& taskExecutor) const;
+
     std::unique_ptr<StorageInterface> delegate_;
+    mutable std::mutex defaultStorageMutex_;
+    mutable RefPtr<LogStorage> defaultStorage_;
     static StorageProxy* inst_;
 };
 
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/common/font_loader.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string FAMILY_NAME = "FontLoaderTestFamily";
+const std::string OTHER_FAMILY_NAME = "FontLoaderTestOtherFamily";
+const std::string ASSET_SRC = "common/font.ttf";
+const std::string BUNDLE_ASSET_PATH = "/data/bundle/entry/assets/js/default/" + ASSET_SRC;
+const std::string OTHER_BUNDLE_ASSET_PATH = "/data/other_bundle/entry/assets/js/default/" + ASSET_SRC;
+const std::string OTHER_MODULE_ASSET_PATH = "/data/bundle/feature/assets/js/default/" + ASSET_SRC;
+const std::string NETWORK_SRC = "https://www.example.com/font_loader_test.ttf";
+
+// Stands for a loader which has resolved where its font is read from.
+class TestFontLoader : public FontLoader {
+    DECLARE_ACE_TYPE(TestFontLoader, FontLoader);
+
+public:
+    TestFontLoader(const std::string& familyName, const std::string& familySrc) : FontLoader(familyName, familySrc) {}
+    ~TestFontLoader() override = default;
+
+    void AddFont(const RefPtr<PipelineContext>& context) override {}
+
+    bool Resolve(const std::string& fontPath)
+    {
+        SetFontPath(fontPath);
+        return IsLoadedInCollection();
+    }
+
+    void Load()
+    {
+        NotifyLoaded();
+    }
+};
+
+} // namespace
+
+class FontLoaderTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: IsLoadedInCollection001
+ * @tc.desc: Test a font from assets is shared only with loaders which read the same asset.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontLoaderTest, IsLoadedInCollection001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Load a font from the assets of a bundle.
+     * @tc.expected: step1. The font is not in the collection until it is loaded.
+     */
+    auto loader = AceType::MakeRefPtr<TestFontLoader>(FAMILY_NAME, ASSET_SRC);
+    EXPECT_FALSE(loader->Resolve(BUNDLE_ASSET_PATH));
+    loader->Load();
+    EXPECT_TRUE(loader->Resolve(BUNDLE_ASSET_PATH));
+
+    /**
+     * @tc.steps: step2. Resolve the same family and source in another container of the same module.
+     * @tc.expected: step2. The font is reused.
+     */
+    auto sameLoader = AceType::MakeRefPtr<TestFontLoader>(FAMILY_NAME, ASSET_SRC);
+    EXPECT_TRUE(sameLoader->Resolve(BUNDLE_ASSET_PATH));
+
+    /**
+     * @tc.steps: step3. Resolve the same family and source in another bundle and another module, and the same asset
+     *                   for another family.
+     * @tc.expected: step3. None of them is taken as loaded.
+     */
+    auto otherBundleLoader = AceType::MakeRefPtr<TestFontLoader>(FAMILY_NAME, ASSET_SRC);
+    EXPECT_FALSE(otherBundleLoader->Resolve(OTHER_BUNDLE_ASSET_PATH));
+    auto otherModuleLoader = AceType::MakeRefPtr<TestFontLoader>(FAMILY_NAME, ASSET_SRC);
+    EXPECT_FALSE(otherModuleLoader->Resolve(OTHER_MODULE_ASSET_PATH));
+    auto otherFamilyLoader = AceType::MakeRefPtr<TestFontLoader>(OTHER_FAMILY_NAME, ASSET_SRC);
+    EXPECT_FALSE(otherFamilyLoader->Resolve(BUNDLE_ASSET_PATH));
+}
+
+/**
+ * @tc.name: IsLoadedInCollection002
+ * @tc.desc: Test fonts from the network are shared by url, and fonts of unknown path are never shared.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontLoaderTest, IsLoadedInCollection002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Load a font from the network, then resolve the same url in another loader.
+     * @tc.expected: step1. The font is reused.
+     */
+    auto loader = AceType::MakeRefPtr<TestFontLoader>(FAMILY_NAME, NETWORK_SRC);
+    EXPECT_FALSE(loader->Resolve(NETWORK_SRC));
+    loader->Load();
+    auto sameLoader = AceType::MakeRefPtr<TestFontLoader>(FAMILY_NAME, NETWORK_SRC);
+    EXPECT_TRUE(sameLoader->Resolve(NETWORK_SRC));
+
+    /**
+     * @tc.steps: step2. Load a font whose asset path can't be resolved, then another one of the same source.
+     * @tc.expected: step2. The font is not recorded, so the other one is loaded on its own.
+     */
+    auto unresolvedLoader = AceType::MakeRefPtr<TestFontLoader>(OTHER_FAMILY_NAME, ASSET_SRC);
+    EXPECT_FALSE(unresolvedLoader->Resolve(""));
+    unresolvedLoader->Load();
+    auto otherLoader = AceType::MakeRefPtr<TestFontLoader>(OTHER_FAMILY_NAME, ASSET_SRC);
+    EXPECT_FALSE(otherLoader->Resolve(""));
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <thread>
+
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "core/common/stall_sampler.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr uint32_t STALL_THRESHOLD = 20;
+constexpr int64_t STALLED_TASK_TIME = 200;
+constexpr int64_t SHORT_TASK_TIME = 2;
+constexpr int64_t REPORT_WAIT_TIME = 1000;
+constexpr int64_t NO_REPORT_WAIT_TIME = 200;
+constexpr int32_t TRACE_ID = 1024;
+// Must be the signal used by the sampler.
+constexpr int32_t SAMPLE_SIGNAL_OFFSET = 5;
+
+std::atomic<int32_t> g_previousHandlerCalls { 0 };
+std::atomic<int32_t> g_profHandlerCalls { 0 };
+
+void OnPreviousHandler(int32_t sigNum)
+{
+    ++g_previousHandlerCalls;
+}
+
+void OnProfHandler(int32_t sigNum)
+{
+    ++g_profHandlerCalls;
+}
+
+void Spin(int64_t milliseconds)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+}
+
+// Runs a task on a new watched thread and returns the report of the sampler.
+std::string RunTask(int64_t taskTime, int64_t waitTime, bool nested = false)
+{
+    std::string report;
+    std::thread thread([taskTime, waitTime, nested, &report]() {
+        auto& sampler = StallSampler::GetInstance();
+        auto stalledThread = sampler.WatchCurrentThread("StallSamplerTest");
+        {
+            StallSampler::TaskScope scope(TRACE_ID);
+            if (nested) {
+                StallSampler::TaskScope innerScope(TRACE_ID + 1);
+                Spin(taskTime);
+            } else {
+                Spin(taskTime);
+            }
+        }
+        // The sampler reports a task after it has ended.
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(waitTime);
+        while (report.empty() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SHORT_TASK_TIME));
+            report = stalledThread->GetLastReport();
+        }
+        sampler.Unwatch(stalledThread);
+    });
+    thread.join();
+    return report;
+}
+
+} // namespace
+
+class StallSamplerTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        // Installed before the sampler, to be chained by the handler of the sampler.
+        struct sigaction action = {};
+        action.sa_handler = OnPreviousHandler;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGRTMIN + SAMPLE_SIGNAL_OFFSET, &action, nullptr);
+        action.sa_handler = OnProfHandler;
+        sigaction(SIGPROF, &action, &profAction_);
+        StallSampler::GetInstance().SetThreshold(STALL_THRESHOLD);
+    }
+    static void TearDownTestCase()
+    {
+        sigaction(SIGPROF, &profAction_, nullptr);
+    }
+    void SetUp() {}
+    void TearDown() {}
+
+private:
+    static struct sigaction profAction_;
+};
+
+struct sigaction StallSamplerTest::profAction_ = {};
+
+/**
+ * @tc.name: StallSampler001
+ * @tc.desc: Test a task running longer than the threshold is reported with its trace id.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StallSamplerTest, StallSampler001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Run a task longer than the threshold on a watched thread.
+     * @tc.expected: step1. The task is reported with the name of the thread and its trace id.
+     */
+    std::string report = RunTask(STALLED_TASK_TIME, REPORT_WAIT_TIME);
+    EXPECT_NE(report.find("Stalled thread = StallSamplerTest"), std::string::npos);
+    EXPECT_NE(report.find("trace id = " + std::to_string(TRACE_ID)), std::string::npos);
+#ifdef OHOS_PLATFORM
+    /**
+     * @tc.steps: step2. Check the samples of the task.
+     * @tc.expected: step2. The stack of the thread is sampled.
+     */
+    EXPECT_NE(report.find("Stack sampled"), std::string::npos);
+#endif
+}
+
+/**
+ * @tc.name: StallSampler002
+ * @tc.desc: Test tasks shorter than the threshold and nested tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StallSamplerTest, StallSampler002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Run a task shorter than the threshold.
+     * @tc.expected: step1. Nothing is reported.
+     */
+    EXPECT_TRUE(RunTask(SHORT_TASK_TIME, NO_REPORT_WAIT_TIME).empty());
+
+    /**
+     * @tc.steps: step2. Run a stalled task inside of another task.
+     * @tc.expected: step2. The task is reported with the trace id of the outer task.
+     */
+    std::string report = RunTask(STALLED_TASK_TIME, REPORT_WAIT_TIME, true);
+    EXPECT_NE(report.find("trace id = " + std::to_string(TRACE_ID) + ","), std::string::npos);
+}
+
+/**
+ * @tc.name: StallSampler003
+ * @tc.desc: Test the sampler leaves signals of other users alone.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StallSamplerTest, StallSampler003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Sample a stalled task.
+     * @tc.expected: step1. SIGPROF is neither taken over nor raised by the sampler.
+     */
+    int32_t profCalls = g_profHandlerCalls.load();
+    int32_t previousCalls = g_previousHandlerCalls.load();
+    EXPECT_FALSE(RunTask(STALLED_TASK_TIME, REPORT_WAIT_TIME).empty());
+    struct sigaction action = {};
+    sigaction(SIGPROF, nullptr, &action);
+    EXPECT_EQ(action.sa_handler, OnProfHandler);
+    EXPECT_EQ(g_profHandlerCalls.load(), profCalls);
+    EXPECT_EQ(g_previousHandlerCalls.load(), previousCalls);
+
+    /**
+     * @tc.steps: step2. Queue the signal of the sampler from outside of the sampler.
+     * @tc.expected: step2. The signal is passed to the handler installed before the sampler.
+     */
+    union sigval value = {};
+    ASSERT_EQ(sigqueue(getpid(), SIGRTMIN + SAMPLE_SIGNAL_OFFSET, value), 0);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(REPORT_WAIT_TIME);
+    while (g_previousHandlerCalls.load() == previousCalls && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SHORT_TASK_TIME));
+    }
+    EXPECT_EQ(g_previousHandlerCalls.load(), previousCalls + 1);
+}
+
+} // namespace OHOS::Ace
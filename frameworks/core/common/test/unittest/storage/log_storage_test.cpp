@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#include "core/common/storage/log_storage.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string STORAGE_PATH = "/data/test/log_storage_test";
+constexpr size_t KEY_COUNT = 10000;
+constexpr size_t LARGE_VALUE_SIZE = 4096;
+constexpr size_t OVERWRITE_TIMES = 200;
+
+// Keeps posted tasks until the test runs them, to check the changes are written by one task.
+class ManualTaskExecutor final : public TaskExecutor {
+public:
+    // An executor not accepting tasks stands for one whose threads are gone.
+    explicit ManualTaskExecutor(bool acceptTasks = true) : acceptTasks_(acceptTasks) {}
+
+    void AddTaskObserver(Task&& callback) override {}
+    void RemoveTaskObserver() override {}
+    bool WillRunOnCurrentThread(TaskType type) const override
+    {
+        return false;
+    }
+    Task WrapTaskWithTraceId(Task&& task, int32_t id) const override
+    {
+        return std::move(task);
+    }
+
+    size_t RunAll()
+    {
+        std::vector<Task> tasks;
+        tasks.swap(tasks_);
+        for (auto& task : tasks) {
+            task();
+        }
+        return tasks.size();
+    }
+
+private:
+    bool OnPostTask(Task&& task, TaskType type, uint32_t delayTime) const override
+    {
+        if (!acceptTasks_) {
+            return false;
+        }
+        tasks_.emplace_back(std::move(task));
+        return true;
+    }
+
+    bool acceptTasks_ = true;
+    mutable std::vector<Task> tasks_;
+};
+
+} // namespace
+
+class LogStorageTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp()
+    {
+        std::remove(STORAGE_PATH.c_str());
+    }
+    void TearDown()
+    {
+        std::remove(STORAGE_PATH.c_str());
+    }
+};
+
+/**
+ * @tc.name: LogStorageTest001
+ * @tc.desc: Verify changes are kept after the storage is loaded again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LogStorageTest, LogStorageTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set, overwrite and delete keys.
+     * @tc.expected: step1. Get returns the latest values.
+     */
+    {
+        auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+        storage->Set("name", "ace");
+        storage->Set("count", "1");
+        storage->Set("count", "2");
+        storage->Set("temp", "value");
+        storage->Delete("temp");
+        EXPECT_EQ(storage->Get("count"), "2");
+        EXPECT_EQ(storage->Get("temp"), "");
+    }
+
+    /**
+     * @tc.steps: step2. load the storage again.
+     * @tc.expected: step2. the values are read from the log.
+     */
+    {
+        auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+        EXPECT_EQ(storage->GetKeyCount(), 2UL);
+        EXPECT_EQ(storage->Get("name"), "ace");
+        EXPECT_EQ(storage->Get("count"), "2");
+        EXPECT_EQ(storage->Get("temp"), "");
+        storage->Clear();
+    }
+
+    /**
+     * @tc.steps: step3. load the storage after clear.
+     * @tc.expected: step3. the storage is empty.
+     */
+    auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+    EXPECT_EQ(storage->GetKeyCount(), 0UL);
+    EXPECT_EQ(storage->GetLogSize(), 0UL);
+}
+
+/**
+ * @tc.name: LogStorageTest002
+ * @tc.desc: Verify a torn record at the end of the log is dropped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LogStorageTest, LogStorageTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. write a key and append a partial record to the log.
+     */
+    {
+        auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+        storage->Set("key", "value");
+    }
+    {
+        std::ofstream file(STORAGE_PATH, std::ios::binary | std::ios::app);
+        file.write("\x01\x10\x00", 3);
+    }
+
+    /**
+     * @tc.steps: step2. load the log and write to it.
+     * @tc.expected: step2. complete records are kept and new records can be read back.
+     */
+    {
+        auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+        EXPECT_EQ(storage->Get("key"), "value");
+        storage->Set("other", "value");
+    }
+    auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+    EXPECT_EQ(storage->GetKeyCount(), 2UL);
+    EXPECT_EQ(storage->Get("other"), "value");
+}
+
+/**
+ * @tc.name: LogStorageTest003
+ * @tc.desc: Verify changes are written by one task, and the stale log is compacted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LogStorageTest, LogStorageTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. overwrite a key with large values many times.
+     * @tc.expected: step1. only one flush task is posted.
+     */
+    auto executor = AceType::MakeRefPtr<ManualTaskExecutor>();
+    auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, executor);
+    for (size_t i = 0; i < OVERWRITE_TIMES; ++i) {
+        storage->Set("large", std::string(LARGE_VALUE_SIZE, static_cast<char>('a' + i % 26)));
+    }
+    EXPECT_EQ(executor->RunAll(), 1UL);
+
+    /**
+     * @tc.steps: step2. check the log.
+     * @tc.expected: step2. the log only holds the latest value.
+     */
+    EXPECT_LT(storage->GetLogSize(), 2 * LARGE_VALUE_SIZE);
+    auto reloaded = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+    EXPECT_EQ(reloaded->Get("large"), storage->Get("large"));
+}
+
+/**
+ * @tc.name: LogStorageTest004
+ * @tc.desc: Measure set, get and load of 10k keys.
+ * @tc.type: PERF
+ */
+HWTEST_F(LogStorageTest, LogStorageTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set 10k keys and write them with one task.
+     */
+    auto executor = AceType::MakeRefPtr<ManualTaskExecutor>();
+    auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, executor);
+    int64_t begin = GetMicroTickCount();
+    for (size_t i = 0; i < KEY_COUNT; ++i) {
+        storage->Set("key_" + std::to_string(i), "value_" + std::to_string(i));
+    }
+    int64_t setCost = GetMicroTickCount() - begin;
+    begin = GetMicroTickCount();
+    EXPECT_EQ(executor->RunAll(), 1UL);
+    int64_t flushCost = GetMicroTickCount() - begin;
+
+    /**
+     * @tc.steps: step2. get every key.
+     * @tc.expected: step2. values are read from memory.
+     */
+    begin = GetMicroTickCount();
+    for (size_t i = 0; i < KEY_COUNT; ++i) {
+        EXPECT_EQ(storage->Get("key_" + std::to_string(i)), "value_" + std::to_string(i));
+    }
+    int64_t getCost = GetMicroTickCount() - begin;
+
+    /**
+     * @tc.steps: step3. load the storage as an app starts.
+     * @tc.expected: step3. every key is loaded.
+     */
+    begin = GetMicroTickCount();
+    auto reloaded = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+    int64_t loadCost = GetMicroTickCount() - begin;
+    EXPECT_EQ(reloaded->GetKeyCount(), KEY_COUNT);
+    LOGI("storage of %{public}zu keys: set %{public}lld us, flush %{public}lld us, get %{public}lld us, "
+         "load %{public}lld us",
+        KEY_COUNT, static_cast<long long>(setCost), static_cast<long long>(flushCost),
+        static_cast<long long>(getCost), static_cast<long long>(loadCost));
+}
+
+/**
+ * @tc.name: LogStorageTest005
+ * @tc.desc: Verify changes are written after the executor of the storage is replaced or rejects tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LogStorageTest, LogStorageTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set a key, then move the storage to another executor before the flush runs.
+     * @tc.expected: step1. the flush is posted to the new executor, which writes the key.
+     */
+    auto deadExecutor = AceType::MakeRefPtr<ManualTaskExecutor>();
+    auto storage = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, deadExecutor);
+    storage->Set("first", "1");
+    auto executor = AceType::MakeRefPtr<ManualTaskExecutor>();
+    storage->SetTaskExecutor(executor);
+    EXPECT_EQ(executor->RunAll(), 1UL);
+    EXPECT_EQ(AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr)->Get("first"), "1");
+
+    /**
+     * @tc.steps: step2. set another key.
+     * @tc.expected: step2. the flush is posted to the new executor only.
+     */
+    storage->Set("second", "2");
+    EXPECT_EQ(executor->RunAll(), 1UL);
+    EXPECT_EQ(deadExecutor->RunAll(), 1UL);
+
+    /**
+     * @tc.steps: step3. move the storage to an executor rejecting tasks, and set a key.
+     * @tc.expected: step3. the key is written at once, later keys are still written.
+     */
+    storage->SetTaskExecutor(AceType::MakeRefPtr<ManualTaskExecutor>(false));
+    storage->Set("third", "3");
+    EXPECT_EQ(AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr)->Get("third"), "3");
+    storage->Set("fourth", "4");
+    auto reloaded = AceType::MakeRefPtr<LogStorage>(STORAGE_PATH, nullptr);
+    EXPECT_EQ(reloaded->GetKeyCount(), 4UL);
+    EXPECT_EQ(reloaded->Get("fourth"), "4");
+}
+
+} // namespace OHOS::Ace
@@ -29,6 +29,7 @@
 #include "bridge/common/utils/engine_helper.h"
 #include "core/common/ace_application_info.h"
 #include "core/common/ace_engine.h"
+#include "core/common/stall_sampler.h"
 
 namespace OHOS::Ace {
 namespace {
@@ -154,6 +155,7 @@ private:
     void ShowDialog() const;
     void DefusingTopBomb();
     void DetonatedBomb();
+    void WatchStall();
 
     mutable std::shared_mutex mutex_;
     int32_t instanceId_ = 0;
@@ -168,6 +170,7 @@ private:
     bool canShowDialog_ = true;
     int32_t showDialogCount_ = 0;
     bool useUIAsJSThread_ = false;
+    RefPtr<StalledThread> stalledThread_;
 };
 
 ThreadWatcher::ThreadWatcher(int32_t instanceId, TaskExecutor::TaskType type, bool useUIAsJSThread)
@@ -184,11 +187,35 @@ ThreadWatcher::ThreadWatcher(int32_t instanceId, TaskExecutor::TaskType type, bo
         NORMAL_CHECK_PERIOD);
 }
 
-ThreadWatcher::~ThreadWatcher() {}
+ThreadWatcher::~ThreadWatcher()
+{
+    StallSampler::GetInstance().Unwatch(stalledThread_);
+}
 
 void ThreadWatcher::SetTaskExecutor(const RefPtr<TaskExecutor>& taskExecutor)
 {
     taskExecutor_ = taskExecutor;
+    if (taskExecutor) {
+        // Sample the stacks of tasks which stall the thread but are too short to be found stuck.
+        taskExecutor->PostTask(
+            [weak = Referenced::WeakClaim(this)]() {
+                auto sp = weak.Upgrade();
+                if (sp) {
+                    sp->WatchStall();
+                }
+            },
+            type_);
+    }
+}
+
+void ThreadWatcher::WatchStall()
+{
+    auto stalledThread = StallSampler::GetInstance().WatchCurrentThread(threadName_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (stalledThread_) {
+        StallSampler::GetInstance().Unwatch(stalledThread_);
+    }
+    stalledThread_ = stalledThread;
 }
 
 void ThreadWatcher::BuriedBomb(uint64_t bombId)
@@ -372,6 +399,13 @@ void ThreadWatcher::RawReport(RawEventType type) const
     std::string threadInfo = "Blocked thread id = " + std::to_string(tid) + "\n";
     threadInfo += "JSVM instance id = " + std::to_string(instanceId_) + "\n";
     message = threadInfo + message;
+    {
+        // Stacks of the last stall give a hint of what the thread was doing before it got stuck.
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (stalledThread_) {
+            message += stalledThread_->GetLastReport();
+        }
+    }
     EventReport::ANRRawReport(type, AceApplicationInfo::GetInstance().GetUid(),
         AceApplicationInfo::GetInstance().GetPackageName(), AceApplicationInfo::GetInstance().GetProcessName(),
         message);
@@ -28,6 +28,7 @@
 #include "include/effects/SkGradientShader.h"
 #include "include/utils/SkShadowUtils.h"
 
+#include "core/components/common/painter/shadow_mask_cache.h"
 #include "core/components/common/properties/color.h"
 #include "core/pipeline/base/flutter_render_context.h"
 #include "core/pipeline/base/render_node.h"
@@ -2214,11 +2215,15 @@ void FlutterDecorationPainter::PaintBoxShadows(
                     top + SkDoubleToScalar(shadow.GetOffset().GetY() - shadow.GetSpreadRadius()),
                     SkDoubleToScalar(width > 0.0 ? width : 0.0), SkDoubleToScalar(height > 0.0 ? height : 0.0));
                 shadowRRect.setRectRadii(skRect, fRadii);
+                float sigma = ConvertRadiusToSigma(shadow.GetBlurRadius());
+                if (ShadowMaskCache::GetInstance().DrawBlurredRRect(
+                        canvas, shadowRRect, sigma, shadow.GetColor().GetValue())) {
+                    continue;
+                }
                 SkPaint paint;
                 paint.setColor(shadow.GetColor().GetValue());
                 paint.setAntiAlias(true);
-                paint.setMaskFilter(SkMaskFilter::MakeBlur(
-                    SkBlurStyle::kNormal_SkBlurStyle, ConvertRadiusToSigma(shadow.GetBlurRadius())));
+                paint.setMaskFilter(SkMaskFilter::MakeBlur(SkBlurStyle::kNormal_SkBlurStyle, sigma));
                 canvas->drawRRect(shadowRRect, paint);
             }
         }
@@ -2255,11 +2260,22 @@ void FlutterDecorationPainter::PaintShadow(const SkPath& path, const Shadow& sha
         SkShadowUtils::DrawShadow(canvas, skPath, planeParams, lightPos, shadow.GetLightRadius(), ambientColor,
             spotColor, SkShadowFlags::kTransparentOccluder_ShadowFlag);
     } else {
-        SkPaint paint;
-        paint.setColor(spotColor);
-        paint.setAntiAlias(true);
-        paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, ConvertRadiusToSigma(shadow.GetBlurRadius())));
-        canvas->drawPath(skPath, paint);
+        float sigma = ConvertRadiusToSigma(shadow.GetBlurRadius());
+        SkRRect rrect;
+        SkRect rect;
+        if (skPath.isRect(&rect)) {
+            rrect.setRect(rect);
+        } else if (!skPath.isRRect(&rrect)) {
+            rrect.setEmpty();
+        }
+        // Shadows of boxes are drawn with the cached masks, other paths are blurred.
+        if (!ShadowMaskCache::GetInstance().DrawBlurredRRect(canvas, rrect, sigma, spotColor)) {
+            SkPaint paint;
+            paint.setColor(spotColor);
+            paint.setAntiAlias(true);
+            paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, sigma));
+            canvas->drawPath(skPath, paint);
+        }
     }
     canvas->restore();
 }
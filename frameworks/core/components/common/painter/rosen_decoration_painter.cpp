@@ -31,6 +31,7 @@
 #include "include/utils/SkShadowUtils.h"
 #include "render_service_client/core/ui/rs_node.h"
 
+#include "core/components/common/painter/shadow_mask_cache.h"
 #include "core/components/common/properties/color.h"
 #include "core/pipeline/base/render_node.h"
 #include "core/pipeline/base/rosen_render_context.h"
@@ -2134,11 +2135,15 @@ void RosenDecorationPainter::PaintBoxShadows(const SkRRect& rrect, const std::ve
                     top + SkDoubleToScalar(shadow.GetOffset().GetY() - shadow.GetSpreadRadius()),
                     SkDoubleToScalar(width > 0.0 ? width : 0.0), SkDoubleToScalar(height > 0.0 ? height : 0.0));
                 shadowRRect.setRectRadii(skRect, fRadii);
+                float sigma = ConvertRadiusToSigma(shadow.GetBlurRadius());
+                if (ShadowMaskCache::GetInstance().DrawBlurredRRect(
+                        canvas, shadowRRect, sigma, shadow.GetColor().GetValue())) {
+                    continue;
+                }
                 SkPaint paint;
                 paint.setColor(shadow.GetColor().GetValue());
                 paint.setAntiAlias(true);
-                paint.setMaskFilter(SkMaskFilter::MakeBlur(
-                    SkBlurStyle::kNormal_SkBlurStyle, ConvertRadiusToSigma(shadow.GetBlurRadius())));
+                paint.setMaskFilter(SkMaskFilter::MakeBlur(SkBlurStyle::kNormal_SkBlurStyle, sigma));
                 canvas->drawRRect(shadowRRect, paint);
             }
         }
@@ -2174,11 +2179,22 @@ void RosenDecorationPainter::PaintShadow(const SkPath& path, const Shadow& shado
         SkShadowUtils::DrawShadow(canvas, skPath, planeParams, lightPos, shadow.GetLightRadius(), ambientColor,
             spotColor, SkShadowFlags::kTransparentOccluder_ShadowFlag);
     } else {
-        SkPaint paint;
-        paint.setColor(spotColor);
-        paint.setAntiAlias(true);
-        paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, ConvertRadiusToSigma(shadow.GetBlurRadius())));
-        canvas->drawPath(skPath, paint);
+        float sigma = ConvertRadiusToSigma(shadow.GetBlurRadius());
+        SkRRect rrect;
+        SkRect rect;
+        if (skPath.isRect(&rect)) {
+            rrect.setRect(rect);
+        } else if (!skPath.isRRect(&rrect)) {
+            rrect.setEmpty();
+        }
+        // Shadows of boxes are drawn with the cached masks, other paths are blurred.
+        if (!ShadowMaskCache::GetInstance().DrawBlurredRRect(canvas, rrect, sigma, spotColor)) {
+            SkPaint paint;
+            paint.setColor(spotColor);
+            paint.setAntiAlias(true);
+            paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, sigma));
+            canvas->drawPath(skPath, paint);
+        }
     }
     canvas->restore();
 }
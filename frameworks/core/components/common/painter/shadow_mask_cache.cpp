@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components/common/painter/shadow_mask_cache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "include/core/SkMaskFilter.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSurface.h"
+
+#include "base/log/ace_trace.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr size_t MAX_CACHED_MASKS = 32;
+// Larger masks cost more memory than blurring them again.
+constexpr int32_t MAX_MASK_SIDE = 512;
+// The blur of a normal distribution is invisible beyond three sigma.
+constexpr float BLUR_EXTENT_SCALE = 3.0f;
+constexpr int32_t CORNER_COUNT = 4;
+
+bool IsSameRadii(const SkVector lhs[CORNER_COUNT], const SkVector rhs[CORNER_COUNT])
+{
+    for (int32_t i = 0; i < CORNER_COUNT; ++i) {
+        if (!NearEqual(lhs[i].fX, rhs[i].fX) || !NearEqual(lhs[i].fY, rhs[i].fY)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Length of the side from the edge of the mask to the stretched pixel, where the blur of the corner fades.
+int32_t GetUnstretchedLength(SkScalar radius, SkScalar otherRadius, int32_t margin)
+{
+    return static_cast<int32_t>(std::ceil(std::max(radius, otherRadius))) + 2 * margin;
+}
+
+} // namespace
+
+ShadowMaskCache& ShadowMaskCache::GetInstance()
+{
+    static ShadowMaskCache instance;
+    return instance;
+}
+
+bool ShadowMaskCache::DrawBlurredRRect(SkCanvas* canvas, const SkRRect& rrect, float sigma, SkColor color)
+{
+    if (!canvas || sigma <= 0.0f || rrect.isEmpty()) {
+        return false;
+    }
+    const SkMatrix& matrix = canvas->getTotalMatrix();
+    if (!matrix.isScaleTranslate() || matrix.getScaleX() <= 0.0f || matrix.getScaleY() <= 0.0f) {
+        return false;
+    }
+
+    // Blur in device pixels, so the mask is as sharp as the blur drawn directly.
+    SkScalar scaleX = matrix.getScaleX();
+    SkScalar scaleY = matrix.getScaleY();
+    SkRRect deviceRRect;
+    if (!rrect.transform(SkMatrix::MakeScale(scaleX, scaleY), &deviceRRect)) {
+        return false;
+    }
+    float deviceSigma = sigma * std::sqrt(scaleX * scaleY);
+    auto margin = static_cast<int32_t>(std::ceil(BLUR_EXTENT_SCALE * deviceSigma));
+
+    Entry entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!GetMaskLocked(deviceRRect, deviceSigma, margin, entry)) {
+            return false;
+        }
+    }
+
+    SkAutoCanvasRestore restore(canvas, true);
+    canvas->scale(1.0f / scaleX, 1.0f / scaleY);
+    SkPaint paint;
+    paint.setColor(color);
+    paint.setAntiAlias(true);
+    // The mask only has alpha, it is drawn in the color of the paint.
+    canvas->drawImageNine(entry.mask.get(), entry.center, deviceRRect.rect().makeOutset(margin, margin), &paint);
+    return true;
+}
+
+bool ShadowMaskCache::GetMaskLocked(const SkRRect& rrect, float sigma, int32_t margin, Entry& result)
+{
+    SkVector radii[CORNER_COUNT] = { rrect.radii(SkRRect::kUpperLeft_Corner),
+        rrect.radii(SkRRect::kUpperRight_Corner), rrect.radii(SkRRect::kLowerRight_Corner),
+        rrect.radii(SkRRect::kLowerLeft_Corner) };
+    int32_t left = GetUnstretchedLength(radii[0].fX, radii[3].fX, margin);
+    int32_t right = GetUnstretchedLength(radii[1].fX, radii[2].fX, margin);
+    int32_t top = GetUnstretchedLength(radii[0].fY, radii[1].fY, margin);
+    int32_t bottom = GetUnstretchedLength(radii[3].fY, radii[2].fY, margin);
+    // The shortest rrect which has a straight pixel in the middle of each edge.
+    int32_t width = left + right + 1;
+    int32_t height = top + bottom + 1;
+    if (rrect.width() < width || rrect.height() < height) {
+        // The blur of corners overlaps in a box this small, it can't be stretched.
+        return false;
+    }
+    if (width + 2 * margin > MAX_MASK_SIDE || height + 2 * margin > MAX_MASK_SIDE) {
+        return false;
+    }
+
+    auto iter = std::find_if(entries_.begin(), entries_.end(),
+        [&radii, sigma](const Entry& entry) {
+            return NearEqual(entry.sigma, sigma) && IsSameRadii(entry.radii, radii);
+        });
+    if (iter != entries_.end()) {
+        if (iter != entries_.begin()) {
+            entries_.splice(entries_.begin(), entries_, iter);
+        }
+        result = entries_.front();
+        return true;
+    }
+
+    ACE_SCOPED_TRACE("ShadowMaskCache::CreateMask %d x %d", width, height);
+    auto surface = SkSurface::MakeRaster(SkImageInfo::MakeA8(width + 2 * margin, height + 2 * margin));
+    if (!surface) {
+        return false;
+    }
+    SkRRect maskRRect;
+    maskRRect.setRectRadii(SkRect::MakeXYWH(margin, margin, width, height), radii);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, sigma));
+    surface->getCanvas()->drawRRect(maskRRect, paint);
+
+    Entry entry;
+    std::copy(std::begin(radii), std::end(radii), std::begin(entry.radii));
+    entry.sigma = sigma;
+    entry.mask = surface->makeImageSnapshot();
+    entry.center = SkIRect::MakeXYWH(margin + left, margin + top, 1, 1);
+    if (!entry.mask) {
+        return false;
+    }
+    if (entries_.size() >= MAX_CACHED_MASKS) {
+        entries_.pop_back();
+    }
+    entries_.emplace_front(entry);
+    result = std::move(entry);
+    return true;
+}
+
+size_t ShadowMaskCache::GetCachedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void ShadowMaskCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_COMMON_PAINTER_SHADOW_MASK_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_COMMON_PAINTER_SHADOW_MASK_CACHE_H
+
+#include <list>
+#include <mutex>
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkRRect.h"
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// ShadowMaskCache keeps blurred masks of rounded rects. A mask is blurred once for its corner radii and blur sigma
+// with the shortest straight edges, and drawn as a nine patch stretched to the size of the box, so boxes sharing a
+// shadow style are not blurred again in every frame.
+class ACE_EXPORT ShadowMaskCache final {
+public:
+    static ShadowMaskCache& GetInstance();
+
+    // Draws |rrect| blurred by |sigma| in |color|. Returns false if nothing is drawn, then the caller should draw it
+    // with a blur mask filter instead.
+    bool DrawBlurredRRect(SkCanvas* canvas, const SkRRect& rrect, float sigma, SkColor color);
+
+    size_t GetCachedCount() const;
+    void Clear();
+
+private:
+    struct Entry {
+        SkVector radii[4];
+        float sigma = 0.0f;
+        sk_sp<SkImage> mask;
+        // The pixel stretched to the size of the box.
+        SkIRect center;
+    };
+
+    ShadowMaskCache() = default;
+    ~ShadowMaskCache() = default;
+
+    bool GetMaskLocked(const SkRRect& rrect, float sigma, int32_t margin, Entry& result);
+
+    mutable std::mutex mutex_;
+    // Masks in the order of last use.
+    std::list<Entry> entries_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ShadowMaskCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_COMMON_PAINTER_SHADOW_MASK_CACHE_H
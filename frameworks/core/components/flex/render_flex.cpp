@@ -265,6 +265,10 @@ void RenderFlex::PerformLayout()
     } else {
         PerformLayoutInItemMode();
     }
+    // Children left laid out with the layout params of the measurement are laid out again.
+    for (const auto& child : GetChildren()) {
+        child->FlushCachedLayout();
+    }
     ClearChildrenLists();
 
     if (alignPtr_ != nullptr) {
@@ -723,7 +727,7 @@ void RenderFlex::PlaceChildren(double frontSpace, double betweenSpace, const Bas
             case FlexAlign::BASELINE:
                 childCrossPos = 0.0;
                 if (direction_ == FlexDirection::ROW || direction_ == FlexDirection::ROW_REVERSE) {
-                    double distance = item->GetBaselineDistance(textBaseline_);
+                    double distance = item->GetCachedBaselineDistance(textBaseline_);
                     childCrossPos = baselineProperties.maxBaselineDistance - distance;
                 }
                 break;
@@ -797,7 +801,7 @@ void RenderFlex::RelayoutFlexItem(const RefPtr<RenderFlexItem>& flexItem, double
         return;
     }
     auto mainFlexExtent = flexSize + GetMainSize(flexItem);
-    auto childMainContent = GetMainAxisValue(flexItem->GetContentSize(), direction_);
+    auto childMainContent = GetMainAxisValue(flexItem->GetCachedContentSize(), direction_);
     if (childMainContent > mainFlexExtent) {
         mainFlexExtent = childMainContent;
     }
@@ -856,7 +860,7 @@ void RenderFlex::CheckBaselineProperties(const RefPtr<RenderNode>& item, Baselin
     auto flexItem = AceType::DynamicCast<RenderFlexItem>(item);
     bool isChildBaselineAlign = flexItem ? flexItem->GetAlignSelf() == FlexAlign::BASELINE : false;
     if (crossAxisAlign_ == FlexAlign::BASELINE || isChildBaselineAlign) {
-        double distance = item->GetBaselineDistance(textBaseline_);
+        double distance = item->GetCachedBaselineDistance(textBaseline_);
         baselineProperties.maxBaselineDistance = std::max(baselineProperties.maxBaselineDistance, distance);
         baselineProperties.maxDistanceAboveBaseline = std::max(baselineProperties.maxDistanceAboveBaseline, distance);
         baselineProperties.maxDistanceBelowBaseline =
@@ -1228,7 +1232,9 @@ void RenderFlex::Dump()
                                        .append(", MainAxisSize: ")
                                        .append(std::to_string(static_cast<int32_t>(mainAxisSize_)))
                                        .append(", CrossAxisSize: ")
-                                       .append(std::to_string(static_cast<int32_t>(crossAxisSize_))));
+                                       .append(std::to_string(static_cast<int32_t>(crossAxisSize_)))
+                                       .append(", LayoutCacheHits: ")
+                                       .append(std::to_string(GetLayoutCacheHitCount())));
 }
 
 bool RenderFlex::CheckIfNeedLayoutAgain()
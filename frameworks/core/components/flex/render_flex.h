@@ -47,6 +47,13 @@ class ACE_EXPORT RenderFlex : public RenderNode {
     DECLARE_ACE_TYPE(RenderFlex, RenderNode);
 
 public:
+    RenderFlex()
+    {
+        // Children are measured with loose layout params and laid out again with tight ones.
+        SetCacheChildrenLayout(true);
+    }
+    ~RenderFlex() override = default;
+
     static RefPtr<RenderNode> Create();
 
     void Update(const RefPtr<Component>& component) override;
@@ -33,6 +33,12 @@ void FlutterFontLoader::AddFont(const RefPtr<PipelineContext>& context)
     }
 
     if (familySrc_.substr(0, 4) == FONT_SRC_NETWORK) {
+        SetFontPath(familySrc_);
+        if (IsLoadedInCollection()) {
+            // Already loaded by another container.
+            NotifyLoaded();
+            return;
+        }
         // Get font from NetWork.
         LoadFromNetwork(context);
     } else {
@@ -62,18 +68,7 @@ void FlutterFontLoader::LoadFromNetwork(const OHOS::Ace::RefPtr<OHOS::Ace::Pipel
             // Load font.
             FlutterFontCollection::GetInstance().LoadFontFromList(
                 fontData.data(), fontData.size(), fontLoader->familyName_);
-            fontLoader->isLoaded_ = true;
-
-            // When font is already loaded, notify all which used this font.
-            for (const auto& [node, callback] : fontLoader->callbacks_) {
-                if (callback) {
-                    callback();
-                }
-            }
-            fontLoader->callbacks_.clear();
-            if (fontLoader->variationChanged_) {
-                fontLoader->variationChanged_();
-            }
+            fontLoader->NotifyLoaded();
         }, TaskExecutor::TaskType::UI);
     }, TaskExecutor::TaskType::BACKGROUND);
 }
@@ -98,6 +93,22 @@ void FlutterFontLoader::LoadFromAsset(const OHOS::Ace::RefPtr<OHOS::Ace::Pipelin
         } else if (assetSrc[0] == '.' && assetSrc.size() > 2 && assetSrc[1] == '/') {
             assetSrc = assetSrc.substr(2); // get the asset src without './'.
         }
+        // Resolve the asset in the bundle and module of this container, so that it is only shared with containers
+        // which have the same font.
+        auto assetBasePath = assetManager->GetAssetPath(assetSrc);
+        if (!assetBasePath.empty()) {
+            fontLoader->SetFontPath(assetBasePath + assetSrc);
+        }
+        if (fontLoader->IsLoadedInCollection()) {
+            // Already loaded by another container.
+            context->GetTaskExecutor()->PostTask([weak] {
+                auto fontLoader = weak.Upgrade();
+                if (fontLoader) {
+                    fontLoader->NotifyLoaded();
+                }
+            }, TaskExecutor::TaskType::UI);
+            return;
+        }
         auto assetData = assetManager->GetAsset(assetSrc);
         if (!assetData) {
             LOGE("No asset data!");
@@ -112,17 +123,7 @@ void FlutterFontLoader::LoadFromAsset(const OHOS::Ace::RefPtr<OHOS::Ace::Pipelin
             // Load font.
             FlutterFontCollection::GetInstance().LoadFontFromList(
                     assetData->GetData(), assetData->GetSize(), fontLoader->familyName_);
-            fontLoader->isLoaded_ = true;
-
-            for (const auto& [node, callback] : fontLoader->callbacks_) {
-                if (callback) {
-                    callback();
-                }
-            }
-            fontLoader->callbacks_.clear();
-            if (fontLoader->variationChanged_) {
-                fontLoader->variationChanged_();
-            }
+            fontLoader->NotifyLoaded();
         }, TaskExecutor::TaskType::UI);
     }, TaskExecutor::TaskType::BACKGROUND);
 }
@@ -23,7 +23,6 @@ void FlutterFontManager::VaryFontCollectionWithFontWeightScale()
 {
     if (GreatNotEqual(fontWeightScale_, 0.0)) {
         FlutterFontCollection::GetInstance().VaryFontCollectionWithFontWeightScale(fontWeightScale_);
-        NotifyVariationNodes();
     }
 }
 
@@ -33,6 +33,12 @@ void RosenFontLoader::AddFont(const RefPtr<PipelineContext>& context)
     }
 
     if (familySrc_.substr(0, 4) == FONT_SRC_NETWORK) {
+        SetFontPath(familySrc_);
+        if (IsLoadedInCollection()) {
+            // Already loaded by another container.
+            NotifyLoaded();
+            return;
+        }
         // Get font from NetWork.
         LoadFromNetwork(context);
     } else {
@@ -64,18 +70,7 @@ void RosenFontLoader::LoadFromNetwork(const OHOS::Ace::RefPtr<OHOS::Ace::Pipelin
                     // Load font.
                     RosenFontCollection::GetInstance().LoadFontFromList(
                         fontData.data(), fontData.size(), fontLoader->familyName_);
-                    fontLoader->isLoaded_ = true;
-
-                    // When font is already loaded, notify all which used this font.
-                    for (const auto& [node, callback] : fontLoader->callbacks_) {
-                        if (callback) {
-                            callback();
-                        }
-                    }
-                    fontLoader->callbacks_.clear();
-                    if (fontLoader->variationChanged_) {
-                        fontLoader->variationChanged_();
-                    }
+                    fontLoader->NotifyLoaded();
                 },
                 TaskExecutor::TaskType::UI);
         },
@@ -103,6 +98,24 @@ void RosenFontLoader::LoadFromAsset(const OHOS::Ace::RefPtr<OHOS::Ace::PipelineC
             } else if (assetSrc[0] == '.' && assetSrc.size() > 2 && assetSrc[1] == '/') {
                 assetSrc = assetSrc.substr(2); // get the asset src without './'.
             }
+            // Resolve the asset in the bundle and module of this container, so that it is only shared with containers
+            // which have the same font.
+            auto assetBasePath = assetManager->GetAssetPath(assetSrc);
+            if (!assetBasePath.empty()) {
+                fontLoader->SetFontPath(assetBasePath + assetSrc);
+            }
+            if (fontLoader->IsLoadedInCollection()) {
+                // Already loaded by another container.
+                context->GetTaskExecutor()->PostTask(
+                    [weak] {
+                        auto fontLoader = weak.Upgrade();
+                        if (fontLoader) {
+                            fontLoader->NotifyLoaded();
+                        }
+                    },
+                    TaskExecutor::TaskType::UI);
+                return;
+            }
             auto assetData = assetManager->GetAsset(assetSrc);
             if (!assetData) {
                 LOGE("No asset data!");
@@ -118,17 +131,7 @@ void RosenFontLoader::LoadFromAsset(const OHOS::Ace::RefPtr<OHOS::Ace::PipelineC
                     // Load font.
                     RosenFontCollection::GetInstance().LoadFontFromList(
                         assetData->GetData(), assetData->GetSize(), fontLoader->familyName_);
-                    fontLoader->isLoaded_ = true;
-
-                    for (const auto& [node, callback] : fontLoader->callbacks_) {
-                        if (callback) {
-                            callback();
-                        }
-                    }
-                    fontLoader->callbacks_.clear();
-                    if (fontLoader->variationChanged_) {
-                        fontLoader->variationChanged_();
-                    }
+                    fontLoader->NotifyLoaded();
                 },
                 TaskExecutor::TaskType::UI);
         },
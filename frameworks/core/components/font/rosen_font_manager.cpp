@@ -23,7 +23,6 @@ void RosenFontManager::VaryFontCollectionWithFontWeightScale()
 {
     if (GreatNotEqual(fontWeightScale_, 0.0)) {
         RosenFontCollection::GetInstance().VaryFontCollectionWithFontWeightScale(fontWeightScale_);
-        NotifyVariationNodes();
     }
 }
 
@@ -220,16 +220,8 @@ LayoutParam RenderGridLayout::MakeInnerLayoutParam(int32_t row, int32_t col, int
 {
     LOGD("%{public}d %{public}d %{public}d %{public}d", row, col, rowSpan, colSpan);
     LayoutParam innerLayout;
-    double rowLen = 0.0;
-    double colLen = 0.0;
-    for (int32_t i = 0; i < rowSpan; ++i) {
-        rowLen += gridCells_.at(row + i).at(col).Height();
-    }
-    rowLen += (rowSpan - 1) * rowGap_;
-    for (int32_t i = 0; i < colSpan; ++i) {
-        colLen += gridCells_.at(row).at(col + i).Width();
-    }
-    colLen += (colSpan - 1) * colGap_;
+    double rowLen = GetTracksLength(true, row, row + rowSpan, col) + (rowSpan - 1) * rowGap_;
+    double colLen = GetTracksLength(false, col, col + colSpan, row) + (colSpan - 1) * colGap_;
     if (crossAxisAlign_ == FlexAlign::STRETCH) {
         innerLayout.SetMinSize(Size(colLen, rowLen));
         innerLayout.SetMaxSize(Size(colLen, rowLen));
@@ -251,28 +243,12 @@ void RenderGridLayout::SetChildPosition(
     }
 
     // Calculate the position for current child.
-    double positionX = 0.0;
-    double positionY = 0.0;
-    for (int32_t i = 0; i < row; ++i) {
-        positionY += gridCells_.at(i).at(0).Height();
-    }
-    positionY += row * rowGap_;
-    for (int32_t i = 0; i < col; ++i) {
-        positionX += gridCells_.at(0).at(i).Width();
-    }
-    positionX += col * colGap_;
+    double positionY = GetTracksLength(true, 0, row) + row * rowGap_;
+    double positionX = GetTracksLength(false, 0, col) + col * colGap_;
 
     // Calculate the size for current child.
-    double rowLen = 0.0;
-    double colLen = 0.0;
-    for (int32_t i = 0; i < rowSpan; ++i) {
-        rowLen += gridCells_.at(row + i).at(col).Height();
-    }
-    rowLen += (rowSpan - 1) * rowGap_;
-    for (int32_t i = 0; i < colSpan; ++i) {
-        colLen += gridCells_.at(row).at(col + i).Width();
-    }
-    colLen += (colSpan - 1) * colGap_;
+    double rowLen = GetTracksLength(true, row, row + rowSpan, col) + (rowSpan - 1) * rowGap_;
+    double colLen = GetTracksLength(false, col, col + colSpan, row) + (colSpan - 1) * colGap_;
 
     // If RTL, place the item from right.
     if (rightToLeft_) {
@@ -301,28 +277,12 @@ Point RenderGridLayout::CalcChildPosition(
     }
 
     // Calculate the position for current child.
-    double positionX = 0.0;
-    double positionY = 0.0;
-    for (int32_t i = 0; i < row; ++i) {
-        positionY += gridCells_.at(i).at(0).Height();
-    }
-    positionY += row * rowGap_;
-    for (int32_t i = 0; i < col; ++i) {
-        positionX += gridCells_.at(0).at(i).Width();
-    }
-    positionX += col * colGap_;
+    double positionY = GetTracksLength(true, 0, row) + row * rowGap_;
+    double positionX = GetTracksLength(false, 0, col) + col * colGap_;
 
     // Calculate the size for current child.
-    double rowLen = 0.0;
-    double colLen = 0.0;
-    for (int32_t i = 0; i < rowSpan; ++i) {
-        rowLen += gridCells_.at(row + i).at(col).Height();
-    }
-    rowLen += (rowSpan - 1) * rowGap_;
-    for (int32_t i = 0; i < colSpan; ++i) {
-        colLen += gridCells_.at(row).at(col + i).Width();
-    }
-    colLen += (colSpan - 1) * colGap_;
+    double rowLen = GetTracksLength(true, row, row + rowSpan, col) + (rowSpan - 1) * rowGap_;
+    double colLen = GetTracksLength(false, col, col + colSpan, row) + (colSpan - 1) * colGap_;
 
     // If RTL, place the item from right.
     if (rightToLeft_) {
@@ -346,21 +306,12 @@ Point RenderGridLayout::CalcDragChildStartPosition(const ItemDragInfo& info)
 Point RenderGridLayout::CalcDragChildEndPosition(int32_t rowIndex, int32_t colIndex)
 {
     LOGD("CalcDragChildEndPosition>>>>>>rowIndex=%{public}d, colIndex=%{public}d", rowIndex, colIndex);
-    double positionX = 0.0;
-    double positionY = 0.0;
-    for (int32_t i = 0; i < rowIndex; ++i) {
-        positionY += gridCells_.at(i).at(0).Height();
-    }
-
-    positionY += rowIndex * rowGap_;
-    for (int32_t i = 0; i < colIndex; ++i) {
-        positionX += gridCells_.at(0).at(i).Width();
-    }
-    positionX += colIndex * colGap_;
+    double positionY = GetTracksLength(true, 0, rowIndex) + rowIndex * rowGap_;
+    double positionX = GetTracksLength(false, 0, colIndex) + colIndex * colGap_;
 
     // If RTL, place the item from right.
     if (rightToLeft_) {
-        double colLen = gridCells_.at(rowIndex).at(colIndex).Width();
+        double colLen = GetCellSize(rowIndex, colIndex).Width();
         positionX = colSize_ - positionX - colLen;
     }
     return Point(positionX + GetGlobalOffset().GetX(), positionY + GetGlobalOffset().GetY());
@@ -487,8 +438,8 @@ void RenderGridLayout::InitialGridProp()
     }
     LOGD("Row[%{public}s]: %{public}lf %{public}lf", rowsArgs_.c_str(), rowSize_, rowGap_);
     LOGD("Col[%{public}s]: %{public}lf %{public}lf", colsArgs_.c_str(), colSize_, colGap_);
-    std::vector<double> rows = ParseArgs(PreParseRows(), rowSize_, rowGap_);
-    std::vector<double> cols = ParseArgs(PreParseCols(), colSize_, colGap_);
+    std::vector<double> rows = ParseTracks(PreParseRows(), rowSize_, rowGap_, rowsTrackCache_);
+    std::vector<double> cols = ParseTracks(PreParseCols(), colSize_, colGap_, colsTrackCache_);
     if (rows.empty()) {
         rows.push_back(rowSize_);
     }
@@ -505,16 +456,7 @@ void RenderGridLayout::InitialGridProp()
     colCount_ = cols.size();
     rowCount_ = rows.size();
     itemCountMax_ = colCount_ * rowCount_;
-    gridCells_.clear();
-    int32_t row = 0;
-    for (auto height : rows) {
-        int32_t col = 0;
-        for (auto width : cols) {
-            gridCells_[row][col] = Size(width, height);
-            ++col;
-        }
-        ++row;
-    }
+    SetTracks(cols, rows);
     UpdateAccessibilityAttr();
     LOGD("GridLayout: %{public}lf %{public}lf %{public}d %{public}d", colSize_, rowSize_, colCount_, rowCount_);
 }
@@ -593,6 +535,19 @@ std::vector<double> RenderGridLayout::ParseArgs(const std::string& args, double
     return lens;
 }
 
+const std::vector<double>& RenderGridLayout::ParseTracks(
+    const std::string& args, double size, double gap, TrackCache& cache)
+{
+    if (!cache.valid || cache.args != args || !NearEqual(cache.size, size) || !NearEqual(cache.gap, gap)) {
+        cache.lens = ParseArgs(args, size, gap);
+        cache.args = args;
+        cache.size = size;
+        cache.gap = gap;
+        cache.valid = true;
+    }
+    return cache.lens;
+}
+
 void RenderGridLayout::ConvertRepeatArgs(std::string& handledArg)
 {
     if (handledArg.find(REPEAT_PREFIX) == std::string::npos) {
@@ -814,15 +769,10 @@ bool RenderGridLayout::CheckGridPlaced(int32_t index, int32_t row, int32_t col,
     rowSpan = rSpan;
     colSpan = retColSpan;
     for (int32_t i = row; i < row + rowSpan; ++i) {
-        std::map<int32_t, int32_t> rowMap;
-        auto iter = gridMatrix_.find(i);
-        if (iter != gridMatrix_.end()) {
-            rowMap = iter->second;
-        }
+        auto& rowMap = gridMatrix_[i];
         for (int32_t j = col; j < col + colSpan; ++j) {
-            rowMap.emplace(std::make_pair(j, index));
+            rowMap.emplace(j, index);
         }
-        gridMatrix_[i] = rowMap;
     }
     LOGD("%{public}d %{public}d %{public}d %{public}d %{public}d", index, row, col, rowSpan, colSpan);
     return true;
@@ -914,18 +864,25 @@ bool RenderGridLayout::NeedBeSmaller()
 
 void RenderGridLayout::BackGridMatrix()
 {
+    // Cells are backed up by UpdateMatrixByIndexStrong when they change, nothing is copied here.
     gridMatrixBack_.clear();
-    gridMatrixBack_ = gridMatrix_;
-    if (supportAnimation_ || dragAnimation_) {
-        gridItemPosition_.clear();
-        std::map<int32_t, GridItemIndexPosition> backData;
-        ParseRestoreScenePosition(gridMatrixBack_, backData);
-        for (auto& iter : backData) {
-            if (iter.first >= 0 && iter.first < (int32_t)itemsInGrid_.size()) {
-                auto item = itemsInGrid_[iter.first];
-                gridItemPosition_[iter.first] = Point(item->GetPosition().GetX(), item->GetPosition().GetY());
-            }
-        }
+    gridItemPosition_.clear();
+    isGridMatrixBacked_ = true;
+}
+
+void RenderGridLayout::BackGridCell(int32_t row, int32_t column)
+{
+    GridCellBack cellBack;
+    cellBack.row = row;
+    cellBack.column = column;
+    cellBack.index = GetIndexByGrid(row, column);
+    gridMatrixBack_.emplace_back(cellBack);
+    // An item has not moved until its cell changes, so its position is still the one to restore.
+    int32_t index = cellBack.index;
+    if ((supportAnimation_ || dragAnimation_) && index >= 0 && index < static_cast<int32_t>(itemsInGrid_.size()) &&
+        gridItemPosition_.find(index) == gridItemPosition_.end()) {
+        auto item = itemsInGrid_[index];
+        gridItemPosition_[index] = Point(item->GetPosition().GetX(), item->GetPosition().GetY());
     }
 }
 
@@ -981,6 +938,8 @@ void RenderGridLayout::ClearAllDragInfo()
     isMainGrid_ = false;
     reEnter_ = false;
     isDragChangeLayout_ = false;
+    gridMatrixBack_.clear();
+    isGridMatrixBacked_ = false;
     dragingItemRenderNode_.Reset();
     subGrid_.Reset();
     mainGrid_.Reset();
@@ -1282,6 +1241,7 @@ bool RenderGridLayout::ImpDropInGrid(const ItemDragInfo& info)
     bool result = false;
     int32_t insertIndex = -1;
     gridMatrixBack_.clear();
+    isGridMatrixBacked_ = false;
     if (CouldBeInserted()) {
         if (CalDragCell(info)) {
             MoveItems();
@@ -1623,7 +1583,7 @@ void RenderGridLayout::CalculateVerticalSize(
         colSize_ = viewPort_.Width();
     }
     // Get item width
-    cols = ParseArgs(PreParseCols(), colSize_, colGap_);
+    cols = ParseTracks(PreParseCols(), colSize_, colGap_, colsTrackCache_);
     if (cols.empty()) {
         cols.push_back(colSize_);
     }
@@ -1649,7 +1609,7 @@ void RenderGridLayout::CalculateHorizontalSize(
         rowSize_ = viewPort_.Height();
     }
     // Get item width
-    rows = ParseArgs(PreParseRows(), rowSize_, rowGap_);
+    rows = ParseTracks(PreParseRows(), rowSize_, rowGap_, rowsTrackCache_);
     if (rows.empty()) {
         rows.push_back(rowSize_);
     }
@@ -1666,19 +1626,46 @@ void RenderGridLayout::CalculateHorizontalSize(
 
 void RenderGridLayout::UpdateCollectionInfo(std::vector<double> cols, std::vector<double> rows)
 {
-    gridCells_.clear();
-    int32_t row = 0;
-    for (auto height : rows) {
-        int32_t col = 0;
-        for (auto width : cols) {
-            gridCells_[row][col] = Size(width, height);
-            ++col;
-        }
-        ++row;
-    }
+    SetTracks(cols, rows);
     UpdateAccessibilityAttr();
 }
 
+void RenderGridLayout::SetTracks(const std::vector<double>& cols, const std::vector<double>& rows)
+{
+    // Cells in a row share the height, cells in a column share the width, so two track lists describe all of them.
+    rowHeights_ = rows;
+    colWidths_ = cols;
+    rowOffsets_.assign(rows.size() + 1, 0.0);
+    std::partial_sum(rows.begin(), rows.end(), rowOffsets_.begin() + 1);
+    colOffsets_.assign(cols.size() + 1, 0.0);
+    std::partial_sum(cols.begin(), cols.end(), colOffsets_.begin() + 1);
+}
+
+Size RenderGridLayout::GetCellSize(int32_t row, int32_t col) const
+{
+    if (rowHeights_.empty() || colWidths_.empty()) {
+        // Tracks are not set by grids with variable cells.
+        return gridCells_.at(row).at(col);
+    }
+    return Size(colWidths_.at(col), rowHeights_.at(row));
+}
+
+double RenderGridLayout::GetTracksLength(bool isRow, int32_t start, int32_t end, int32_t cross) const
+{
+    if (start >= end) {
+        return 0.0;
+    }
+    const auto& offsets = isRow ? rowOffsets_ : colOffsets_;
+    if (offsets.size() > 1) {
+        return offsets.at(end) - offsets.at(start);
+    }
+    double length = 0.0;
+    for (int32_t i = start; i < end; ++i) {
+        length += isRow ? GetCellSize(i, cross).Height() : GetCellSize(cross, i).Width();
+    }
+    return length;
+}
+
 void RenderGridLayout::PerformLayoutForEditGrid()
 {
     int32_t itemIndex = 0;
@@ -1791,7 +1778,7 @@ bool RenderGridLayout::CalDragRowIndex(double dragRelativelyY, int32_t& dragRowI
         } else {
             offsetY = rowGap_;
         }
-        rowEnd += gridCells_.at(row).at(0).Height() + offsetY;
+        rowEnd += GetCellSize(row, 0).Height() + offsetY;
         if (dragRelativelyY >= rowStart && dragRelativelyY <= rowEnd) {
             dragRowIndex = row;
             return true;
@@ -1812,7 +1799,7 @@ bool RenderGridLayout::CalDragColumIndex(double dragRelativelyX, int32_t& dragCo
         } else {
             offsetX = colGap_;
         }
-        columEnd += gridCells_.at(0).at(col).Width() + offsetX;
+        columEnd += GetCellSize(0, col).Width() + offsetX;
         if (dragRelativelyX >= columStart && dragRelativelyX <= columEnd) {
             dragColIndex = col;
             return true;
@@ -2136,21 +2123,10 @@ bool RenderGridLayout::MoveItemsBackward(int32_t fromRow, int32_t fromColum, int
 
 void RenderGridLayout::UpdateMatrixByIndexStrong(int32_t index, int32_t row, int32_t column)
 {
-    std::map<int32_t, int32_t> rowMap;
-
-    auto rowIter = gridMatrix_.find(row);
-    if (rowIter != gridMatrix_.end()) {
-        rowMap = rowIter->second;
+    if (isGridMatrixBacked_) {
+        BackGridCell(row, column);
     }
-
-    auto indexIter = rowMap.find(column);
-    if (indexIter != rowMap.end()) {
-        rowMap[column] = index;
-    } else {
-        rowMap.emplace(std::make_pair(column, index));
-    }
-
-    gridMatrix_[row] = rowMap;
+    gridMatrix_[row][column] = index;
 }
 
 void RenderGridLayout::UpdateCurInsertPos(int32_t curInsertRow, int32_t curInsertColum)
@@ -2524,26 +2500,21 @@ void RenderGridLayout::RefreshAllocatedRowSizes(int32_t rowIndex, int32_t itemRo
     }
 }
 
-void RenderGridLayout::ParseRestoreScenePosition(
-    const std::map<int32_t, std::map<int32_t, int32_t>>& data, std::map<int32_t, GridItemIndexPosition>& info)
-{
-    info.clear();
-    for (auto rowIter = data.begin(); rowIter != data.end(); rowIter++) {
-        for (auto colIter = rowIter->second.begin(); colIter != rowIter->second.end(); colIter++) {
-            if (info.find(colIter->second) == info.end()) {
-                GridItemIndexPosition itemIndexPosition(rowIter->first, colIter->first);
-                info.emplace(colIter->second, itemIndexPosition);
-            }
-        }
-    }
-}
-
 void RenderGridLayout::CalcRestoreScenePosition(const ItemDragInfo& info)
 {
+    // Only items in changed cells can have moved. The first back of a cell holds the index it had before the drag,
+    // and cells are visited by row and column, so an item is found at the first of its changed cells.
+    std::map<std::pair<int32_t, int32_t>, int32_t> backCells;
+    for (const auto& cellBack : gridMatrixBack_) {
+        backCells.emplace(std::make_pair(cellBack.row, cellBack.column), cellBack.index);
+    }
     std::map<int32_t, GridItemIndexPosition> backData;
     std::map<int32_t, GridItemIndexPosition> recentData;
-    ParseRestoreScenePosition(gridMatrixBack_, backData);
-    ParseRestoreScenePosition(gridMatrix_, recentData);
+    for (const auto& cell : backCells) {
+        GridItemIndexPosition itemIndexPosition(cell.first.first, cell.first.second);
+        backData.emplace(cell.second, itemIndexPosition);
+        recentData.emplace(GetIndexByGrid(cell.first.first, cell.first.second), itemIndexPosition);
+    }
 
     for (auto backIter = backData.begin(); backIter != backData.end(); backIter++) {
         auto recentIter = recentData.find(backIter->first);
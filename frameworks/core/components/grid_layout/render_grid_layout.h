@@ -237,6 +237,16 @@ protected:
 
     std::vector<double> ParseArgs(const std::string& args, double size, double gap);
 
+    // Track sizes parsed from a template, reused until the template, the grid size or the gap changes.
+    struct TrackCache {
+        std::string args;
+        double size = 0.0;
+        double gap = 0.0;
+        std::vector<double> lens;
+        bool valid = false;
+    };
+    const std::vector<double>& ParseTracks(const std::string& args, double size, double gap, TrackCache& cache);
+
     std::vector<double> ParseAutoFill(const std::vector<std::string>& strs, double size, double gap);
 
     void SetPreTargetRenderGrid(const RefPtr<RenderGridLayout>& preTargetRenderGrid)
@@ -345,6 +355,12 @@ protected:
     void CalculateVerticalSize(std::vector<double>& cols, std::vector<double>& rows, int32_t dragLeaveOrEnter);
     void CalculateHorizontalSize(std::vector<double>& cols, std::vector<double>& rows, int32_t dragLeaveOrEnter);
     void UpdateCollectionInfo(std::vector<double> cols, std::vector<double> rows);
+
+    // Sizes of the cells are kept as track lists with their prefix sums, see SetTracks.
+    void SetTracks(const std::vector<double>& cols, const std::vector<double>& rows);
+    Size GetCellSize(int32_t row, int32_t col) const;
+    // Total length of tracks in [start, end) without gaps, |cross| is the track crossing them.
+    double GetTracksLength(bool isRow, int32_t start, int32_t end, int32_t cross = 0) const;
     void ClearSpringSlideData();
     void CreateSlideRecognizer();
     void HandleSlideStart(const TouchEventInfo& info);
@@ -384,8 +400,7 @@ protected:
     void FinishedAnimationController(const std::string& key);
     void RegisterAnimationFinishedFunc(const std::string& key, std::function<void()> func);
     void CalcRestoreScenePosition(const ItemDragInfo& info);
-    void ParseRestoreScenePosition(
-        const std::map<int32_t, std::map<int32_t, int32_t>>& data, std::map<int32_t, GridItemIndexPosition>& info);
+    void BackGridCell(int32_t row, int32_t column);
     int32_t GetDragPosRowIndex()
     {
         return dragPosRowIndex_;
@@ -437,8 +452,15 @@ protected:
     bool needResetItemPosition_ = false;
     // Map structure: [rowIndex - (columnIndex, index)]
     std::map<int32_t, std::map<int32_t, int32_t>> gridMatrix_;
-    // Map structure: [rowIndex - columnIndex - (width, height)]
+    // Map structure: [rowIndex - columnIndex - (width, height)], only used by grids with variable cells.
     std::map<int32_t, std::map<int32_t, Size>> gridCells_;
+    // Heights of rows and widths of columns, with prefix sums of them in the offsets.
+    std::vector<double> rowHeights_;
+    std::vector<double> colWidths_;
+    std::vector<double> rowOffsets_;
+    std::vector<double> colOffsets_;
+    TrackCache rowsTrackCache_;
+    TrackCache colsTrackCache_;
 
     RefPtr<GestureRecognizer> dragDropGesture_;
     WeakPtr<RenderGridLayout> preTargetRenderGrid_ = nullptr;
@@ -447,8 +469,14 @@ protected:
     // The list of renderNodes of items in the grid
     std::vector<RefPtr<RenderNode>> itemsInGrid_;
 
-    // back for gridMatrix_
-    std::map<int32_t, std::map<int32_t, int32_t>> gridMatrixBack_;
+    // back for gridMatrix_: cells changed since BackGridMatrix, each with the index it held before the change.
+    struct GridCellBack {
+        int32_t row = 0;
+        int32_t column = 0;
+        int32_t index = -1;
+    };
+    std::vector<GridCellBack> gridMatrixBack_;
+    bool isGridMatrixBacked_ = false;
 
     // The maximum number of items that the grid can hold
     int32_t itemCountMax_ = -1;
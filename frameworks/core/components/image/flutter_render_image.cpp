@@ -170,6 +170,8 @@ void FlutterRenderImage::ImageObjReady(const RefPtr<ImageObject>& imageObj)
         imageLoadingStatus_ = ImageLoadingStatus::LOADING;
         resizeScale_ = Size(1.0, 1.0);
     }
+    // The layout size is not changed if the image is laid out with the predicted size.
+    bool predicted = false;
     if (!imageObj_->IsSvg()) {
         if (sourceInfo_.IsSourceDimensionValid()) {
             rawImageSize_ = sourceInfo_.GetSourceSize();
@@ -178,6 +180,7 @@ void FlutterRenderImage::ImageObjReady(const RefPtr<ImageObject>& imageObj)
             rawImageSize_ = imageSize;
             forceResize_ = false;
         }
+        predicted = ValidatePredictedImageSize();
         imageSizeForEvent_ = imageSize;
         rawImageSizeUpdated_ = true;
         if (!background_) {
@@ -200,12 +203,7 @@ void FlutterRenderImage::ImageObjReady(const RefPtr<ImageObject>& imageObj)
         imageSizeForEvent_ = Measure();
         UpdateLoadSuccessState();
     }
-    // If image component size is finally decided, only need to layout itself.
-    bool layoutSizeNotChanged = (previousLayoutSize_ == GetLayoutSize());
-    bool selfOnly =
-        (imageComponentSize_.IsValid() && !imageComponentSize_.IsInfinite() && layoutSizeNotChanged) ||
-        imageObj_->IsSvg();
-    MarkNeedLayout(selfOnly);
+    MarkNeedLayout(IsSelfOnlyLayout(imageObj_->IsSvg(), predicted));
 }
 
 void FlutterRenderImage::ImageObjFailed()
@@ -351,7 +349,8 @@ void FlutterRenderImage::FetchImageObject()
                 useSkiaSvg_,
                 autoResize_,
                 renderTaskHolder_,
-                onPostBackgroundTask_);
+                onPostBackgroundTask_,
+                !GetHidden() && GetVisible());
             break;
         }
     }
@@ -934,8 +933,8 @@ Size FlutterRenderImage::Measure()
     if (imageObj_) {
         return imageObj_->MeasureForImage(AceType::Claim(this));
     }
-    LOGI("empty image object, measure failed, return empty size.");
-    return Size();
+    // Lay out with the size measured by the last launches until the image is decoded.
+    return PredictImageSize();
 }
 
 void FlutterRenderImage::OnHiddenChanged(bool hidden)
@@ -1184,7 +1183,8 @@ bool FlutterRenderImage::RetryLoading()
         useSkiaSvg_,
         autoResize_,
         renderTaskHolder_,
-        onPostBackgroundTask_);
+        onPostBackgroundTask_,
+        !GetHidden() && GetVisible());
     LOGW("Retry loading time: %{public}d, triggered by GetImageSize fail, imageSrc: %{private}s", retryCnt_,
         sourceInfo_.ToString().c_str());
     return true;
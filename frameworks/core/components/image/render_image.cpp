@@ -18,6 +18,7 @@
 #include "base/log/dump_log.h"
 #include "base/log/log.h"
 #include "base/utils/utils.h"
+#include "core/common/first_frame_layout_cache.h"
 #include "core/components/image/image_component.h"
 #include "core/components/image/image_event.h"
 #include "core/event/ace_event_helper.h"
@@ -186,6 +187,47 @@ Size RenderImage::CalculateBackupImageSize(const Size& pictureSize)
     return backupImageSize;
 }
 
+bool RenderImage::IsSizePredictable() const
+{
+    if (background_ || !FirstFrameLayoutCache::GetInstance().IsEnabled()) {
+        return false;
+    }
+    // Images in memory have no stable key across launches.
+    auto srcType = sourceInfo_.GetSrcType();
+    return srcType != SrcType::UNSUPPORTED && srcType != SrcType::MEMORY && srcType != SrcType::BASE64 &&
+           srcType != SrcType::PIXMAP;
+}
+
+Size RenderImage::PredictImageSize()
+{
+    Size size;
+    // A failed image is laid out with the empty size, as if it was never predicted.
+    if (imageLoadingStatus_ == ImageLoadingStatus::LOAD_FAIL || !IsSizePredictable() ||
+        !FirstFrameLayoutCache::GetInstance().GetSize(sourceInfo_.ToString(), size)) {
+        size = Size();
+    }
+    predictedImageSize_ = size;
+    return predictedImageSize_;
+}
+
+bool RenderImage::ValidatePredictedImageSize()
+{
+    bool isPredicted = predictedImageSize_.IsValid() && predictedImageSize_ == rawImageSize_;
+    predictedImageSize_ = Size();
+    if (IsSizePredictable()) {
+        FirstFrameLayoutCache::GetInstance().PutSize(sourceInfo_.ToString(), rawImageSize_);
+    }
+    return isPredicted;
+}
+
+bool RenderImage::IsSelfOnlyLayout(bool isSvg, bool predicted) const
+{
+    // If image component size is finally decided, only need to layout itself.
+    bool layoutSizeNotChanged = (previousLayoutSize_ == GetLayoutSize());
+    return (imageComponentSize_.IsValid() && !imageComponentSize_.IsInfinite() && layoutSizeNotChanged) || isSvg ||
+           predicted;
+}
+
 bool RenderImage::NeedResize() const
 {
     if (!resizeTarget_.IsValid()) {
@@ -618,6 +660,7 @@ void RenderImage::ClearRenderObject()
     width_ = Dimension();
     height_ = Dimension();
     rawImageSize_ = Size();
+    predictedImageSize_ = Size();
     renderAltImage_ = nullptr;
     proceedPreviousLoading_ = false;
     imageUpdateFunc_ = nullptr;
@@ -270,6 +270,13 @@ protected:
     void PrintImageLog(const Size& srcSize, const BackgroundImageSize& imageSize, ImageRepeat imageRepeat,
         const BackgroundImagePosition& imagePosition) const;
     Size CalculateBackupImageSize(const Size& pictureSize);
+    bool IsSizePredictable() const;
+    // Size of the image measured by the last launches, used before the image is decoded.
+    Size PredictImageSize();
+    // Returns true if the predicted size is the raw size of the image, and saves the raw size for the next launches.
+    bool ValidatePredictedImageSize();
+    // Returns true if the parent needs no layout when the image is ready.
+    bool IsSelfOnlyLayout(bool isSvg, bool predicted) const;
     void ClearRenderObject() override;
     virtual void LayoutImageObject() {}
 
@@ -320,6 +327,7 @@ protected:
     Dimension width_;
     Dimension height_;
     Size rawImageSize_;
+    Size predictedImageSize_;
     RefPtr<RenderImage> renderAltImage_;
 
     // background image
@@ -163,6 +163,8 @@ void RosenRenderImage::ImageObjReady(const RefPtr<ImageObject>& imageObj)
         imageLoadingStatus_ = ImageLoadingStatus::LOADING;
         resizeScale_ = Size(1.0, 1.0);
     }
+    // The layout size is not changed if the image is laid out with the predicted size.
+    bool predicted = false;
     if (!imageObj_->IsSvg()) {
         if (sourceInfo_.IsSourceDimensionValid()) {
             rawImageSize_ = sourceInfo_.GetSourceSize();
@@ -171,6 +173,7 @@ void RosenRenderImage::ImageObjReady(const RefPtr<ImageObject>& imageObj)
             rawImageSize_ = imageSize;
             forceResize_ = false;
         }
+        predicted = ValidatePredictedImageSize();
         imageSizeForEvent_ = imageSize;
         rawImageSizeUpdated_ = true;
         if (!background_) {
@@ -193,11 +196,7 @@ void RosenRenderImage::ImageObjReady(const RefPtr<ImageObject>& imageObj)
         imageSizeForEvent_ = Measure();
         UpdateLoadSuccessState();
     }
-    // If image component size is finally decided, only need to layout itself.
-    bool layoutSizeNotChanged = (previousLayoutSize_ == GetLayoutSize());
-    bool selfOnly = (imageComponentSize_.IsValid() && !imageComponentSize_.IsInfinite() && layoutSizeNotChanged) ||
-        imageObj_->IsSvg();
-    MarkNeedLayout(selfOnly);
+    MarkNeedLayout(IsSelfOnlyLayout(imageObj_->IsSvg(), predicted));
 }
 
 void RosenRenderImage::ImageObjFailed()
@@ -343,7 +342,8 @@ void RosenRenderImage::FetchImageObject()
                 useSkiaSvg_,
                 autoResize_,
                 renderTaskHolder_,
-                onPostBackgroundTask_);
+                onPostBackgroundTask_,
+                !GetHidden() && GetVisible());
             break;
         }
     }
@@ -908,8 +908,8 @@ Size RosenRenderImage::Measure()
     if (imageObj_) {
         return imageObj_->MeasureForImage(AceType::Claim(this));
     }
-    LOGI("empty image object, measure failed, return empty size.");
-    return Size();
+    // Lay out with the size measured by the last launches until the image is decoded.
+    return PredictImageSize();
 }
 
 void RosenRenderImage::OnHiddenChanged(bool hidden)
@@ -1151,7 +1151,8 @@ bool RosenRenderImage::RetryLoading()
                     frontend->GetType() == FrontendType::JS_CARD &&
                     sourceInfo_.GetSrcType() != SrcType::NETWORK;
     ImageProvider::FetchImageObject(sourceInfo_, imageObjSuccessCallback_, uploadSuccessCallback_, failedCallback_,
-        GetContext(), syncMode, useSkiaSvg_, autoResize_, renderTaskHolder_, onPostBackgroundTask_);
+        GetContext(), syncMode, useSkiaSvg_, autoResize_, renderTaskHolder_, onPostBackgroundTask_,
+        !GetHidden() && GetVisible());
     LOGW("Retry loading time: %{public}d, triggered by GetImageSize fail, imageSrc: %{private}s", retryCnt_,
         sourceInfo_.ToString().c_str());
     return true;
@@ -15,6 +15,12 @@
 
 #include "frameworks/core/components/svg/parse/svg_dom.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "include/core/SkPicture.h"
+
 #include "base/utils/system_properties.h"
 #include "frameworks/core/components/box/render_box.h"
 #include "frameworks/core/components/svg/flutter_render_svg.h"
@@ -41,6 +47,8 @@
 #include "frameworks/core/components/svg/parse/svg_use.h"
 #include "frameworks/core/components/svg/render_svg_base.h"
 #include "frameworks/core/components/transform/transform_component.h"
+#include "frameworks/core/image/flutter_image_cache.h"
+#include "frameworks/core/pipeline/base/flutter_render_context.h"
 
 #include <queue>
 
@@ -50,6 +58,19 @@ namespace {
 
 const char DOM_SVG_STYLE[] = "style";
 const char DOM_SVG_CLASS[] = "class";
+const char SVG_RASTER_CACHE_PREFIX[] = "svg_raster:";
+// Svg larger than this is painted directly, its raster costs too much memory of the image cache.
+constexpr double MAX_RASTER_CACHE_SIDE = 2048.0;
+
+// Tags whose painting only depends on the layout size, sorted for binary search.
+const char* const STATIC_TAGS[] = { "circle", "clipPath", "defs", "ellipse", "g", "line", "path", "polygon",
+    "polyline", "rect", "style", "svg", "use" };
+
+bool IsStaticTag(const char* tag)
+{
+    return std::binary_search(std::begin(STATIC_TAGS), std::end(STATIC_TAGS), tag,
+        [](const char* lhs, const char* rhs) { return std::strcmp(lhs, rhs) < 0; });
+}
 
 } // namespace
 
@@ -165,6 +186,9 @@ RefPtr<SvgNode> SvgDom::TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xm
     if (!node) {
         return nullptr;
     }
+    if (!IsStaticTag(element)) {
+        isStatic_ = false;
+    }
     node->SetContext(context_, svgContext_);
     ParseAttrs(dom, xmlNode, node);
     for (auto* child = dom.getFirstChild(xmlNode, nullptr); child; child = dom.getNextSibling(child)) {
@@ -287,11 +311,74 @@ void SvgDom::SetAttrValue(const std::string& name, const std::string& value, con
 void SvgDom::PaintDirectly(RenderContext& context, const Offset& offset)
 {
     auto svgRoot = AceType::DynamicCast<FlutterRenderSvg>(svgRoot_.Upgrade());
-    if (svgRoot) {
-        svgRoot->PaintDirectly(context, offset);
-    } else {
+    if (!svgRoot) {
         LOGD("paint fail as svg root is null");
+        return;
+    }
+    if (PaintFromRasterCache(context, svgRoot)) {
+        return;
+    }
+    svgRoot->PaintDirectly(context, offset);
+}
+
+bool SvgDom::PaintFromRasterCache(RenderContext& context, const RefPtr<RenderNode>& svgRoot)
+{
+    // Icons of the same source, color and size are painted from one raster instead of walking the svg tree.
+    if (!isStatic_ || animatorGroup_ || src_.empty()) {
+        return false;
+    }
+    auto pipelineContext = context_.Upgrade();
+    if (!pipelineContext) {
+        return false;
+    }
+    auto imageCache = pipelineContext->GetImageCache();
+    flutter::Canvas* canvas = static_cast<FlutterRenderContext*>(&context)->GetCanvas();
+    if (!imageCache || !canvas || !canvas->canvas()) {
+        return false;
     }
+    const auto& layoutSize = svgRoot->GetLayoutSize();
+    double viewScale = std::max(static_cast<double>(pipelineContext->GetViewScale()), 1.0);
+    int32_t width = static_cast<int32_t>(std::ceil(layoutSize.Width() * viewScale));
+    int32_t height = static_cast<int32_t>(std::ceil(layoutSize.Height() * viewScale));
+    if (width <= 0 || height <= 0 || width > MAX_RASTER_CACHE_SIDE || height > MAX_RASTER_CACHE_SIDE) {
+        return false;
+    }
+
+    std::string key = SVG_RASTER_CACHE_PREFIX + src_ + ":" +
+                      (fillColor_ ? std::to_string(fillColor_->GetValue()) : std::string("none")) + ":" +
+                      std::to_string(width) + "x" + std::to_string(height);
+    sk_sp<SkImage> image;
+    auto cachedImage = imageCache->GetCacheImage(key);
+    if (cachedImage && cachedImage->imagePtr) {
+        image = cachedImage->imagePtr->image();
+    }
+    if (!image) {
+        FlutterRenderContext rasterContext;
+        auto layer = AceType::MakeRefPtr<Flutter::ContainerLayer>();
+        rasterContext.InitContext(AceType::RawPtr(layer), Rect(0.0, 0.0, layoutSize.Width(), layoutSize.Height()));
+        AceType::DynamicCast<FlutterRenderSvg>(svgRoot)->PaintDirectly(rasterContext, Offset());
+        auto picture = rasterContext.FinishRecordingAsPicture();
+        if (!picture) {
+            return false;
+        }
+        SkMatrix matrix = SkMatrix::MakeScale(width / layoutSize.Width(), height / layoutSize.Height());
+        auto pictureImage = SkImage::MakeFromPicture(std::move(picture), SkISize::Make(width, height), &matrix,
+            nullptr, SkImage::BitDepth::kU8, SkColorSpace::MakeSRGB());
+        image = pictureImage ? pictureImage->makeRasterImage() : nullptr;
+        if (!image) {
+            return false;
+        }
+        auto canvasImage = flutter::CanvasImage::Create();
+        canvasImage->set_image(flutter::SkiaGPUObject<SkImage>(image, nullptr));
+        imageCache->CacheImage(key, std::make_shared<CachedImage>(canvasImage));
+    }
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    // The raster is in device pixels, so bilinear filtering is enough when it is mapped back to them.
+    paint.setFilterQuality(kLow_SkFilterQuality);
+    canvas->canvas()->drawImageRect(image, SkRect::MakeWH(width, height),
+        SkRect::MakeWH(layoutSize.Width(), layoutSize.Height()), &paint);
+    return true;
 }
 
 void SvgDom::CreateRenderNode(ImageFit imageFit, const SvgRadius& svgRadius, bool useBox)
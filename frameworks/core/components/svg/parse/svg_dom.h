@@ -80,6 +80,12 @@ public:
         finishEvent_ = finishEvent;
     }
 
+    // The source is part of the key of the raster cache, see PaintDirectly.
+    void SetSource(const std::string& src)
+    {
+        src_ = src;
+    }
+
     void SetRootOpacity(int32_t alpha);
     void SetRootRotate(double rotate);
     void SetRadius(const SvgRadius& svgRadius);
@@ -100,6 +106,7 @@ private:
     void ApplyContain(double& scaleX, double& scaleY);
     void ApplyCover(double& scaleX, double& scaleY);
     void SyncRSNode(const RefPtr<RenderNode>& renderNode);
+    bool PaintFromRasterCache(RenderContext& context, const RefPtr<RenderNode>& svgRoot);
 
     WeakPtr<PipelineContext> context_;
     RefPtr<SvgContext> svgContext_;
@@ -114,6 +121,9 @@ private:
     EventMarker finishEvent_;
     std::optional<Color> fillColor_;
     PushAttr attrCallback_;
+    std::string src_;
+    // Whether the painting only depends on the layout size, false when any gradient, filter or animation is used.
+    bool isStatic_ = true;
 };
 
 } // namespace OHOS::Ace
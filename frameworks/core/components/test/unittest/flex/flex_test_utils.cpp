@@ -47,8 +47,11 @@ double MockRenderText::GetBaselineDistance(TextBaseline textBaseline)
     }
 }
 
+int32_t MockRenderText::measureCount_ = 0;
+
 Size MockRenderText::Measure()
 {
+    ++measureCount_;
     return Size(textStyle_.GetFontSize().Value(), textStyle_.GetFontSize().Value());
 }
 
@@ -73,8 +73,17 @@ public:
 
     double GetBaselineDistance(TextBaseline textBaseline) override;
 
+    // Count of texts measured in all instances.
+    static int32_t GetMeasureCount()
+    {
+        return measureCount_;
+    }
+
 protected:
     Size Measure() override;
+
+private:
+    static int32_t measureCount_;
 };
 
 class FlexTestUtils {
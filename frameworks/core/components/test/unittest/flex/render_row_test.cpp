@@ -46,6 +46,7 @@ constexpr double CENTER_ALIGN_SIZE = 50.0;
 constexpr double END_ALIGN_SIZE = 100.0;
 constexpr double ROW_COL_CENTER_SIZE = 390.0;
 constexpr double ROW_COL_SMALL_CENTER_SIZE = 290.0;
+constexpr int32_t NESTED_FLEX_LEVELS = 8;
 
 } // namespace
 
@@ -709,4 +710,109 @@ HWTEST_F(RenderRowTest, RenderBaseline003, TestSize.Level1)
     EXPECT_TRUE(flexItem->GetPosition() == Offset(SMALL_TEXT, 0));
 }
 
-} // namespace OHOS::Ace
\ No newline at end of file
+/**
+ * @tc.name: RenderLayoutCache001
+ * @tc.desc: Verify the row reuses the cached layouts of flex items when it is laid out again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderRowTest, RenderLayoutCache001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RenderRowTest RenderLayoutCache001 start";
+    /**
+     * @tc.steps: step1. construct the RenderNode tree, the flex item grows to fill the row.
+     */
+    auto mockContext = MockRenderCommon::GetMockContext();
+    RefPtr<RenderRoot> root = FlexTestUtils::CreateRenderRoot();
+    RefPtr<RenderFlex> row =
+        FlexTestUtils::CreateRenderFlex(FlexDirection::ROW, FlexAlign::FLEX_START, FlexAlign::BASELINE);
+    root->AddChild(row);
+    RefPtr<MockRenderText> firstText = FlexTestUtils::CreateRenderText(SMALL_TEXT);
+    row->AddChild(firstText);
+    RefPtr<RenderFlexItem> flexItem = FlexTestUtils::CreateRenderFlexItem(0, 1, 0);
+    row->AddChild(flexItem);
+    RefPtr<MockRenderText> secondText = FlexTestUtils::CreateRenderText(MEDIUM_TEXT);
+    flexItem->AddChild(secondText);
+    root->Attach(mockContext);
+    row->Attach(mockContext);
+    firstText->Attach(mockContext);
+    flexItem->Attach(mockContext);
+    secondText->Attach(mockContext);
+    root->PerformLayout();
+    Size itemSize = flexItem->GetLayoutSize();
+    Offset itemPosition = flexItem->GetPosition();
+    Offset textPosition = secondText->GetPosition();
+    EXPECT_TRUE(NearEqual(itemSize.Width(), RECT_WIDTH - SMALL_TEXT));
+
+    /**
+     * @tc.steps: step2. layout the row again.
+     * @tc.expected: step2. the flex item is measured and laid out from the cache, the layout is not changed.
+     */
+    uint64_t hitCount = RenderNode::GetLayoutCacheHitCount();
+    row->MarkNeedLayout();
+    root->PerformLayout();
+    EXPECT_EQ(RenderNode::GetLayoutCacheHitCount(), hitCount + 2);
+    EXPECT_TRUE(flexItem->GetLayoutSize() == itemSize);
+    EXPECT_TRUE(flexItem->GetPosition() == itemPosition);
+    EXPECT_TRUE(secondText->GetPosition() == textPosition);
+}
+
+/**
+ * @tc.name: RenderLayoutCache002
+ * @tc.desc: Verify the layouts avoided by the layout cache in deeply nested rows and columns.
+ * @tc.type: PERF
+ */
+HWTEST_F(RenderRowTest, RenderLayoutCache002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RenderRowTest RenderLayoutCache002 start";
+    /**
+     * @tc.steps: step1. construct rows and columns nested in growing flex items, with a text in the innermost one.
+     */
+    auto mockContext = MockRenderCommon::GetMockContext();
+    RefPtr<RenderRoot> root = FlexTestUtils::CreateRenderRoot();
+    root->Attach(mockContext);
+    RefPtr<RenderNode> parent = root;
+    std::vector<RefPtr<RenderNode>> nodes;
+    for (int32_t level = 0; level < NESTED_FLEX_LEVELS; ++level) {
+        auto direction = level % 2 == 0 ? FlexDirection::ROW : FlexDirection::COLUMN;
+        RefPtr<RenderFlex> flex = FlexTestUtils::CreateRenderFlex(direction, FlexAlign::FLEX_START, FlexAlign::CENTER);
+        RefPtr<RenderFlexItem> flexItem = FlexTestUtils::CreateRenderFlexItem(0, 1, 0);
+        parent->AddChild(flex);
+        flex->AddChild(flexItem);
+        flex->Attach(mockContext);
+        flexItem->Attach(mockContext);
+        nodes.emplace_back(flex);
+        nodes.emplace_back(flexItem);
+        parent = flexItem;
+    }
+    RefPtr<MockRenderText> text = FlexTestUtils::CreateRenderText(SMALL_TEXT);
+    parent->AddChild(text);
+    text->Attach(mockContext);
+    nodes.emplace_back(text);
+    root->PerformLayout();
+    std::vector<Rect> rects;
+    for (const auto& node : nodes) {
+        rects.emplace_back(node->GetPosition(), node->GetLayoutSize());
+    }
+
+    /**
+     * @tc.steps: step2. layout the outermost row again.
+     * @tc.expected: step2. layouts of the nested flex items are restored from the cache, and the innermost text is
+     *                      measured less than once for each layout param of each level, the layout is not changed.
+     */
+    uint64_t hitCount = RenderNode::GetLayoutCacheHitCount();
+    int32_t measureCount = MockRenderText::GetMeasureCount();
+    nodes.front()->MarkNeedLayout();
+    root->PerformLayout();
+    uint64_t avoidedLayouts = RenderNode::GetLayoutCacheHitCount() - hitCount;
+    int32_t textMeasures = MockRenderText::GetMeasureCount() - measureCount;
+    GTEST_LOG_(INFO) << "RenderLayoutCache002 levels: " << NESTED_FLEX_LEVELS << ", avoided layouts: "
+                     << avoidedLayouts << ", text measures: " << textMeasures;
+    EXPECT_GT(avoidedLayouts, 0u);
+    EXPECT_LT(textMeasures, 1 << NESTED_FLEX_LEVELS);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_TRUE(nodes[i]->GetPosition() == rects[i].GetOffset());
+        EXPECT_TRUE(nodes[i]->GetLayoutSize() == rects[i].GetSize());
+    }
+}
+
+} // namespace OHOS::Ace
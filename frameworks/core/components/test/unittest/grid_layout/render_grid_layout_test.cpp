@@ -15,8 +15,14 @@
 
 #include "gtest/gtest.h"
 
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
 #include "core/components/grid_layout/grid_layout_component.h"
+#define private public
+#define protected public
 #include "core/components/grid_layout/render_grid_layout.h"
+#undef private
+#undef protected
 #include "core/components/test/unittest/grid_layout/grid_layout_test_utils.h"
 #include "core/components/test/unittest/mock/mock_render_common.h"
 
@@ -24,6 +30,23 @@ using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t LARGE_GRID_ROWS = 25;
+constexpr int32_t LARGE_GRID_COLS = 20;
+constexpr int32_t RELAYOUT_TIMES = 10;
+constexpr int32_t DRAG_TIMES = 100;
+
+std::string RepeatTrack(const std::string& track, int32_t count)
+{
+    std::string tracks;
+    for (int32_t i = 0; i < count; ++i) {
+        tracks += (i == 0 ? "" : " ") + track;
+    }
+    return tracks;
+}
+
+} // namespace
 
 class RenderGridLayoutTest : public testing::Test {
 public:
@@ -1280,4 +1303,149 @@ HWTEST_F(RenderGridLayoutTest, RenderGridLayoutTest021, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: RenderGridLayoutTest022
+ * @tc.desc: Measure layout of a grid with 500 items.
+ * @tc.type: PERF
+ */
+HWTEST_F(RenderGridLayoutTest, RenderGridLayoutTest022, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. construct a grid of 25 rows and 20 columns filled with items.
+     */
+    std::string rowArgs = RepeatTrack("1fr", LARGE_GRID_ROWS);
+    std::string colArgs = RepeatTrack("54px", LARGE_GRID_COLS);
+    renderNode_->Update(GridLayoutTestUtils::CreateComponent(FlexDirection::ROW, rowArgs, colArgs));
+    int32_t count = LARGE_GRID_ROWS * LARGE_GRID_COLS;
+    for (int32_t i = 0; i < count; ++i) {
+        RefPtr<RenderNode> item = GridLayoutTestUtils::CreateRenderItem(-1, -1, 1, 1);
+        item->GetChildren().front()->Attach(mockContext_);
+        item->Attach(mockContext_);
+        renderNode_->AddChild(item);
+    }
+
+    /**
+     * @tc.steps: step2. layout the grid, then layout it again with the same templates.
+     * @tc.expected: step2. every item is placed in its cell.
+     */
+    int64_t begin = GetMicroTickCount();
+    renderNode_->PerformLayout();
+    int64_t firstCost = GetMicroTickCount() - begin;
+    begin = GetMicroTickCount();
+    for (int32_t i = 0; i < RELAYOUT_TIMES; ++i) {
+        renderNode_->PerformLayout();
+    }
+    int64_t relayoutCost = (GetMicroTickCount() - begin) / RELAYOUT_TIMES;
+    const auto& lastItem = renderNode_->GetChildren().back();
+    EXPECT_TRUE(lastItem->GetLayoutSize() == Size(54.0, 43.2));
+    EXPECT_TRUE(lastItem->GetPosition() == Offset(1026.0, 1036.8));
+    LOGI("grid of %{public}d items: first layout %{public}lld us, relayout %{public}lld us", count,
+        static_cast<long long>(firstCost), static_cast<long long>(relayoutCost));
+}
+
+/**
+ * @tc.name: RenderGridLayoutTest023
+ * @tc.desc: Verify only the cells changed by dragging are backed up, with the positions of the items in them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderGridLayoutTest, RenderGridLayoutTest023, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. construct a grid of 2 rows and 2 columns with 4 items and layout it.
+     */
+    renderNode_->Update(GridLayoutTestUtils::CreateComponent(FlexDirection::ROW, "1fr 1fr", "1fr 1fr"));
+    for (int32_t i = 0; i < 4; ++i) {
+        RefPtr<RenderNode> item = GridLayoutTestUtils::CreateRenderItem(-1, -1, 1, 1);
+        item->GetChildren().front()->Attach(mockContext_);
+        item->Attach(mockContext_);
+        renderNode_->AddChild(item);
+    }
+    renderNode_->PerformLayout();
+    renderNode_->supportAnimation_ = true;
+
+    /**
+     * @tc.steps: step2. back up the grid matrix, then swap the first two items.
+     * @tc.expected: step2. the two swapped cells are backed up with their original items and positions.
+     */
+    renderNode_->BackGridMatrix();
+    EXPECT_TRUE(renderNode_->gridMatrixBack_.empty());
+    renderNode_->UpdateMatrixByIndexStrong(1, 0, 0);
+    renderNode_->UpdateMatrixByIndexStrong(0, 0, 1);
+    renderNode_->UpdateMatrixByIndexStrong(1, 0, 0);
+    ASSERT_EQ(renderNode_->gridMatrixBack_.size(), 3UL);
+    EXPECT_EQ(renderNode_->gridMatrixBack_[0].index, 0);
+    EXPECT_EQ(renderNode_->gridMatrixBack_[1].index, 1);
+    EXPECT_EQ(renderNode_->GetIndexByGrid(0, 0), 1);
+    EXPECT_EQ(renderNode_->GetIndexByGrid(0, 1), 0);
+    ASSERT_EQ(renderNode_->gridItemPosition_.size(), 2UL);
+    auto firstItem = renderNode_->itemsInGrid_[0];
+    auto secondItem = renderNode_->itemsInGrid_[1];
+    EXPECT_TRUE(renderNode_->gridItemPosition_[0] ==
+                Point(firstItem->GetPosition().GetX(), firstItem->GetPosition().GetY()));
+    EXPECT_TRUE(renderNode_->gridItemPosition_[1] ==
+                Point(secondItem->GetPosition().GetX(), secondItem->GetPosition().GetY()));
+
+    /**
+     * @tc.steps: step3. clear the drag info.
+     * @tc.expected: step3. the back is cleared and later changes are not backed up.
+     */
+    renderNode_->ClearAllDragInfo();
+    EXPECT_TRUE(renderNode_->gridMatrixBack_.empty());
+    renderNode_->UpdateMatrixByIndexStrong(2, 0, 0);
+    EXPECT_TRUE(renderNode_->gridMatrixBack_.empty());
+}
+
+/**
+ * @tc.name: RenderGridLayoutTest024
+ * @tc.desc: Measure backing up and restoring a grid with 500 items while dragging.
+ * @tc.type: PERF
+ */
+HWTEST_F(RenderGridLayoutTest, RenderGridLayoutTest024, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. construct a grid of 25 rows and 20 columns filled with items and layout it.
+     */
+    std::string rowArgs = RepeatTrack("1fr", LARGE_GRID_ROWS);
+    std::string colArgs = RepeatTrack("54px", LARGE_GRID_COLS);
+    renderNode_->Update(GridLayoutTestUtils::CreateComponent(FlexDirection::ROW, rowArgs, colArgs));
+    int32_t count = LARGE_GRID_ROWS * LARGE_GRID_COLS;
+    for (int32_t i = 0; i < count; ++i) {
+        RefPtr<RenderNode> item = GridLayoutTestUtils::CreateRenderItem(-1, -1, 1, 1);
+        item->GetChildren().front()->Attach(mockContext_);
+        item->Attach(mockContext_);
+        renderNode_->AddChild(item);
+    }
+    renderNode_->PerformLayout();
+    renderNode_->supportAnimation_ = true;
+
+    /**
+     * @tc.steps: step2. back up the grid, move the items of the first row forward by one cell and calculate the
+     *                   positions to restore, then copy the whole grid matrix as the back used to do.
+     * @tc.expected: step2. only the cells of the first row are backed up.
+     */
+    ItemDragInfo info;
+    int64_t begin = GetMicroTickCount();
+    for (int32_t i = 0; i < DRAG_TIMES; ++i) {
+        renderNode_->BackGridMatrix();
+        for (int32_t column = 1; column < LARGE_GRID_COLS; ++column) {
+            renderNode_->UpdateMatrixByIndexStrong(column - 1, 0, column);
+        }
+        renderNode_->CalcRestoreScenePosition(info);
+        for (int32_t column = 1; column < LARGE_GRID_COLS; ++column) {
+            renderNode_->UpdateMatrixByIndexStrong(column, 0, column);
+        }
+    }
+    int64_t dragCost = (GetMicroTickCount() - begin) / DRAG_TIMES;
+    EXPECT_EQ(renderNode_->gridMatrixBack_.size(), static_cast<size_t>((LARGE_GRID_COLS - 1) * 2));
+    EXPECT_EQ(renderNode_->gridItemPosition_.size(), static_cast<size_t>(LARGE_GRID_COLS));
+    begin = GetMicroTickCount();
+    for (int32_t i = 0; i < DRAG_TIMES; ++i) {
+        auto gridMatrixCopy = renderNode_->gridMatrix_;
+        EXPECT_EQ(gridMatrixCopy.size(), static_cast<size_t>(LARGE_GRID_ROWS));
+    }
+    int64_t copyCost = (GetMicroTickCount() - begin) / DRAG_TIMES;
+    LOGI("drag in grid of %{public}d items: back and restore %{public}lld us, matrix copy %{public}lld us", count,
+        static_cast<long long>(dragCost), static_cast<long long>(copyCost));
+}
+
 } // namespace OHOS::Ace
@@ -13,15 +13,25 @@
  * limitations under the License.
  */
 
+#include <cstdio>
+
 #include "gtest/gtest.h"
 
 #include "adapter/aosp/entrance/java/jni/jni_environment.h"
+#include "core/common/first_frame_layout_cache.h"
 #include "core/components/test/unittest/image/image_test_utils.h"
 
 using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS::Ace {
+namespace {
+
+const std::string LAYOUT_CACHE_PATH = "/data/test/first_frame_layout_cache";
+const std::string ASSET_IMAGE_SRC = "common/image.png";
+const std::string MEMORY_IMAGE_SRC = "memory://image.png";
+
+} // namespace
 
 Platform::JniEnvironment::JniEnvironment() {}
 
@@ -181,4 +191,115 @@ HWTEST_F(RenderImageTest, DecideLayoutSize005, TestSize.Level1)
     ASSERT_TRUE(renderImage->GetLayoutSize() == Size(EXTRA_LARGE_LENGTH, LARGE_LENGTH));
 }
 
+/**
+ * @tc.name: PredictImageSize001
+ * @tc.desc: Verify that RenderImage predicts the size of an image from the first frame layout cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderImageTest, PredictImageSize001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Enable the cache, save the size of an asset image and predict it.
+     * @tc.expected: step1. The saved size is predicted.
+     */
+    auto& cache = FirstFrameLayoutCache::GetInstance();
+    cache.Enable(LAYOUT_CACHE_PATH, nullptr);
+    RefPtr<RenderImage> renderImage = CreateRenderImage(LARGE_LENGTH, SMALL_LENGTH);
+    renderImage->sourceInfo_ = ImageSourceInfo(ASSET_IMAGE_SRC);
+    cache.PutSize(renderImage->sourceInfo_.ToString(), Size(LARGE_LENGTH, SMALL_LENGTH));
+    EXPECT_TRUE(renderImage->PredictImageSize() == Size(LARGE_LENGTH, SMALL_LENGTH));
+
+    /**
+     * @tc.steps: step2. Decode the image with the predicted size.
+     * @tc.expected: step2. The prediction is valid.
+     */
+    renderImage->rawImageSize_ = Size(LARGE_LENGTH, SMALL_LENGTH);
+    EXPECT_TRUE(renderImage->ValidatePredictedImageSize());
+
+    /**
+     * @tc.steps: step3. Decode the image with another size.
+     * @tc.expected: step3. The prediction is not valid and the new size is saved for the next launches.
+     */
+    renderImage->PredictImageSize();
+    renderImage->rawImageSize_ = Size(SMALL_LENGTH, SMALL_LENGTH);
+    EXPECT_FALSE(renderImage->ValidatePredictedImageSize());
+    Size size;
+    EXPECT_TRUE(cache.GetSize(renderImage->sourceInfo_.ToString(), size));
+    EXPECT_TRUE(size == Size(SMALL_LENGTH, SMALL_LENGTH));
+
+    cache.Disable();
+    std::remove(LAYOUT_CACHE_PATH.c_str());
+}
+
+/**
+ * @tc.name: PredictImageSize002
+ * @tc.desc: Verify that RenderImage does not predict the size of failed images and images in memory.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderImageTest, PredictImageSize002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Predict the size of an image which failed to load.
+     * @tc.expected: step1. The size is empty.
+     */
+    auto& cache = FirstFrameLayoutCache::GetInstance();
+    cache.Enable(LAYOUT_CACHE_PATH, nullptr);
+    RefPtr<RenderImage> renderImage = CreateRenderImage(LARGE_LENGTH, SMALL_LENGTH);
+    renderImage->sourceInfo_ = ImageSourceInfo(ASSET_IMAGE_SRC);
+    cache.PutSize(renderImage->sourceInfo_.ToString(), Size(LARGE_LENGTH, SMALL_LENGTH));
+    renderImage->imageLoadingStatus_ = ImageLoadingStatus::LOAD_FAIL;
+    EXPECT_TRUE(renderImage->PredictImageSize() == Size());
+    EXPECT_FALSE(renderImage->ValidatePredictedImageSize());
+
+    /**
+     * @tc.steps: step2. Predict the size of an image in memory.
+     * @tc.expected: step2. The size is empty.
+     */
+    renderImage->imageLoadingStatus_ = ImageLoadingStatus::UNLOADED;
+    renderImage->sourceInfo_ = ImageSourceInfo(MEMORY_IMAGE_SRC);
+    cache.PutSize(renderImage->sourceInfo_.ToString(), Size(LARGE_LENGTH, SMALL_LENGTH));
+    EXPECT_TRUE(renderImage->PredictImageSize() == Size());
+
+    /**
+     * @tc.steps: step3. Predict the size of an asset image with the cache disabled.
+     * @tc.expected: step3. The size is empty.
+     */
+    cache.Disable();
+    std::remove(LAYOUT_CACHE_PATH.c_str());
+    renderImage->sourceInfo_ = ImageSourceInfo(ASSET_IMAGE_SRC);
+    EXPECT_TRUE(renderImage->PredictImageSize() == Size());
+}
+
+/**
+ * @tc.name: IsSelfOnlyLayout001
+ * @tc.desc: Verify that a predicted image does not lay out its parent when it is ready.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderImageTest, IsSelfOnlyLayout001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Lay out an image, then change its layout size.
+     */
+    RefPtr<RenderRoot> root = CreateRenderRoot(Size(LARGE_LENGTH, SMALL_LENGTH));
+    RefPtr<RenderImage> renderImage = CreateRenderImage(LARGE_LENGTH, SMALL_LENGTH);
+    auto mockContext = GetMockContext();
+    renderImage->Attach(mockContext);
+    root->AddChild(renderImage);
+    root->PerformLayout();
+    renderImage->previousLayoutSize_ = Size();
+
+    /**
+     * @tc.steps: step2. Check the layout of a bitmap which is ready, predicted or not.
+     * @tc.expected: step2. Only the predicted image lays out itself only.
+     */
+    EXPECT_FALSE(renderImage->IsSelfOnlyLayout(false, false));
+    EXPECT_TRUE(renderImage->IsSelfOnlyLayout(false, true));
+
+    /**
+     * @tc.steps: step3. Check the layout of a svg which is ready.
+     * @tc.expected: step3. The svg lays out itself only.
+     */
+    EXPECT_TRUE(renderImage->IsSelfOnlyLayout(true, false));
+}
+
 } // namespace OHOS::Ace
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "include/core/SkBitmap.h"
+#include "include/core/SkMaskFilter.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSurface.h"
+
+#include "core/components/common/painter/shadow_mask_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t SURFACE_SIZE = 300;
+constexpr SkScalar BOX_LEFT = 50.0f;
+constexpr SkScalar BOX_TOP = 50.0f;
+constexpr SkScalar BOX_WIDTH = 120.0f;
+constexpr SkScalar BOX_HEIGHT = 100.0f;
+constexpr SkScalar RADIUS = 10.0f;
+constexpr SkScalar LARGE_RADIUS = 16.0f;
+constexpr float SIGMA = 4.0f;
+constexpr float SMALL_SIGMA = 2.0f;
+constexpr size_t MAX_CACHED_MASKS = 32;
+constexpr int32_t ALPHA_TOLERANCE = 8;
+
+SkRRect MakeBox(SkScalar width, SkScalar height, SkScalar radius)
+{
+    return SkRRect::MakeRectXY(SkRect::MakeXYWH(BOX_LEFT, BOX_TOP, width, height), radius, radius);
+}
+
+int32_t GetAlpha(const sk_sp<SkSurface>& surface, int32_t x, int32_t y)
+{
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(SURFACE_SIZE, SURFACE_SIZE);
+    surface->readPixels(bitmap, 0, 0);
+    return SkColorGetA(bitmap.getColor(x, y));
+}
+
+} // namespace
+
+class ShadowMaskCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    sk_sp<SkSurface> surface_;
+};
+
+void ShadowMaskCacheTest::SetUp()
+{
+    ShadowMaskCache::GetInstance().Clear();
+    surface_ = SkSurface::MakeRasterN32Premul(SURFACE_SIZE, SURFACE_SIZE);
+}
+
+void ShadowMaskCacheTest::TearDown()
+{
+    ShadowMaskCache::GetInstance().Clear();
+    surface_ = nullptr;
+}
+
+/**
+ * @tc.name: DrawBlurredRRect001
+ * @tc.desc: Test masks are shared by boxes of the same corner radii and blur radius in different sizes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShadowMaskCacheTest, DrawBlurredRRect001, TestSize.Level1)
+{
+    auto& cache = ShadowMaskCache::GetInstance();
+    ASSERT_TRUE(surface_);
+    auto canvas = surface_->getCanvas();
+
+    /**
+     * @tc.steps: step1. Draw a box, then a larger box of the same style.
+     * @tc.expected: step1. Both are drawn with the same mask.
+     */
+    EXPECT_TRUE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), SIGMA, SK_ColorBLACK));
+    EXPECT_EQ(cache.GetCachedCount(), 1UL);
+    EXPECT_TRUE(
+        cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH * 2, BOX_HEIGHT * 2, RADIUS), SIGMA, SK_ColorBLACK));
+    EXPECT_EQ(cache.GetCachedCount(), 1UL);
+
+    /**
+     * @tc.steps: step2. Draw boxes of another blur radius and other corner radii.
+     * @tc.expected: step2. Each of them has its own mask.
+     */
+    EXPECT_TRUE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), SMALL_SIGMA, SK_ColorBLACK));
+    EXPECT_EQ(cache.GetCachedCount(), 2UL);
+    EXPECT_TRUE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, LARGE_RADIUS), SIGMA, SK_ColorBLACK));
+    EXPECT_EQ(cache.GetCachedCount(), 3UL);
+    EXPECT_TRUE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), SIGMA, SK_ColorRED));
+    EXPECT_EQ(cache.GetCachedCount(), 3UL);
+
+    /**
+     * @tc.steps: step3. Draw the box in a scaled canvas.
+     * @tc.expected: step3. The mask is blurred in device pixels, so it is another mask.
+     */
+    canvas->save();
+    canvas->scale(2.0f, 2.0f);
+    EXPECT_TRUE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), SIGMA, SK_ColorBLACK));
+    canvas->restore();
+    EXPECT_EQ(cache.GetCachedCount(), 4UL);
+
+    /**
+     * @tc.steps: step4. Clear the cache.
+     * @tc.expected: step4. No mask is kept.
+     */
+    cache.Clear();
+    EXPECT_EQ(cache.GetCachedCount(), 0UL);
+}
+
+/**
+ * @tc.name: DrawBlurredRRect002
+ * @tc.desc: Test boxes which can't be drawn with a mask are left to the caller and masks are kept in a bound.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShadowMaskCacheTest, DrawBlurredRRect002, TestSize.Level1)
+{
+    auto& cache = ShadowMaskCache::GetInstance();
+    ASSERT_TRUE(surface_);
+    auto canvas = surface_->getCanvas();
+
+    /**
+     * @tc.steps: step1. Draw a box smaller than its blurred corners, a box without blur and a rotated box.
+     * @tc.expected: step1. None of them is drawn or cached.
+     */
+    EXPECT_FALSE(cache.DrawBlurredRRect(canvas, MakeBox(RADIUS * 2, RADIUS * 2, RADIUS), SIGMA, SK_ColorBLACK));
+    EXPECT_FALSE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), 0.0f, SK_ColorBLACK));
+    EXPECT_FALSE(cache.DrawBlurredRRect(nullptr, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), SIGMA, SK_ColorBLACK));
+    canvas->save();
+    canvas->rotate(45.0f);
+    EXPECT_FALSE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), SIGMA, SK_ColorBLACK));
+    canvas->restore();
+    EXPECT_EQ(cache.GetCachedCount(), 0UL);
+
+    /**
+     * @tc.steps: step2. Draw boxes of more blur radii than the cache keeps.
+     * @tc.expected: step2. The least recently used masks are dropped.
+     */
+    for (size_t i = 0; i <= MAX_CACHED_MASKS; ++i) {
+        float sigma = SMALL_SIGMA + static_cast<float>(i) / 10.0f;
+        EXPECT_TRUE(cache.DrawBlurredRRect(canvas, MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS), sigma, SK_ColorBLACK));
+    }
+    EXPECT_EQ(cache.GetCachedCount(), MAX_CACHED_MASKS);
+}
+
+/**
+ * @tc.name: DrawBlurredRRect003
+ * @tc.desc: Test a box drawn with a cached mask looks like the box drawn with a blur mask filter.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShadowMaskCacheTest, DrawBlurredRRect003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Draw a box with a cached mask, and the same box with a blur mask filter in another surface.
+     */
+    ASSERT_TRUE(surface_);
+    SkRRect box = MakeBox(BOX_WIDTH, BOX_HEIGHT, RADIUS);
+    EXPECT_TRUE(ShadowMaskCache::GetInstance().DrawBlurredRRect(surface_->getCanvas(), box, SIGMA, SK_ColorBLACK));
+    auto expected = SkSurface::MakeRasterN32Premul(SURFACE_SIZE, SURFACE_SIZE);
+    ASSERT_TRUE(expected);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setColor(SK_ColorBLACK);
+    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, SIGMA));
+    expected->getCanvas()->drawRRect(box, paint);
+
+    /**
+     * @tc.steps: step2. Compare pixels around the corners and the edges of the box.
+     * @tc.expected: step2. The alpha of them is close.
+     */
+    auto left = static_cast<int32_t>(BOX_LEFT);
+    auto top = static_cast<int32_t>(BOX_TOP);
+    auto right = static_cast<int32_t>(BOX_LEFT + BOX_WIDTH);
+    auto bottom = static_cast<int32_t>(BOX_TOP + BOX_HEIGHT);
+    auto middleX = (left + right) / 2;
+    auto middleY = (top + bottom) / 2;
+    const std::pair<int32_t, int32_t> points[] = { { left - 4, middleY }, { left + 2, middleY },
+        { middleX, top - 4 }, { middleX, bottom + 4 }, { right + 4, middleY }, { left, top }, { right, bottom },
+        { middleX, middleY } };
+    for (const auto& point : points) {
+        EXPECT_LE(std::abs(GetAlpha(surface_, point.first, point.second) -
+                           GetAlpha(expected, point.first, point.second)),
+            ALPHA_TOLERANCE);
+    }
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "include/core/SkBitmap.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkSurface.h"
+
+#include "core/components/test/unittest/mock/mock_render_common.h"
+#include "core/pipeline/base/flutter_render_context.h"
+#define private public
+#include "core/components/svg/parse/svg_dom.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+// Without width and height, the svg is laid out in the size of its container.
+const char RED_ICON[] = "<svg viewBox=\"0 0 24 24\"><rect width=\"24\" height=\"24\" fill=\"#FF0000\"/></svg>";
+const char BLUE_ICON[] = "<svg viewBox=\"0 0 24 24\"><rect width=\"24\" height=\"24\" fill=\"#0000FF\"/></svg>";
+const char GRADIENT_ICON[] = "<svg viewBox=\"0 0 24 24\"><defs><linearGradient id=\"grad\">"
+                             "<stop offset=\"0\" stop-color=\"#FF0000\"/><stop offset=\"1\" stop-color=\"#0000FF\"/>"
+                             "</linearGradient></defs><rect width=\"24\" height=\"24\" fill=\"url(#grad)\"/></svg>";
+const char ICON_SRC[] = "/data/icon.svg";
+const Size ICON_SIZE(24.0, 24.0);
+const Size LARGE_ICON_SIZE(48.0, 48.0);
+// Larger than the side of rasters kept in cache.
+const Size HUGE_ICON_SIZE(3000.0, 24.0);
+constexpr size_t IMAGE_CACHE_CAPACITY = 16;
+
+RefPtr<SvgDom> CreateSvgDom(const RefPtr<PipelineContext>& context, const char* svg, const Size& size,
+    const std::optional<Color>& fillColor = std::nullopt)
+{
+    SkMemoryStream stream(svg, strlen(svg));
+    auto svgDom = SvgDom::CreateSvgDom(stream, context, fillColor);
+    if (!svgDom) {
+        return nullptr;
+    }
+    svgDom->SetSource(ICON_SRC);
+    svgDom->SetContainerSize(size);
+    svgDom->CreateRenderNode(ImageFit::FILL, SvgRadius(), false);
+    return svgDom;
+}
+
+// Paints the svg directly as the image component does, and returns the color of the center pixel.
+SkColor PaintSvgDom(const RefPtr<SvgDom>& svgDom, const Size& size)
+{
+    FlutterRenderContext renderContext;
+    auto layer = AceType::MakeRefPtr<Flutter::ContainerLayer>();
+    renderContext.InitContext(AceType::RawPtr(layer), Rect(0.0, 0.0, size.Width(), size.Height()));
+    svgDom->PaintDirectly(renderContext, Offset());
+    auto picture = renderContext.FinishRecordingAsPicture();
+    auto width = static_cast<int32_t>(size.Width());
+    auto height = static_cast<int32_t>(size.Height());
+    auto surface = SkSurface::MakeRasterN32Premul(width, height);
+    if (!picture || !surface) {
+        return SK_ColorTRANSPARENT;
+    }
+    surface->getCanvas()->drawPicture(picture);
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(width, height);
+    surface->readPixels(bitmap, 0, 0);
+    return bitmap.getColor(width / 2, height / 2);
+}
+
+} // namespace
+
+class SvgDomRasterCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    RefPtr<PipelineContext> context_;
+    RefPtr<ImageCache> imageCache_;
+};
+
+void SvgDomRasterCacheTest::SetUp()
+{
+    context_ = MockRenderCommon::GetMockContext();
+    ASSERT_TRUE(context_);
+    imageCache_ = context_->GetImageCache();
+    ASSERT_TRUE(imageCache_);
+    imageCache_->SetCapacity(IMAGE_CACHE_CAPACITY);
+    imageCache_->Clear();
+}
+
+void SvgDomRasterCacheTest::TearDown()
+{
+    if (imageCache_) {
+        imageCache_->Clear();
+    }
+    imageCache_ = nullptr;
+    context_ = nullptr;
+}
+
+/**
+ * @tc.name: PaintFromRasterCache001
+ * @tc.desc: Test an icon of the same source, color and size is painted from the cached raster.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomRasterCacheTest, PaintFromRasterCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Paint a static icon.
+     * @tc.expected: step1. The icon is painted and its raster is cached.
+     */
+    auto redIcon = CreateSvgDom(context_, RED_ICON, ICON_SIZE);
+    ASSERT_TRUE(redIcon);
+    EXPECT_TRUE(redIcon->isStatic_);
+    EXPECT_EQ(PaintSvgDom(redIcon, ICON_SIZE), SK_ColorRED);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 1UL);
+
+    /**
+     * @tc.steps: step2. Paint the icon again, and paint another document of the same source, color and size.
+     * @tc.expected: step2. Both are painted from the cached raster, so the other document is painted in red too.
+     */
+    EXPECT_EQ(PaintSvgDom(redIcon, ICON_SIZE), SK_ColorRED);
+    auto blueIcon = CreateSvgDom(context_, BLUE_ICON, ICON_SIZE);
+    ASSERT_TRUE(blueIcon);
+    EXPECT_EQ(PaintSvgDom(blueIcon, ICON_SIZE), SK_ColorRED);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 1UL);
+}
+
+/**
+ * @tc.name: PaintFromRasterCache002
+ * @tc.desc: Test an icon of another fill color or size misses the cached raster.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomRasterCacheTest, PaintFromRasterCache002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Paint an icon, then paint it with a fill color.
+     * @tc.expected: step1. Each of them has its own raster.
+     */
+    auto icon = CreateSvgDom(context_, RED_ICON, ICON_SIZE);
+    ASSERT_TRUE(icon);
+    PaintSvgDom(icon, ICON_SIZE);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 1UL);
+    auto filledIcon = CreateSvgDom(context_, RED_ICON, ICON_SIZE, Color::BLUE);
+    ASSERT_TRUE(filledIcon);
+    PaintSvgDom(filledIcon, ICON_SIZE);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 2UL);
+
+    /**
+     * @tc.steps: step2. Paint the icon in a larger size.
+     * @tc.expected: step2. The icon is rasterized again in the larger size.
+     */
+    auto largeIcon = CreateSvgDom(context_, RED_ICON, LARGE_ICON_SIZE);
+    ASSERT_TRUE(largeIcon);
+    EXPECT_EQ(PaintSvgDom(largeIcon, LARGE_ICON_SIZE), SK_ColorRED);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 3UL);
+}
+
+/**
+ * @tc.name: PaintFromRasterCache003
+ * @tc.desc: Test icons using tags other than static shapes and icons larger than the raster limit are not cached.
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomRasterCacheTest, PaintFromRasterCache003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Paint an icon filled with a gradient.
+     * @tc.expected: step1. The icon is not static and is painted directly.
+     */
+    auto gradientIcon = CreateSvgDom(context_, GRADIENT_ICON, ICON_SIZE);
+    ASSERT_TRUE(gradientIcon);
+    EXPECT_FALSE(gradientIcon->isStatic_);
+    PaintSvgDom(gradientIcon, ICON_SIZE);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 0UL);
+
+    /**
+     * @tc.steps: step2. Paint a static icon wider than 2048 px.
+     * @tc.expected: step2. The icon is painted directly, and no raster is cached.
+     */
+    auto hugeIcon = CreateSvgDom(context_, RED_ICON, HUGE_ICON_SIZE);
+    ASSERT_TRUE(hugeIcon);
+    EXPECT_TRUE(hugeIcon->isStatic_);
+    PaintSvgDom(hugeIcon, HUGE_ICON_SIZE);
+    EXPECT_EQ(imageCache_->GetCachedImageCount(), 0UL);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "third_party/skia/include/core/SkFontMgr.h"
+
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+#include "core/components/text_field/block_paragraph.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr size_t DOCUMENT_LINES = 2000;
+constexpr size_t EDIT_LINE = 1000;
+constexpr size_t TYPED_CHARS = 50;
+constexpr double LAYOUT_WIDTH = 720.0;
+constexpr double FONT_SIZE = 30.0;
+const std::u16string DOCUMENT_LINE = u"The quick brown fox jumps over the lazy dog.";
+
+std::u16string MakeDocument()
+{
+    std::u16string text;
+    for (size_t i = 0; i < DOCUMENT_LINES; ++i) {
+        if (i > 0) {
+            text.push_back(u'\n');
+        }
+        text.append(DOCUMENT_LINE);
+    }
+    return text;
+}
+
+} // namespace
+
+class BlockParagraphTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase() {}
+    void SetUp();
+    void TearDown() {}
+
+protected:
+    static std::shared_ptr<txt::FontCollection> fontCollection_;
+    txt::ParagraphStyle paragraphStyle_;
+    txt::TextStyle textStyle_;
+};
+
+std::shared_ptr<txt::FontCollection> BlockParagraphTest::fontCollection_;
+
+void BlockParagraphTest::SetUpTestCase()
+{
+    fontCollection_ = std::make_shared<txt::FontCollection>();
+    fontCollection_->SetDefaultFontManager(SkFontMgr::RefDefault());
+}
+
+void BlockParagraphTest::SetUp()
+{
+    paragraphStyle_.font_size = FONT_SIZE;
+    textStyle_.font_size = FONT_SIZE;
+}
+
+/**
+ * @tc.name: BlockParagraph001
+ * @tc.desc: Verify typing in a long document only reshapes the edited block.
+ * @tc.type: PERF
+ */
+HWTEST_F(BlockParagraphTest, BlockParagraph001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. shape and layout a document of 2000 lines.
+     * @tc.expected: step1. every line is a block.
+     */
+    BlockParagraph paragraph;
+    auto text = MakeDocument();
+    paragraph.Update(text, paragraphStyle_, textStyle_, fontCollection_);
+    paragraph.Layout(LAYOUT_WIDTH);
+    EXPECT_EQ(paragraph.GetBlockCount(), DOCUMENT_LINES);
+    EXPECT_EQ(paragraph.GetReshapedCount(), DOCUMENT_LINES);
+    double height = paragraph.GetHeight();
+
+    /**
+     * @tc.steps: step2. type chars one by one in the middle of the document.
+     * @tc.expected: step2. each keystroke reshapes exactly one block and the height is kept.
+     */
+    size_t caret = EDIT_LINE * (DOCUMENT_LINE.length() + 1);
+    int64_t begin = GetMicroTickCount();
+    for (size_t i = 0; i < TYPED_CHARS; ++i) {
+        text.insert(caret++, 1, u'a');
+        paragraph.Update(text, paragraphStyle_, textStyle_, fontCollection_);
+        paragraph.Layout(LAYOUT_WIDTH);
+        EXPECT_EQ(paragraph.GetReshapedCount(), 1UL);
+    }
+    int64_t cost = GetMicroTickCount() - begin;
+    LOGI("typing latency in %{public}zu lines: %{public}.3f ms per char", DOCUMENT_LINES,
+        static_cast<double>(cost) / TYPED_CHARS / 1000.0);
+    EXPECT_EQ(paragraph.GetBlockCount(), DOCUMENT_LINES);
+    EXPECT_GE(paragraph.GetHeight(), height);
+
+    /**
+     * @tc.steps: step3. break the edited line.
+     * @tc.expected: step3. only the two new blocks are shaped.
+     */
+    text.insert(caret, 1, u'\n');
+    paragraph.Update(text, paragraphStyle_, textStyle_, fontCollection_);
+    paragraph.Layout(LAYOUT_WIDTH);
+    EXPECT_EQ(paragraph.GetBlockCount(), DOCUMENT_LINES + 1);
+    EXPECT_EQ(paragraph.GetReshapedCount(), 2UL);
+}
+
+/**
+ * @tc.name: BlockParagraph002
+ * @tc.desc: Verify positions and boxes are mapped across blocks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BlockParagraphTest, BlockParagraph002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. layout three lines, the second one is empty.
+     */
+    BlockParagraph paragraph;
+    paragraph.Update(u"abc\n\ndef", paragraphStyle_, textStyle_, fontCollection_);
+    paragraph.Layout(LAYOUT_WIDTH);
+    EXPECT_EQ(paragraph.GetBlockCount(), 3UL);
+    EXPECT_EQ(paragraph.GetLineCount(), 3UL);
+
+    /**
+     * @tc.steps: step2. get box of the first line break.
+     * @tc.expected: step2. its bottom is the top of the second line.
+     */
+    auto boxes = paragraph.GetRectsForRange(
+        3, 4, txt::Paragraph::RectHeightStyle::kMax, txt::Paragraph::RectWidthStyle::kTight);
+    ASSERT_EQ(boxes.size(), 1UL);
+    double lineHeight = paragraph.GetHeight() / 3;
+    EXPECT_NEAR(boxes.front().rect.fBottom, lineHeight, 1.0);
+
+    /**
+     * @tc.steps: step3. get position of a point on the last line.
+     * @tc.expected: step3. the position is offset by the chars of previous blocks.
+     */
+    auto position = paragraph.GetGlyphPositionAtCoordinateWithCluster(0.0, lineHeight * 2.5);
+    EXPECT_EQ(position.position, 5UL);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components/text_field/block_paragraph.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "flutter/third_party/txt/src/txt/paragraph_builder.h"
+#include "flutter/third_party/txt/src/txt/paragraph_txt.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr char16_t NEWLINE = u'\n';
+// An empty block still takes a line, shape it with a space to get the height of the line.
+const std::u16string EMPTY_BLOCK_TEXT = u" ";
+
+} // namespace
+
+bool BlockParagraph::IsSameStyle(const txt::ParagraphStyle& lhs, const txt::ParagraphStyle& rhs)
+{
+    // Only fields which text field sets are compared, the others always keep their default values.
+    return lhs.max_lines == rhs.max_lines && lhs.ellipsis == rhs.ellipsis && lhs.text_align == rhs.text_align &&
+           lhs.text_direction == rhs.text_direction && NearEqual(lhs.font_size, rhs.font_size);
+}
+
+bool BlockParagraph::IsSameStyle(const txt::TextStyle& lhs, const txt::TextStyle& rhs)
+{
+    // Paint with shader can't be compared, always reshape.
+    if (lhs.has_foreground || rhs.has_foreground || lhs.has_background || rhs.has_background) {
+        return false;
+    }
+    return lhs.color == rhs.color && lhs.font_families == rhs.font_families && lhs.font_weight == rhs.font_weight &&
+           lhs.font_style == rhs.font_style && lhs.text_baseline == rhs.text_baseline && lhs.locale == rhs.locale &&
+           lhs.decoration == rhs.decoration && NearEqual(lhs.font_size, rhs.font_size) &&
+           NearEqual(lhs.letter_spacing, rhs.letter_spacing) && NearEqual(lhs.word_spacing, rhs.word_spacing) &&
+           NearEqual(lhs.height, rhs.height);
+}
+
+std::vector<std::u16string> BlockParagraph::SplitText(const std::u16string& text, bool splitBlocks)
+{
+    std::vector<std::u16string> pieces;
+    if (!splitBlocks) {
+        pieces.emplace_back(text);
+        return pieces;
+    }
+    size_t begin = 0;
+    while (true) {
+        auto pos = text.find(NEWLINE, begin);
+        if (pos == std::u16string::npos) {
+            pieces.emplace_back(text.substr(begin));
+            break;
+        }
+        pieces.emplace_back(text.substr(begin, pos - begin));
+        begin = pos + 1;
+    }
+    return pieces;
+}
+
+bool BlockParagraph::Update(const std::u16string& text, const txt::ParagraphStyle& paragraphStyle,
+    const txt::TextStyle& textStyle, const std::shared_ptr<txt::FontCollection>& fontCollection)
+{
+    bool splitBlocks =
+        paragraphStyle.max_lines == std::numeric_limits<size_t>::max() && paragraphStyle.ellipsis.empty();
+    bool styleChanged = !paragraphStyle_ || !textStyle_ || fontCollection_ != fontCollection ||
+                        splitBlocks_ != splitBlocks || !IsSameStyle(*paragraphStyle_, paragraphStyle) ||
+                        !IsSameStyle(*textStyle_, textStyle);
+    if (styleChanged) {
+        paragraphStyle_ = std::make_unique<txt::ParagraphStyle>(paragraphStyle);
+        textStyle_ = std::make_unique<txt::TextStyle>(textStyle);
+        fontCollection_ = fontCollection;
+        splitBlocks_ = splitBlocks;
+    }
+
+    auto pieces = SplitText(text, splitBlocks_);
+    size_t oldCount = styleChanged ? 0 : blocks_.size();
+    size_t newCount = pieces.size();
+    // Blocks before and after the edited range keep their shaped paragraphs.
+    size_t prefix = 0;
+    while (prefix < oldCount && prefix < newCount && blocks_[prefix].text == pieces[prefix]) {
+        ++prefix;
+    }
+    size_t suffix = 0;
+    while (suffix < oldCount - prefix && suffix < newCount - prefix &&
+           blocks_[oldCount - suffix - 1].text == pieces[newCount - suffix - 1]) {
+        ++suffix;
+    }
+
+    std::vector<Block> blocks(newCount);
+    reshapedCount_ = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < newCount; ++i) {
+        auto& block = blocks[i];
+        if (i < prefix) {
+            block = std::move(blocks_[i]);
+        } else if (i >= newCount - suffix) {
+            block = std::move(blocks_[oldCount - (newCount - i)]);
+        } else {
+            block.text = std::move(pieces[i]);
+            ShapeBlock(block);
+            ++reshapedCount_;
+        }
+        block.start = start;
+        block.hasNewline = i + 1 < newCount;
+        start += block.text.length() + (block.hasNewline ? 1 : 0);
+    }
+    blocks_ = std::move(blocks);
+    return reshapedCount_ > 0 || oldCount != newCount;
+}
+
+void BlockParagraph::ShapeBlock(Block& block)
+{
+    auto builder = txt::ParagraphBuilder::CreateTxtBuilder(*paragraphStyle_, fontCollection_);
+    builder->PushStyle(*textStyle_);
+    builder->AddText(block.text.empty() ? EMPTY_BLOCK_TEXT : block.text);
+    block.paragraph = builder->Build();
+    block.needLayout = true;
+}
+
+void BlockParagraph::Layout(double width)
+{
+    bool widthChanged = !hasLayout_ || width != width_;
+    for (auto& block : blocks_) {
+        if (widthChanged || block.needLayout) {
+            block.paragraph->Layout(width);
+            block.needLayout = false;
+        }
+    }
+    width_ = width;
+    hasLayout_ = true;
+    UpdateMetrics();
+}
+
+void BlockParagraph::UpdateMetrics()
+{
+    height_ = 0.0;
+    longestLine_ = 0.0;
+    maxIntrinsicWidth_ = 0.0;
+    lineCount_ = 0;
+    for (auto& block : blocks_) {
+        block.top = height_;
+        height_ += block.paragraph->GetHeight();
+        lineCount_ += static_cast<txt::ParagraphTxt*>(block.paragraph.get())->GetLineCount();
+        if (!block.text.empty()) {
+            longestLine_ = std::max(longestLine_, block.paragraph->GetLongestLine());
+            maxIntrinsicWidth_ = std::max(maxIntrinsicWidth_, block.paragraph->GetMaxIntrinsicWidth());
+        }
+    }
+}
+
+void BlockParagraph::Paint(SkCanvas* canvas, double x, double y) const
+{
+    if (!canvas) {
+        return;
+    }
+    SkRect clipBounds;
+    bool hasClip = canvas->getLocalClipBounds(&clipBounds);
+    for (const auto& block : blocks_) {
+        double top = y + block.top;
+        double bottom = top + block.paragraph->GetHeight();
+        if (hasClip && bottom < clipBounds.top()) {
+            continue;
+        }
+        if (hasClip && top > clipBounds.bottom()) {
+            break;
+        }
+        block.paragraph->Paint(canvas, x, top);
+    }
+}
+
+size_t BlockParagraph::FindBlockByPosition(size_t position) const
+{
+    auto iter = std::upper_bound(blocks_.begin(), blocks_.end(), position,
+        [](size_t value, const Block& block) { return value < block.start; });
+    return iter == blocks_.begin() ? 0 : static_cast<size_t>(std::distance(blocks_.begin(), iter)) - 1;
+}
+
+size_t BlockParagraph::FindBlockByOffset(double dy) const
+{
+    auto iter = std::upper_bound(blocks_.begin(), blocks_.end(), dy,
+        [](double value, const Block& block) { return value < block.top; });
+    return iter == blocks_.begin() ? 0 : static_cast<size_t>(std::distance(blocks_.begin(), iter)) - 1;
+}
+
+void BlockParagraph::AddNewlineBox(const Block& block, std::vector<txt::Paragraph::TextBox>& boxes) const
+{
+    // The line break ends the last line of the block, its bottom is the top of next line.
+    double x = 0.0;
+    double top = block.top;
+    auto direction = paragraphStyle_->text_direction;
+    if (!block.text.empty()) {
+        auto lastBoxes = block.paragraph->GetRectsForRange(block.text.length() - 1, block.text.length(),
+            txt::Paragraph::RectHeightStyle::kMax, txt::Paragraph::RectWidthStyle::kTight);
+        if (!lastBoxes.empty()) {
+            const auto& lastBox = lastBoxes.back();
+            direction = lastBox.direction;
+            x = direction == txt::TextDirection::ltr ? lastBox.rect.fRight : lastBox.rect.fLeft;
+            top += lastBox.rect.fTop;
+        }
+    }
+    double bottom = block.top + block.paragraph->GetHeight();
+    boxes.emplace_back(SkRect::MakeLTRB(x, top, x, bottom), direction);
+}
+
+std::vector<txt::Paragraph::TextBox> BlockParagraph::GetRectsForRange(size_t start, size_t end,
+    txt::Paragraph::RectHeightStyle rectHeightStyle, txt::Paragraph::RectWidthStyle rectWidthStyle) const
+{
+    std::vector<txt::Paragraph::TextBox> boxes;
+    if (start >= end || blocks_.empty()) {
+        return boxes;
+    }
+    for (size_t index = FindBlockByPosition(start); index < blocks_.size(); ++index) {
+        const auto& block = blocks_[index];
+        if (block.start >= end) {
+            break;
+        }
+        size_t blockEnd = block.start + block.text.length();
+        size_t localStart = std::max(start, block.start) - block.start;
+        size_t localEnd = std::min(end, blockEnd) - block.start;
+        if (localStart < localEnd) {
+            auto blockBoxes =
+                block.paragraph->GetRectsForRange(localStart, localEnd, rectHeightStyle, rectWidthStyle);
+            for (auto& box : blockBoxes) {
+                box.rect.offset(0.0f, static_cast<float>(block.top));
+                boxes.emplace_back(box);
+            }
+        }
+        if (block.hasNewline && start <= blockEnd && end > blockEnd) {
+            AddNewlineBox(block, boxes);
+        }
+    }
+    return boxes;
+}
+
+txt::Paragraph::PositionWithAffinity BlockParagraph::GetGlyphPositionAtCoordinateWithCluster(double dx, double dy) const
+{
+    if (blocks_.empty()) {
+        return txt::Paragraph::PositionWithAffinity(0, txt::Paragraph::Affinity::DOWNSTREAM);
+    }
+    const auto& block = blocks_[FindBlockByOffset(dy)];
+    auto position = block.paragraph->GetGlyphPositionAtCoordinateWithCluster(dx, dy - block.top);
+    return txt::Paragraph::PositionWithAffinity(
+        block.start + std::min(position.position, block.text.length()), position.affinity);
+}
+
+} // namespace OHOS::Ace
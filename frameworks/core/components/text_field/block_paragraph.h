@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_TEXT_FIELD_BLOCK_PARAGRAPH_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_TEXT_FIELD_BLOCK_PARAGRAPH_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/third_party/txt/src/txt/font_collection.h"
+#include "flutter/third_party/txt/src/txt/paragraph.h"
+#include "flutter/third_party/txt/src/txt/paragraph_style.h"
+#include "flutter/third_party/txt/src/txt/text_style.h"
+
+#include "base/utils/noncopyable.h"
+
+class SkCanvas;
+
+namespace OHOS::Ace {
+
+// BlockParagraph splits the text of an editable field at hard line breaks and shapes every block as a separate
+// txt::Paragraph. An edit only reshapes the blocks it touches, the rest are reused from the last update, so typing
+// in a long document costs the same as typing in a short one.
+class BlockParagraph final {
+public:
+    BlockParagraph() = default;
+    ~BlockParagraph() = default;
+
+    // Returns true if any block has been reshaped. Blocks are only split when the style doesn't limit the lines,
+    // since max lines and ellipsis apply to the text as a whole.
+    bool Update(const std::u16string& text, const txt::ParagraphStyle& paragraphStyle,
+        const txt::TextStyle& textStyle, const std::shared_ptr<txt::FontCollection>& fontCollection);
+
+    // Only lays out blocks reshaped since last layout, unless the width changes.
+    void Layout(double width);
+    void Paint(SkCanvas* canvas, double x, double y) const;
+
+    double GetHeight() const
+    {
+        return height_;
+    }
+
+    double GetLongestLine() const
+    {
+        return longestLine_;
+    }
+
+    double GetMaxIntrinsicWidth() const
+    {
+        return maxIntrinsicWidth_;
+    }
+
+    double GetMaxWidth() const
+    {
+        return width_;
+    }
+
+    size_t GetLineCount() const
+    {
+        return lineCount_;
+    }
+
+    size_t GetBlockCount() const
+    {
+        return blocks_.size();
+    }
+
+    // Number of blocks shaped by the last update, for profiling.
+    size_t GetReshapedCount() const
+    {
+        return reshapedCount_;
+    }
+
+    std::vector<txt::Paragraph::TextBox> GetRectsForRange(size_t start, size_t end,
+        txt::Paragraph::RectHeightStyle rectHeightStyle, txt::Paragraph::RectWidthStyle rectWidthStyle) const;
+    txt::Paragraph::PositionWithAffinity GetGlyphPositionAtCoordinateWithCluster(double dx, double dy) const;
+
+private:
+    struct Block {
+        std::u16string text;
+        // Offset of the first char in the whole text.
+        size_t start = 0;
+        // Whether the block is ended by a line break, which belongs to this block in the whole text.
+        bool hasNewline = false;
+        double top = 0.0;
+        bool needLayout = true;
+        std::unique_ptr<txt::Paragraph> paragraph;
+    };
+
+    static bool IsSameStyle(const txt::ParagraphStyle& lhs, const txt::ParagraphStyle& rhs);
+    static bool IsSameStyle(const txt::TextStyle& lhs, const txt::TextStyle& rhs);
+    static std::vector<std::u16string> SplitText(const std::u16string& text, bool splitBlocks);
+
+    void ShapeBlock(Block& block);
+    void UpdateMetrics();
+    size_t FindBlockByPosition(size_t position) const;
+    size_t FindBlockByOffset(double dy) const;
+    void AddNewlineBox(const Block& block, std::vector<txt::Paragraph::TextBox>& boxes) const;
+
+    std::vector<Block> blocks_;
+    std::unique_ptr<txt::ParagraphStyle> paragraphStyle_;
+    std::unique_ptr<txt::TextStyle> textStyle_;
+    std::shared_ptr<txt::FontCollection> fontCollection_;
+    bool splitBlocks_ = false;
+
+    double width_ = 0.0;
+    bool hasLayout_ = false;
+    double height_ = 0.0;
+    double longestLine_ = 0.0;
+    double maxIntrinsicWidth_ = 0.0;
+    size_t lineCount_ = 0;
+    size_t reshapedCount_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(BlockParagraph);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_TEXT_FIELD_BLOCK_PARAGRAPH_H
@@ -445,10 +445,9 @@ Size FlutterRenderTextField::Measure()
     }
 
     // Get height of text
-    auto paragraphTxt = static_cast<txt::ParagraphTxt*>(paragraph_.get());
-    if (paragraphTxt != nullptr) {
-        auto textHeight = paragraphTxt->GetHeight();
-        auto textLines = paragraphTxt->GetLineCount();
+    if (paragraph_) {
+        auto textHeight = paragraph_->GetHeight();
+        auto textLines = paragraph_->GetLineCount();
         auto layoutParamChanged = lastLayoutParam_.value() == GetLayoutParam();
         if (layoutParamChanged) {
             lastLayoutParam_ = std::make_optional(GetLayoutParam());
@@ -504,7 +503,6 @@ double FlutterRenderTextField::MeasureParagraph(
     auto displayText = GetTextForDisplay(GetEditingValue().text);
     showPlaceholder_ = displayText.empty();
     double errorTextWidth = 0.0;
-    paragraph_.reset(nullptr);
     errorParagraph_.reset(nullptr);
     countParagraph_.reset(nullptr);
     placeholderParagraph_.reset(nullptr);
@@ -533,18 +531,19 @@ double FlutterRenderTextField::MeasureParagraph(
         countParagraph_->Layout(textAreaWidth);
     }
     if (!showPlaceholder_) {
-        std::unique_ptr<txt::ParagraphBuilder> builder =
-            txt::ParagraphBuilder::CreateTxtBuilder(*paragraphStyle, GetFontCollection());
+        // Keep the paragraph across layouts, so that only the blocks touched by an edit are shaped again.
+        if (!paragraph_) {
+            paragraph_ = std::make_unique<BlockParagraph>();
+        }
         txtStyle = CreateTextStyle(style_);
-        builder->PushStyle(*txtStyle);
-        builder->AddText(displayText);
-        paragraph_ = builder->Build();
+        paragraph_->Update(displayText, *paragraphStyle, *txtStyle, GetFontCollection());
         paragraph_->Layout(textAreaWidth - errorTextWidth);
         if ((textDirection_ == TextDirection::RTL || realTextDirection_ == TextDirection::RTL) &&
             LessOrEqual(paragraph_->GetLongestLine(), innerRect_.Width())) {
             paragraph_->Layout(limitWidth);
         }
     } else {
+        paragraph_.reset(nullptr);
         std::unique_ptr<txt::ParagraphBuilder> placeholderBuilder =
             txt::ParagraphBuilder::CreateTxtBuilder(*paragraphStyle, GetFontCollection());
         txtStyle = CreateTextStyle(style_, true);
@@ -716,13 +715,9 @@ void FlutterRenderTextField::SetShaderIfNeeded(
         return;
     }
 
-    std::unique_ptr<txt::ParagraphBuilder> builder =
-        txt::ParagraphBuilder::CreateTxtBuilder(*paragraphStyle, GetFontCollection());
     txtStyle->has_foreground = true;
     txtStyle->foreground.setShader(shader);
-    builder->PushStyle(*txtStyle);
-    builder->AddText(GetTextForDisplay(GetEditingValue().text));
-    paragraph_ = builder->Build();
+    paragraph_->Update(GetTextForDisplay(GetEditingValue().text), *paragraphStyle, *txtStyle, GetFontCollection());
     paragraph_->Layout(textAreaWidth);
 }
 
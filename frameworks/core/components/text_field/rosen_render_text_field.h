@@ -24,6 +24,7 @@
 #include "third_party/skia/include/core/SkCanvas.h"
 
 #include "core/components/common/properties/decoration.h"
+#include "core/components/text_field/block_paragraph.h"
 #include "core/components/text_field/render_text_field.h"
 
 namespace txt {
@@ -116,7 +117,7 @@ private:
     void PaintOverlayForHoverAndPress(SkCanvas* canvas) const;
     void PaintTextField(const Offset& offset, RenderContext& context, SkCanvas* canvas, bool isMagnifier = false);
 
-    std::unique_ptr<txt::Paragraph> paragraph_;
+    std::unique_ptr<BlockParagraph> paragraph_;
     std::unique_ptr<txt::Paragraph> errorParagraph_;
     std::unique_ptr<txt::Paragraph> countParagraph_;
     std::unique_ptr<txt::Paragraph> placeholderParagraph_;
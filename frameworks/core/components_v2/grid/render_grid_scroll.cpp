@@ -67,6 +67,7 @@ void RenderGridScroll::Update(const RefPtr<Component>& component)
     mainGap_ = &rowGap_;
     startRankItemIndex_ = 0;
     currentItemIndex_ = 0;
+    startingItemRanges_.clear();
     RenderGridLayout::Update(component);
     TakeBoundary();
     const RefPtr<GridLayoutComponent> grid = AceType::DynamicCast<GridLayoutComponent>(component);
@@ -989,6 +990,22 @@ int32_t RenderGridScroll::GetItemMainIndex(int32_t index)
 
 int32_t RenderGridScroll::GetStartingItem(int32_t first)
 {
+    if (first <= 0) {
+        return 0;
+    }
+    // The nearest range at or before |first|.
+    auto range = startingItemRanges_.upper_bound(first);
+    int32_t coveredItem = -1;
+    int32_t coveredStartingItem = 0;
+    if (range != startingItemRanges_.begin()) {
+        --range;
+        if (first <= range->second) {
+            return range->first;
+        }
+        coveredItem = range->second;
+        coveredStartingItem = range->first;
+    }
+
     int32_t firstIndex = 0;
     int32_t index = first;
     int32_t itemMain = -1;
@@ -996,6 +1013,11 @@ int32_t RenderGridScroll::GetStartingItem(int32_t first)
     int32_t itemMainSpan = -1;
     int32_t itemCrossSpan = -1;
     while (index > 0) {
+        if (index <= coveredItem) {
+            // No item between the range and |first| starts a row, they share the starting item of the range.
+            firstIndex = coveredStartingItem;
+            break;
+        }
         if (getChildSpanByIndex_(
                 index, useScrollable_ == SCROLLABLE::HORIZONTAL, itemMain, itemCross, itemMainSpan, itemCrossSpan)) {
             LOGD("index %d %d,  %d,  %d,  %d", index, itemMain, itemCross, itemMainSpan, itemCrossSpan);
@@ -1007,11 +1029,22 @@ int32_t RenderGridScroll::GetStartingItem(int32_t first)
 
         index--;
     }
+    AddStartingItemRange(firstIndex, first);
     return firstIndex;
 }
 
+void RenderGridScroll::AddStartingItemRange(int32_t startingItem, int32_t last)
+{
+    auto result = startingItemRanges_.try_emplace(startingItem, last);
+    if (!result.second) {
+        result.first->second = std::max(result.first->second, last);
+    }
+}
+
 void RenderGridScroll::OnDataSourceUpdated(int32_t index)
 {
+    // Items may be inserted, deleted or change their spans, even before they are laid out.
+    startingItemRanges_.clear();
     if (items_.empty() && updateFlag_) {
         return;
     }
@@ -1057,15 +1090,24 @@ void RenderGridScroll::CalculateWholeSize(double drawLength)
     }
     scrollBarExtent_ = 0.0;
     startMainPos_ = 0.0;
-    for (int index = 0; index < *mainCount_; index++) {
-        if (index == startIndex_) {
+    // Sum the rows in one ordered pass instead of looking up each of them.
+    bool startFound = false;
+    for (const auto& [index, cells] : gridCells_) {
+        if (index >= *mainCount_) {
+            break;
+        }
+        if (!startFound && index >= startIndex_) {
             // get the start position in grid
             startMainPos_ = scrollBarExtent_;
+            startFound = true;
         }
-        if (gridCells_.find(index) == gridCells_.end()) {
-            continue;
+        auto cell = cells.find(0);
+        if (cell != cells.end()) {
+            scrollBarExtent_ += GetSize(cell->second) + *mainGap_;
         }
-        scrollBarExtent_ += GetSize(gridCells_.at(index).at(0)) + *mainGap_;
+    }
+    if (!startFound && startIndex_ < *mainCount_) {
+        startMainPos_ = scrollBarExtent_;
     }
     if (!isScrollable) {
         currentOffset_ = 0.0;
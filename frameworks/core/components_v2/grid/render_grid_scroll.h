@@ -87,6 +87,7 @@ public:
     void SetGetChildSpanByIndex(GetChildSpanByIndex func)
     {
         getChildSpanByIndex_ = std::move(func);
+        startingItemRanges_.clear();
     }
 
     void AddChildByIndex(int32_t index, const RefPtr<RenderNode>& renderNode);
@@ -191,6 +192,7 @@ protected:
     void DoJump(double position, int32_t source);
 
     int32_t GetStartingItem(int32_t first);
+    void AddStartingItemRange(int32_t startingItem, int32_t last);
     void LoadForward();
 
     double GetCurrentOffset() const
@@ -263,6 +265,10 @@ protected:
     GetChildSpanByIndex getChildSpanByIndex_;
     OnScrolledFunc scrolledEventFun_;
 
+    // Ranges of items [startingItem, last] found by GetStartingItem, keyed by the starting item. Every item in a range
+    // starts ranking from the same item, so a jump only asks the span of items not covered by any range.
+    std::map<int32_t, int32_t> startingItemRanges_;
+
     int32_t lastFirstIndex_ = -1;
     int32_t loadingIndex_ = -1;
     int32_t cacheCount_ = 1;
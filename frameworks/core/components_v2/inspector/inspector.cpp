@@ -15,9 +15,14 @@
 
 #include "inspector.h"
 
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+
 #include "inspector_composed_element.h"
 #include "shape_composed_element.h"
 
+#include "base/log/ace_trace.h"
 #include "core/components/root/root_element.h"
 
 namespace OHOS::Ace::V2 {
@@ -32,10 +37,23 @@ const char INSPECTOR_ID[] = "$ID";
 const char INSPECTOR_RECT[] = "$rect";
 const char INSPECTOR_Z_INDEX[] = "$z-index";
 const char INSPECTOR_ATTRS[] = "$attrs";
+const char INSPECTOR_PARENT[] = "$parent";
+const char INSPECTOR_CHANGED[] = "$changed";
+const char INSPECTOR_REMOVED[] = "$removed";
 #if defined(WINDOWS_PLATFORM) || defined(MAC_PLATFORM)
 const char INSPECTOR_DEBUGLINE[] = "$debugLine";
 #endif
 
+// Digests of the inspectors exported by the last export of changes of each instance.
+struct InspectorTreeSnapshot {
+    std::string key;
+    int32_t depth = -1;
+    std::unordered_map<int32_t, size_t> digests;
+};
+
+std::mutex g_snapshotMutex;
+std::unordered_map<int32_t, InspectorTreeSnapshot> g_snapshots;
+
 RefPtr<V2::InspectorComposedElement> GetInspectorByKey(const RefPtr<RootElement>& root, const std::string& key)
 {
     std::queue<RefPtr<Element>> elements;
@@ -58,18 +76,154 @@ RefPtr<V2::InspectorComposedElement> GetInspectorByKey(const RefPtr<RootElement>
     return nullptr;
 }
 
-void DumpElementTree(
-    int32_t depth, const RefPtr<Element>& element, std::map<int32_t, std::list<RefPtr<Element>>>& depthElementMap)
+void WriteJsonString(std::ostream& out, const std::string& value)
 {
-    if (element->GetChildren().empty()) {
-        return;
-    }
-    const auto& children = element->GetChildren();
-    depthElementMap[depth].insert(depthElementMap[depth].end(), children.begin(), children.end());
-    for (auto& depthElement : children) {
-        DumpElementTree(depth + 1, depthElement, depthElementMap);
+    out << '"';
+    for (char c : value) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8] = { 0 };
+                    if (snprintf(buffer, sizeof(buffer), "\\u%04x", c) > 0) {
+                        out << buffer;
+                    }
+                } else {
+                    out << c;
+                }
+                break;
+        }
     }
+    out << '"';
 }
+
+void WriteJsonKey(std::ostream& out, const char* key)
+{
+    out << '"' << key << "\":";
+}
+
+// Writes the inspectors depth first, each of them is written as soon as it is visited. Children are nested in their
+// nearest inspector ancestor, or listed flat with the id of the ancestor when only changes are exported.
+class InspectorTreeWriter final {
+public:
+    InspectorTreeWriter(std::ostream& out, int32_t maxDepth, InspectorTreeSnapshot* snapshot)
+        : out_(out), maxDepth_(maxDepth), snapshot_(snapshot)
+    {}
+    ~InspectorTreeWriter() = default;
+
+    // Writes the inspectors below |element| as items of an array, which is opened by |opener| before the first one.
+    // Returns the number of inspectors written.
+    int32_t WriteChildren(const RefPtr<Element>& element, int32_t depth, int32_t parentId, const char* opener)
+    {
+        int32_t count = 0;
+        WriteDescendants(element, depth, parentId, opener, count);
+        return count;
+    }
+
+    void WriteNode(const RefPtr<InspectorComposedElement>& inspector, int32_t depth, int32_t parentId, int32_t index,
+        const char* opener, int32_t& count)
+    {
+        auto id = StringUtils::StringToInt(inspector->GetId());
+        std::ostringstream node;
+        WriteNodeContent(node, inspector);
+        auto content = node.str();
+        bool needWrite = true;
+        if (snapshot_) {
+            auto digest = std::hash<std::string>()(content + '|' + std::to_string(parentId) + ':' +
+                                                   std::to_string(index));
+            auto iter = snapshot_->digests.find(id);
+            needWrite = iter == snapshot_->digests.end() || iter->second != digest;
+            digests_[id] = digest;
+        }
+        if (needWrite) {
+            out_ << (count == 0 ? opener : ",");
+            ++count;
+            out_ << '{' << content;
+        }
+        bool needWriteChildren = maxDepth_ < 0 || depth < maxDepth_;
+        if (snapshot_) {
+            if (needWrite) {
+                out_ << ',';
+                WriteJsonKey(out_, INSPECTOR_PARENT);
+                out_ << parentId << '}';
+            }
+            if (needWriteChildren) {
+                WriteDescendants(inspector, depth + 1, id, opener, count);
+            }
+            return;
+        }
+        if (needWriteChildren && WriteChildren(inspector, depth + 1, id, ",\"$children\":[") > 0) {
+            out_ << ']';
+        }
+        out_ << '}';
+    }
+
+    std::unordered_map<int32_t, size_t>& GetDigests()
+    {
+        return digests_;
+    }
+
+private:
+    void WriteDescendants(
+        const RefPtr<Element>& element, int32_t depth, int32_t parentId, const char* opener, int32_t& count)
+    {
+        int32_t index = 0;
+        for (const auto& child : element->GetChildren()) {
+            auto inspector = AceType::DynamicCast<InspectorComposedElement>(child);
+            if (inspector) {
+                WriteNode(inspector, depth, parentId, index++, opener, count);
+            } else {
+                WriteDescendants(child, depth, parentId, opener, count);
+            }
+        }
+    }
+
+    static void WriteNodeContent(std::ostream& out, const RefPtr<InspectorComposedElement>& inspector)
+    {
+        auto tag = inspector->GetTag();
+        auto shapeComposedElement = AceType::DynamicCast<ShapeComposedElement>(inspector);
+        if (shapeComposedElement != nullptr) {
+            tag = SHAPE_TYPE_STRINGS[StringUtils::StringToInt(shapeComposedElement->GetShapeType())];
+        }
+        WriteJsonKey(out, INSPECTOR_TYPE);
+        WriteJsonString(out, tag);
+        out << ',';
+        WriteJsonKey(out, INSPECTOR_ID);
+        out << StringUtils::StringToInt(inspector->GetId()) << ',';
+        WriteJsonKey(out, INSPECTOR_Z_INDEX);
+        out << inspector->GetZIndex() << ',';
+        WriteJsonKey(out, INSPECTOR_RECT);
+        WriteJsonString(out, inspector->GetRenderRect().ToBounds());
+        out << ',';
+#if defined(WINDOWS_PLATFORM) || defined(MAC_PLATFORM)
+        WriteJsonKey(out, INSPECTOR_DEBUGLINE);
+        WriteJsonString(out, inspector->GetDebugLine());
+        out << ',';
+#endif
+        // Attributes of one inspector are small, they are serialized by the inspector itself.
+        WriteJsonKey(out, INSPECTOR_ATTRS);
+        out << inspector->ToJsonObject()->ToString();
+    }
+
+    std::ostream& out_;
+    int32_t maxDepth_ = -1;
+    InspectorTreeSnapshot* snapshot_ = nullptr;
+    std::unordered_map<int32_t, size_t> digests_;
+};
 } // namespace
 
 std::string Inspector::GetInspectorNodeByKey(const RefPtr<PipelineContext>& context, const std::string& key)
@@ -96,88 +250,102 @@ std::string Inspector::GetInspectorNodeByKey(const RefPtr<PipelineContext>& cont
 
 std::string Inspector::GetInspectorTree(const RefPtr<PipelineContext>& context)
 {
-    auto jsonRoot = JsonUtil::Create(true);
-    jsonRoot->Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
-
-    float scale = context->GetViewScale();
-    double rootHeight = context->GetRootHeight();
-    double rootWidth = context->GetRootWidth();
-    jsonRoot->Put(INSPECTOR_WIDTH, std::to_string(rootWidth * scale).c_str());
-    jsonRoot->Put(INSPECTOR_HEIGHT, std::to_string(rootHeight * scale).c_str());
-    jsonRoot->Put(INSPECTOR_RESOLUTION, std::to_string(SystemProperties::GetResolution()).c_str());
+    std::ostringstream out;
+    ExportInspectorTree(context, InspectorTreeOptions(), out);
+    return out.str();
+}
 
+bool Inspector::ExportInspectorTree(
+    const RefPtr<PipelineContext>& context, const InspectorTreeOptions& options, std::ostream& out)
+{
+    if (!context) {
+        return false;
+    }
+    ACE_SCOPED_TRACE("ExportInspectorTree");
     auto root = AceType::DynamicCast<Element>(context->GetRootElement());
-    if (root == nullptr) {
-        return jsonRoot->ToString();
+    RefPtr<V2::InspectorComposedElement> keyInspector;
+    if (!options.key.empty()) {
+        keyInspector = GetInspectorByKey(context->GetRootElement(), options.key);
+        if (keyInspector == nullptr) {
+            LOGE("no inspector with key:%{public}s is found", options.key.c_str());
+            return false;
+        }
     }
 
-    std::map<int32_t, std::list<RefPtr<Element>>> depthElementMap;
-    depthElementMap[0].emplace_back(root);
-    DumpElementTree(1, root, depthElementMap);
-
-    size_t height = 0;
-    std::unordered_map<int32_t, std::vector<std::pair<RefPtr<Element>, std::string>>> elementJSONInfoMap;
-    for (int depth = static_cast<int32_t>(depthElementMap.size()); depth > 0; depth--) {
-        const auto& depthElements = depthElementMap[depth];
-        for (const auto& element : depthElements) {
-            auto inspectorElement = AceType::DynamicCast<V2::InspectorComposedElement>(element);
-            if (inspectorElement == nullptr) {
-                continue;
-            }
-
-            auto jsonNode = JsonUtil::Create(true);
-            jsonNode->Put(INSPECTOR_TYPE, inspectorElement->GetTag().c_str());
-            jsonNode->Put(INSPECTOR_ID, std::stoi(inspectorElement->GetId()));
-            jsonNode->Put(INSPECTOR_Z_INDEX, inspectorElement->GetZIndex());
-            jsonNode->Put(INSPECTOR_RECT, inspectorElement->GetRenderRect().ToBounds().c_str());
-#if defined(WINDOWS_PLATFORM) || defined(MAC_PLATFORM)
-            std::string debugLine = inspectorElement->GetDebugLine();
-            jsonNode->Put(INSPECTOR_DEBUGLINE, debugLine.c_str());
-#endif
-            auto jsonObject = inspectorElement->ToJsonObject();
-            jsonNode->Put(INSPECTOR_ATTRS, jsonObject);
-            auto shapeComposedElement = AceType::DynamicCast<V2::ShapeComposedElement>(element);
-            if (shapeComposedElement != nullptr) {
-                int type = StringUtils::StringToInt(shapeComposedElement->GetShapeType());
-                jsonNode->Replace(INSPECTOR_TYPE, SHAPE_TYPE_STRINGS[type]);
+    if (options.changedOnly) {
+        InspectorTreeSnapshot snapshot;
+        {
+            std::lock_guard<std::mutex> lock(g_snapshotMutex);
+            auto iter = g_snapshots.find(context->GetInstanceId());
+            if (iter != g_snapshots.end() && iter->second.key == options.key &&
+                iter->second.depth == options.depth) {
+                snapshot = std::move(iter->second);
             }
-            if (!element->GetChildren().empty()) {
-                if (height > 0) {
-                    auto jsonNodeArray = JsonUtil::CreateArray(true);
-                    auto childNodeJSONVec = elementJSONInfoMap[height - 1];
-                    for (auto iter = childNodeJSONVec.begin(); iter != childNodeJSONVec.end(); iter++) {
-                        auto parent = iter->first->GetElementParent().Upgrade();
-                        while (parent) {
-                            if (AceType::TypeName(parent) == AceType::TypeName(element) &&
-                                parent->GetRetakeId() == element->GetRetakeId()) {
-                                auto childJSONValue = JsonUtil::ParseJsonString(iter->second);
-                                jsonNodeArray->Put(childJSONValue);
-                                break;
-                            } else {
-                                parent = parent->GetElementParent().Upgrade();
-                            }
-                        }
-                    }
-                    if (jsonNodeArray->GetArraySize()) {
-                        jsonNode->Put(INSPECTOR_CHILDREN, jsonNodeArray);
-                    }
-                }
-            }
-            elementJSONInfoMap[height].emplace_back(element, jsonNode->ToString());
         }
-        if (elementJSONInfoMap.find(height) != elementJSONInfoMap.end()) {
-            height++;
+        InspectorTreeWriter writer(out, options.depth, &snapshot);
+        out << '{';
+        WriteJsonKey(out, INSPECTOR_CHANGED);
+        out << '[';
+        if (keyInspector) {
+            int32_t count = 0;
+            writer.WriteNode(keyInspector, 0, -1, 0, "", count);
+        } else if (root && options.depth != 0) {
+            writer.WriteChildren(root, 1, -1, "");
+        }
+        out << "],";
+        WriteJsonKey(out, INSPECTOR_REMOVED);
+        out << '[';
+        auto& digests = writer.GetDigests();
+        bool isFirst = true;
+        for (const auto& [id, digest] : snapshot.digests) {
+            if (digests.find(id) == digests.end()) {
+                out << (isFirst ? "" : ",") << id;
+                isFirst = false;
+            }
         }
+        out << "]}";
+
+        snapshot.key = options.key;
+        snapshot.depth = options.depth;
+        snapshot.digests = std::move(digests);
+        std::lock_guard<std::mutex> lock(g_snapshotMutex);
+        g_snapshots[context->GetInstanceId()] = std::move(snapshot);
+        return true;
     }
 
-    auto jsonNodeArray = JsonUtil::CreateArray(true);
-    auto firstDepthNodeVec = elementJSONInfoMap[elementJSONInfoMap.size() - 1];
-    for (const auto& nodeJSONInfo : firstDepthNodeVec) {
-        auto nodeJSONValue = JsonUtil::ParseJsonString(nodeJSONInfo.second);
-        jsonNodeArray->Put(nodeJSONValue);
+    InspectorTreeWriter writer(out, options.depth, nullptr);
+    if (keyInspector) {
+        int32_t count = 0;
+        writer.WriteNode(keyInspector, 0, -1, 0, "", count);
+        return true;
+    }
+    float scale = context->GetViewScale();
+    out << '{';
+    WriteJsonKey(out, INSPECTOR_TYPE);
+    WriteJsonString(out, INSPECTOR_ROOT);
+    out << ',';
+    WriteJsonKey(out, INSPECTOR_WIDTH);
+    WriteJsonString(out, std::to_string(context->GetRootWidth() * scale));
+    out << ',';
+    WriteJsonKey(out, INSPECTOR_HEIGHT);
+    WriteJsonString(out, std::to_string(context->GetRootHeight() * scale));
+    out << ',';
+    WriteJsonKey(out, INSPECTOR_RESOLUTION);
+    WriteJsonString(out, std::to_string(SystemProperties::GetResolution()));
+    out << ',';
+    WriteJsonKey(out, INSPECTOR_CHILDREN);
+    out << '[';
+    if (root && options.depth != 0) {
+        writer.WriteChildren(root, 1, -1, "");
     }
-    jsonRoot->Put(INSPECTOR_CHILDREN, jsonNodeArray);
-    return jsonRoot->ToString();
+    out << "]}";
+    return true;
+}
+
+void Inspector::RemoveInspectorTreeSnapshot(int32_t instanceId)
+{
+    std::lock_guard<std::mutex> lock(g_snapshotMutex);
+    g_snapshots.erase(instanceId);
 }
 
 bool Inspector::SendEventByKey(
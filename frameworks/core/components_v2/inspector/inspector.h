@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_V2_INSPECTOR_INSPECTOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_V2_INSPECTOR_INSPECTOR_H
 
+#include <ostream>
+
 #include "core/pipeline/pipeline_context.h"
 
 namespace OHOS::Ace::V2 {
@@ -29,12 +31,29 @@ struct JsKeyEvent final {
     int32_t deviceId = 0;
 };
 
+struct InspectorTreeOptions final {
+    // Exports the subtree of the inspector with the key, the whole tree if empty.
+    std::string key;
+    // Levels of inspectors exported below the root, negative for all of them.
+    int32_t depth = -1;
+    // Exports the inspectors changed since the last export of changes with the same key and depth, and the ids of
+    // the removed ones.
+    bool changedOnly = false;
+};
+
 class ACE_EXPORT Inspector {
 public:
     static std::string GetInspectorNodeByKey(const RefPtr<PipelineContext>& context, const std::string& key);
 
     static std::string GetInspectorTree(const RefPtr<PipelineContext>& context);
 
+    // Writes the inspectors to |out| one by one, without building the json document of the whole tree.
+    static bool ExportInspectorTree(
+        const RefPtr<PipelineContext>& context, const InspectorTreeOptions& options, std::ostream& out);
+
+    // Drops the inspectors recorded by the last export of changes of the instance.
+    static void RemoveInspectorTreeSnapshot(int32_t instanceId);
+
     static bool SendEventByKey(
         const RefPtr<PipelineContext>& context, const std::string& key, int action, const std::string& params);
 
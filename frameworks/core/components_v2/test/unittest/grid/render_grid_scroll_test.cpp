@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/components/test/unittest/mock/mock_render_common.h"
+#define private public
+#define protected public
+#include "core/components_v2/grid/render_grid_scroll.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::V2 {
+namespace {
+
+constexpr int32_t COLUMN_COUNT = 3;
+
+} // namespace
+
+class RenderGridScrollTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    // Place items in rows of COLUMN_COUNT columns, |firstSpan| is the column span of the first item.
+    void SetFirstItemSpan(int32_t firstSpan);
+
+    RefPtr<PipelineContext> mockContext_;
+    RefPtr<RenderGridScroll> renderNode_;
+    int32_t spanCount_ = 0;
+};
+
+void RenderGridScrollTest::SetUp()
+{
+    mockContext_ = MockRenderCommon::GetMockContext();
+    renderNode_ = AceType::MakeRefPtr<RenderGridScroll>();
+    renderNode_->Attach(mockContext_);
+    renderNode_->useScrollable_ = RenderGridScroll::SCROLLABLE::VERTICAL;
+    SetFirstItemSpan(1);
+}
+
+void RenderGridScrollTest::TearDown()
+{
+    mockContext_ = nullptr;
+    renderNode_ = nullptr;
+}
+
+void RenderGridScrollTest::SetFirstItemSpan(int32_t firstSpan)
+{
+    renderNode_->SetGetChildSpanByIndex([this, firstSpan](int32_t index, bool isHorizontal, int32_t& itemMain,
+                                            int32_t& itemCross, int32_t& itemMainSpan, int32_t& itemCrossSpan) {
+        ++spanCount_;
+        int32_t cell = index == 0 ? 0 : index + firstSpan - 1;
+        itemMain = cell / COLUMN_COUNT;
+        itemCross = cell % COLUMN_COUNT;
+        itemMainSpan = 1;
+        itemCrossSpan = index == 0 ? firstSpan : 1;
+        return true;
+    });
+}
+
+/**
+ * @tc.name: GetStartingItem001
+ * @tc.desc: Test the starting items of rows are cached and spans of cached items are not asked again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderGridScrollTest, GetStartingItem001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Get the starting item of an item in the middle of a row.
+     * @tc.expected: step1. The spans of the item and the starting item are asked.
+     */
+    EXPECT_EQ(renderNode_->GetStartingItem(0), 0);
+    EXPECT_EQ(renderNode_->GetStartingItem(10), 9);
+    EXPECT_EQ(spanCount_, 2);
+
+    /**
+     * @tc.steps: step2. Get the starting items of the same item and the starting item again.
+     * @tc.expected: step2. They are taken from the cache.
+     */
+    spanCount_ = 0;
+    EXPECT_EQ(renderNode_->GetStartingItem(10), 9);
+    EXPECT_EQ(renderNode_->GetStartingItem(9), 9);
+    EXPECT_EQ(spanCount_, 0);
+
+    /**
+     * @tc.steps: step3. Get the starting item of the next item of the row.
+     * @tc.expected: step3. Only the span of the next item is asked and the range is extended.
+     */
+    EXPECT_EQ(renderNode_->GetStartingItem(11), 9);
+    EXPECT_EQ(spanCount_, 1);
+    ASSERT_EQ(renderNode_->startingItemRanges_.size(), 1UL);
+    EXPECT_EQ(renderNode_->startingItemRanges_[9], 11);
+
+    /**
+     * @tc.steps: step4. Get the starting item of the first item of the next row.
+     * @tc.expected: step4. The item starts a new range.
+     */
+    spanCount_ = 0;
+    EXPECT_EQ(renderNode_->GetStartingItem(12), 12);
+    EXPECT_EQ(spanCount_, 1);
+    EXPECT_EQ(renderNode_->startingItemRanges_.size(), 2UL);
+}
+
+/**
+ * @tc.name: GetStartingItem002
+ * @tc.desc: Test the cached starting items are dropped when items are inserted or deleted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderGridScrollTest, GetStartingItem002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Cache the starting item of an item.
+     */
+    renderNode_->updateFlag_ = true;
+    EXPECT_EQ(renderNode_->GetStartingItem(10), 9);
+    EXPECT_FALSE(renderNode_->startingItemRanges_.empty());
+
+    /**
+     * @tc.steps: step2. Insert an item before the first item of the data source, so the items after it move to the
+     *                   next column, then notify the grid which has no item laid out.
+     * @tc.expected: step2. The cache is dropped and the starting item is found in the new place.
+     */
+    renderNode_->OnDataSourceUpdated(0);
+    EXPECT_TRUE(renderNode_->startingItemRanges_.empty());
+    renderNode_->getChildSpanByIndex_ = [](int32_t index, bool isHorizontal, int32_t& itemMain, int32_t& itemCross,
+                                            int32_t& itemMainSpan, int32_t& itemCrossSpan) {
+        itemMain = (index + 1) / COLUMN_COUNT;
+        itemCross = (index + 1) % COLUMN_COUNT;
+        itemMainSpan = 1;
+        itemCrossSpan = 1;
+        return true;
+    };
+    EXPECT_EQ(renderNode_->GetStartingItem(10), 8);
+
+    /**
+     * @tc.steps: step3. Delete the inserted item and notify the grid.
+     * @tc.expected: step3. The cache is dropped and the starting item is found in the original place.
+     */
+    EXPECT_FALSE(renderNode_->startingItemRanges_.empty());
+    renderNode_->updateFlag_ = false;
+    renderNode_->OnDataSourceUpdated(0);
+    EXPECT_TRUE(renderNode_->startingItemRanges_.empty());
+    SetFirstItemSpan(1);
+    EXPECT_EQ(renderNode_->GetStartingItem(10), 9);
+
+    /**
+     * @tc.steps: step4. Let the first item span the whole row.
+     * @tc.expected: step4. The cache is dropped with the old spans and the starting item follows the new spans.
+     */
+    SetFirstItemSpan(COLUMN_COUNT);
+    EXPECT_EQ(renderNode_->GetStartingItem(10), 10);
+    EXPECT_EQ(renderNode_->GetStartingItem(11), 10);
+}
+
+} // namespace OHOS::Ace::V2
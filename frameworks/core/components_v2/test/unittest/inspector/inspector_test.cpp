@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <set>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_util.h"
+#include "base/utils/string_utils.h"
+#include "core/components/root/root_element.h"
+#include "core/components/test/unittest/mock/mock_render_common.h"
+#define protected public
+#include "core/components_v2/inspector/inspector_composed_element.h"
+#undef protected
+#include "core/components_v2/inspector/inspector.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::V2 {
+namespace {
+
+constexpr int32_t COLUMN_ID = 1001;
+constexpr int32_t FIRST_TEXT_ID = 1002;
+constexpr int32_t ROW_ID = 1003;
+constexpr int32_t SECOND_TEXT_ID = 1004;
+constexpr int32_t NO_PARENT_ID = -1;
+const char COLUMN_KEY[] = "column";
+const char ROW_KEY[] = "row";
+const char CHILDREN[] = "$children";
+const char CHANGED[] = "$changed";
+const char REMOVED[] = "$removed";
+const char ID[] = "$ID";
+const char PARENT[] = "$parent";
+
+// The tree of the test:
+// Column
+// |-- Text
+// |-- Row
+//     |-- Text
+struct InspectorTree {
+    RefPtr<PipelineContext> context;
+    RefPtr<InspectorComposedElement> column;
+    RefPtr<InspectorComposedElement> firstText;
+    RefPtr<InspectorComposedElement> row;
+    RefPtr<InspectorComposedElement> secondText;
+};
+
+void AddInspector(const RefPtr<Element>& parent, const RefPtr<InspectorComposedElement>& inspector)
+{
+    parent->AddChild(inspector, static_cast<int32_t>(parent->GetChildren().size()));
+    inspector->SetParent(AceType::WeakClaim(AceType::RawPtr(parent)));
+}
+
+RefPtr<InspectorComposedElement> CreateInspector(int32_t id, const std::string& tag, const std::string& key)
+{
+    auto inspector = AceType::MakeRefPtr<InspectorComposedElement>(std::to_string(id));
+    inspector->name_ = tag;
+    inspector->SetKey(key);
+    return inspector;
+}
+
+InspectorTree CreateInspectorTree()
+{
+    InspectorTree tree;
+    tree.context = MockRenderCommon::GetMockContext();
+    tree.column = CreateInspector(COLUMN_ID, "Column", COLUMN_KEY);
+    tree.firstText = CreateInspector(FIRST_TEXT_ID, "Text", "");
+    tree.row = CreateInspector(ROW_ID, "Row", ROW_KEY);
+    tree.secondText = CreateInspector(SECOND_TEXT_ID, "Text", "");
+    AddInspector(tree.context->GetRootElement(), tree.column);
+    AddInspector(tree.column, tree.firstText);
+    AddInspector(tree.column, tree.row);
+    AddInspector(tree.row, tree.secondText);
+    return tree;
+}
+
+// Builds the json document of an inspector and its children, the way the tree was exported before streaming.
+std::unique_ptr<JsonValue> CreateInspectorJson(const RefPtr<InspectorComposedElement>& inspector)
+{
+    auto jsonNode = JsonUtil::Create(true);
+    jsonNode->Put("$type", inspector->GetTag().c_str());
+    jsonNode->Put(ID, StringUtils::StringToInt(inspector->GetId()));
+    jsonNode->Put("$z-index", inspector->GetZIndex());
+    jsonNode->Put("$rect", inspector->GetRenderRect().ToBounds().c_str());
+#if defined(WINDOWS_PLATFORM) || defined(MAC_PLATFORM)
+    jsonNode->Put("$debugLine", inspector->GetDebugLine().c_str());
+#endif
+    auto jsonObject = inspector->ToJsonObject();
+    jsonNode->Put("$attrs", jsonObject);
+    auto jsonNodeArray = JsonUtil::CreateArray(true);
+    for (const auto& child : inspector->GetChildren()) {
+        auto childInspector = AceType::DynamicCast<InspectorComposedElement>(child);
+        if (childInspector) {
+            auto childJson = CreateInspectorJson(childInspector);
+            jsonNodeArray->Put(childJson);
+        }
+    }
+    if (jsonNodeArray->GetArraySize() > 0) {
+        jsonNode->Put(CHILDREN, jsonNodeArray);
+    }
+    return jsonNode;
+}
+
+std::unique_ptr<JsonValue> Export(const RefPtr<PipelineContext>& context, const InspectorTreeOptions& options)
+{
+    std::ostringstream out;
+    if (!Inspector::ExportInspectorTree(context, options, out)) {
+        return nullptr;
+    }
+    return JsonUtil::ParseJsonString(out.str());
+}
+
+std::set<int32_t> GetIds(const std::unique_ptr<JsonValue>& array)
+{
+    std::set<int32_t> ids;
+    for (int32_t index = 0; array && index < array->GetArraySize(); ++index) {
+        auto item = array->GetArrayItem(index);
+        ids.insert(item->IsObject() ? item->GetInt(ID) : item->GetInt());
+    }
+    return ids;
+}
+
+int32_t GetParentId(const std::unique_ptr<JsonValue>& changed, int32_t id)
+{
+    for (int32_t index = 0; index < changed->GetArraySize(); ++index) {
+        auto item = changed->GetArrayItem(index);
+        if (item->GetInt(ID) == id) {
+            return item->GetInt(PARENT);
+        }
+    }
+    return NO_PARENT_ID;
+}
+
+} // namespace
+
+class InspectorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: ExportInspectorTree001
+ * @tc.desc: Test the streamed tree is the json document of the nested inspectors.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InspectorTest, ExportInspectorTree001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Export the tree of nested inspectors.
+     * @tc.expected: step1. The output parses and equals the json document of the tree.
+     */
+    auto tree = CreateInspectorTree();
+    auto result = JsonUtil::ParseJsonString(Inspector::GetInspectorTree(tree.context));
+    ASSERT_TRUE(result && result->IsValid());
+    float scale = tree.context->GetViewScale();
+    auto expected = JsonUtil::Create(true);
+    expected->Put("$type", "root");
+    expected->Put("width", std::to_string(tree.context->GetRootWidth() * scale).c_str());
+    expected->Put("height", std::to_string(tree.context->GetRootHeight() * scale).c_str());
+    expected->Put("$resolution", std::to_string(SystemProperties::GetResolution()).c_str());
+    auto children = JsonUtil::CreateArray(true);
+    auto columnJson = CreateInspectorJson(tree.column);
+    children->Put(columnJson);
+    expected->Put(CHILDREN, children);
+    EXPECT_EQ(result->ToString(), expected->ToString());
+
+    /**
+     * @tc.steps: step2. Export a tree whose attributes need escaping.
+     * @tc.expected: step2. The output still parses and keeps the tag.
+     */
+    const std::string tag = "Text\"\\\n\t\x01";
+    tree.secondText->name_ = tag;
+    result = JsonUtil::ParseJsonString(Inspector::GetInspectorTree(tree.context));
+    ASSERT_TRUE(result && result->IsValid());
+    auto column = result->GetValue(CHILDREN)->GetArrayItem(0);
+    auto row = column->GetValue(CHILDREN)->GetArrayItem(1);
+    auto secondText = row->GetValue(CHILDREN)->GetArrayItem(0);
+    EXPECT_EQ(secondText->GetString("$type"), tag);
+}
+
+/**
+ * @tc.name: ExportInspectorTree002
+ * @tc.desc: Test the tree is filtered by depth and key.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InspectorTest, ExportInspectorTree002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Export the tree with depth 0, 1 and 2.
+     * @tc.expected: step1. Only the inspectors up to the depth are exported.
+     */
+    auto tree = CreateInspectorTree();
+    InspectorTreeOptions options;
+    options.depth = 0;
+    auto result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->GetValue(CHILDREN)->GetArraySize(), 0);
+
+    options.depth = 1;
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    auto column = result->GetValue(CHILDREN)->GetArrayItem(0);
+    EXPECT_EQ(column->GetInt(ID), COLUMN_ID);
+    EXPECT_FALSE(column->Contains(CHILDREN));
+
+    options.depth = 2;
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    column = result->GetValue(CHILDREN)->GetArrayItem(0);
+    EXPECT_EQ(GetIds(column->GetValue(CHILDREN)), std::set<int32_t>({ FIRST_TEXT_ID, ROW_ID }));
+    EXPECT_FALSE(column->GetValue(CHILDREN)->GetArrayItem(1)->Contains(CHILDREN));
+
+    /**
+     * @tc.steps: step2. Export the subtree of the row by its key, in full and with depth 0.
+     * @tc.expected: step2. The row is the root of the output, with its text only when the depth allows it.
+     */
+    options.key = ROW_KEY;
+    options.depth = -1;
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->GetInt(ID), ROW_ID);
+    EXPECT_EQ(GetIds(result->GetValue(CHILDREN)), std::set<int32_t>({ SECOND_TEXT_ID }));
+    EXPECT_EQ(result->ToString(), CreateInspectorJson(tree.row)->ToString());
+
+    options.depth = 0;
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->GetInt(ID), ROW_ID);
+    EXPECT_FALSE(result->Contains(CHILDREN));
+
+    /**
+     * @tc.steps: step3. Export the subtree of an unknown key.
+     * @tc.expected: step3. The export fails.
+     */
+    options.key = "unknown";
+    std::ostringstream out;
+    EXPECT_FALSE(Inspector::ExportInspectorTree(tree.context, options, out));
+}
+
+/**
+ * @tc.name: ExportInspectorTree003
+ * @tc.desc: Test the changes of the tree report changed and removed inspectors.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InspectorTest, ExportInspectorTree003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Export the changes of a new tree.
+     * @tc.expected: step1. All the inspectors are changed, each with the id of its parent.
+     */
+    auto tree = CreateInspectorTree();
+    auto instanceId = tree.context->GetInstanceId();
+    Inspector::RemoveInspectorTreeSnapshot(instanceId);
+    InspectorTreeOptions options;
+    options.changedOnly = true;
+    auto result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    auto changed = result->GetValue(CHANGED);
+    EXPECT_EQ(GetIds(changed), std::set<int32_t>({ COLUMN_ID, FIRST_TEXT_ID, ROW_ID, SECOND_TEXT_ID }));
+    EXPECT_EQ(GetParentId(changed, COLUMN_ID), NO_PARENT_ID);
+    EXPECT_EQ(GetParentId(changed, FIRST_TEXT_ID), COLUMN_ID);
+    EXPECT_EQ(GetParentId(changed, SECOND_TEXT_ID), ROW_ID);
+    EXPECT_TRUE(GetIds(result->GetValue(REMOVED)).empty());
+
+    /**
+     * @tc.steps: step2. Export the changes again.
+     * @tc.expected: step2. Nothing is changed or removed.
+     */
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(GetIds(result->GetValue(CHANGED)).empty());
+    EXPECT_TRUE(GetIds(result->GetValue(REMOVED)).empty());
+
+    /**
+     * @tc.steps: step3. Remove the first text and move the second text from the row to the column.
+     * @tc.expected: step3. The moved inspectors are changed and the first text is removed.
+     */
+    tree.column->RemoveChild(tree.firstText);
+    tree.row->RemoveChild(tree.secondText);
+    AddInspector(tree.column, tree.secondText);
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    changed = result->GetValue(CHANGED);
+    EXPECT_EQ(GetIds(changed), std::set<int32_t>({ ROW_ID, SECOND_TEXT_ID }));
+    EXPECT_EQ(GetParentId(changed, SECOND_TEXT_ID), COLUMN_ID);
+    EXPECT_EQ(GetIds(result->GetValue(REMOVED)), std::set<int32_t>({ FIRST_TEXT_ID }));
+
+    /**
+     * @tc.steps: step4. Drop the snapshot of the instance, as done when it is destroyed, and export the changes.
+     * @tc.expected: step4. All the inspectors are changed again.
+     */
+    Inspector::RemoveInspectorTreeSnapshot(instanceId);
+    result = Export(tree.context, options);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(GetIds(result->GetValue(CHANGED)), std::set<int32_t>({ COLUMN_ID, ROW_ID, SECOND_TEXT_ID }));
+    EXPECT_TRUE(GetIds(result->GetValue(REMOVED)).empty());
+}
+
+} // namespace OHOS::Ace::V2
@@ -18,6 +18,34 @@
 #include "core/gestures/gesture_recognizer.h"
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr size_t MAX_POOLED_SCOPES = 10;
+
+} // namespace
+
+size_t GestureScope::GetBucketIndex(GesturePriority priority)
+{
+    switch (priority) {
+        case GesturePriority::High:
+            return static_cast<size_t>(GesturePriority::High);
+        case GesturePriority::Parallel:
+            return static_cast<size_t>(GesturePriority::Parallel);
+        case GesturePriority::Low:
+        default:
+            return static_cast<size_t>(GesturePriority::Low);
+    }
+}
+
+void GestureScope::Reset(size_t touchId)
+{
+    touchId_ = touchId;
+    disposalDepth_ = 0;
+    recyclePending_ = false;
+    for (auto& members : members_) {
+        members.clear();
+    }
+}
 
 void GestureScope::AddMember(const RefPtr<GestureRecognizer>& recognizer)
 {
@@ -31,18 +59,13 @@ void GestureScope::AddMember(const RefPtr<GestureRecognizer>& recognizer)
         return;
     }
 
-
     recognizer->SetRefereeState(RefereeState::DETECTING);
 
     switch (recognizer->GetPriority()) {
         case GesturePriority::Parallel:
-            parallelRecognizers_.emplace_back(recognizer);
-            break;
         case GesturePriority::High:
-            highRecognizers_.emplace_back(recognizer);
-            break;
         case GesturePriority::Low:
-            lowRecognizers_.emplace_back(recognizer);
+            GetMembersByRecognizer(recognizer).emplace_back(recognizer);
             break;
         default:
             LOGW("Add unknown type member %{public}d to referee", recognizer->GetPriority());
@@ -67,7 +90,7 @@ void GestureScope::DelMember(const RefPtr<GestureRecognizer>& recognizer)
     recognizer->SetRefereeState(RefereeState::DETECTING);
 
     if (recognizer->GetPriority() == GesturePriority::Parallel) {
-        parallelRecognizers_.remove(recognizer);
+        RemoveMember(GetMembers(GesturePriority::Parallel), recognizer);
         return;
     }
 
@@ -106,11 +129,11 @@ void GestureScope::HandleGestureDisposal(const RefPtr<GestureRecognizer>& recogn
 void GestureScope::HandleParallelDisposal(const RefPtr<GestureRecognizer>& recognizer, GestureDisposal disposal)
 {
     if (disposal == GestureDisposal::REJECT) {
-        parallelRecognizers_.remove(recognizer);
+        RemoveMember(GetMembers(GesturePriority::Parallel), recognizer);
         recognizer->SetRefereeState(RefereeState::FAIL);
         recognizer->OnRejected(touchId_);
     } else if (disposal == GestureDisposal::ACCEPT) {
-        parallelRecognizers_.remove(recognizer);
+        RemoveMember(GetMembers(GesturePriority::Parallel), recognizer);
         recognizer->SetRefereeState(RefereeState::SUCCEED);
         recognizer->OnAccepted(touchId_);
     }
@@ -156,24 +179,35 @@ void GestureScope::RemoveAndUnBlockGesture(bool isPrevPending, const WeakPtr<Ges
     if (!recognizer) {
         return;
     }
+    auto& highRecognizers = GetMembers(GesturePriority::High);
+    auto& lowRecognizers = GetMembers(GesturePriority::Low);
     if (recognizer->GetPriority() == GesturePriority::High) {
-        highRecognizers_.remove(recognizer);
-        if (highRecognizers_.empty()) {
-            UnBlockGesture(lowRecognizers_);
+        RemoveMember(highRecognizers, recognizer);
+        if (highRecognizers.empty()) {
+            UnBlockGesture(lowRecognizers);
             return;
         }
 
         if (isPrevPending) {
-            UnBlockGesture(highRecognizers_);
+            UnBlockGesture(highRecognizers);
         }
     } else {
-        lowRecognizers_.remove(recognizer);
+        RemoveMember(lowRecognizers, recognizer);
         if (isPrevPending) {
-            UnBlockGesture(lowRecognizers_);
+            UnBlockGesture(lowRecognizers);
         }
     }
 }
 
+void GestureScope::RemoveMember(Members& members, const RefPtr<GestureRecognizer>& recognizer)
+{
+    // Keep the order of members, the first blocked member is unblocked first.
+    auto iter = std::find(members.begin(), members.end(), recognizer);
+    if (iter != members.end()) {
+        members.erase(iter);
+    }
+}
+
 bool GestureScope::Existed(const RefPtr<GestureRecognizer>& recognizer)
 {
     if (!recognizer) {
@@ -181,42 +215,30 @@ bool GestureScope::Existed(const RefPtr<GestureRecognizer>& recognizer)
         return false;
     }
 
-    std::list<WeakPtr<GestureRecognizer>> members = GetMembersByRecognizer(recognizer);
-    if (members.empty()) {
-        return false;
-    }
-
-    auto result = std::find(members.cbegin(), members.cend(), recognizer);
-    return result != members.cend();
+    const auto& members = GetMembersByRecognizer(recognizer);
+    return std::find(members.cbegin(), members.cend(), recognizer) != members.cend();
 }
 
-const std::list<WeakPtr<GestureRecognizer>>& GestureScope::GetMembersByRecognizer(
-    const RefPtr<GestureRecognizer>& recognizer)
+GestureScope::Members& GestureScope::GetMembersByRecognizer(const RefPtr<GestureRecognizer>& recognizer)
 {
-    switch (recognizer->GetPriority()) {
-        case GesturePriority::Low:
-            return lowRecognizers_;
-        case GesturePriority::High:
-            return highRecognizers_;
-        case GesturePriority::Parallel:
-            return parallelRecognizers_;
-        default:
-            return lowRecognizers_;
-    }
+    return GetMembers(recognizer->GetPriority());
 }
 
 bool GestureScope::CheckNeedBlocked(const RefPtr<GestureRecognizer>& recognizer)
 {
-    if (recognizer->GetPriority() == GesturePriority::Low && !highRecognizers_.empty()) {
+    if (recognizer->GetPriority() == GesturePriority::Low && !GetMembers(GesturePriority::High).empty()) {
         LOGD("self is low priority, high recognizers are not processed");
         return true;
     }
 
-    std::list<WeakPtr<GestureRecognizer>> members = GetMembersByRecognizer(recognizer);
+    const auto& members = GetMembersByRecognizer(recognizer);
     auto pendingMember =
-        std::find_if(std::begin(members), std::end(members), [recognizer](const WeakPtr<GestureRecognizer>& member) {
-            return (member != recognizer) &&
-                   (member.Upgrade() && member.Upgrade()->GetRefereeState() == RefereeState::PENDING);
+        std::find_if(members.begin(), members.end(), [&recognizer](const WeakPtr<GestureRecognizer>& member) {
+            if (member == recognizer) {
+                return false;
+            }
+            auto strongMember = member.Upgrade();
+            return strongMember && strongMember->GetRefereeState() == RefereeState::PENDING;
         });
 
     if (pendingMember != members.end()) {
@@ -227,131 +249,158 @@ bool GestureScope::CheckNeedBlocked(const RefPtr<GestureRecognizer>& recognizer)
     return false;
 }
 
-void GestureScope::AcceptGesture(const RefPtr<GestureRecognizer>& recognizer)
+void GestureScope::RejectMembers(Members& members, const RefPtr<GestureRecognizer>& acceptedRecognizer)
 {
-    if (recognizer->GetPriority() == GesturePriority::Low) {
-        for (const auto& rejectedItem : lowRecognizers_) {
-            if (rejectedItem == recognizer) {
-                continue;
-            }
-            auto strongItem = rejectedItem.Upgrade();
-            if (strongItem) {
-                strongItem->OnRejected(touchId_);
-                strongItem->SetRefereeState(RefereeState::FAIL);
-            }
+    // Rejected members may delete themselves from the bucket in the callback, so iterate over a copy.
+    Members rejectedMembers = members;
+    for (const auto& rejectedItem : rejectedMembers) {
+        if (rejectedItem == acceptedRecognizer) {
+            continue;
         }
-    } else {
-        for (const auto& rejectedItem : highRecognizers_) {
-            if (rejectedItem == recognizer) {
-                continue;
-            }
-            auto strongItem = rejectedItem.Upgrade();
-            if (strongItem) {
-                strongItem->OnRejected(touchId_);
-                strongItem->SetRefereeState(RefereeState::FAIL);
-            }
+        auto strongItem = rejectedItem.Upgrade();
+        if (strongItem) {
+            strongItem->OnRejected(touchId_);
+            strongItem->SetRefereeState(RefereeState::FAIL);
         }
+    }
+}
 
-        for (const auto& rejectedItem : lowRecognizers_) {
-            if (rejectedItem == recognizer) {
-                continue;
-            }
-            auto strongItem = rejectedItem.Upgrade();
-            if (strongItem) {
-                strongItem->OnRejected(touchId_);
-                strongItem->SetRefereeState(RefereeState::FAIL);
-            }
-        }
+void GestureScope::AcceptGesture(const RefPtr<GestureRecognizer>& recognizer)
+{
+    auto& highRecognizers = GetMembers(GesturePriority::High);
+    auto& lowRecognizers = GetMembers(GesturePriority::Low);
+    if (recognizer->GetPriority() != GesturePriority::Low) {
+        RejectMembers(highRecognizers, recognizer);
     }
+    RejectMembers(lowRecognizers, recognizer);
 
     recognizer->SetRefereeState(RefereeState::SUCCEED);
     recognizer->OnAccepted(touchId_);
-    if (recognizer->GetPriority() == GesturePriority::Low) {
-        lowRecognizers_.clear();
-    } else {
-        highRecognizers_.clear();
-        lowRecognizers_.clear();
+    if (recognizer->GetPriority() != GesturePriority::Low) {
+        highRecognizers.clear();
     }
+    lowRecognizers.clear();
 }
 
-void GestureScope::UnBlockGesture(std::list<WeakPtr<GestureRecognizer>>& members)
+void GestureScope::UnBlockGesture(Members& members)
 {
-    auto weakBlockedMember =
-        std::find_if(std::begin(members), std::end(members), [](const WeakPtr<GestureRecognizer>& member) {
-            return member.Upgrade() && member.Upgrade()->GetRefereeState() == RefereeState::BLOCKED;
-        });
-    if (weakBlockedMember == members.end()) {
-        LOGD("no blocked gesture in recognizers");
-        return;
+    RefPtr<GestureRecognizer> blockedMember;
+    for (const auto& member : members) {
+        auto strongMember = member.Upgrade();
+        if (strongMember && strongMember->GetRefereeState() == RefereeState::BLOCKED) {
+            blockedMember = strongMember;
+            break;
+        }
     }
-    auto blockedMember = (*weakBlockedMember).Upgrade();
     if (!blockedMember) {
-        LOGW("BlockedMember not exists.");
+        LOGD("no blocked gesture in recognizers");
         return;
     }
 
-    if ((blockedMember)->GetDetectState() == DetectState::DETECTED) {
+    if (blockedMember->GetDetectState() == DetectState::DETECTED) {
         LOGD("unblock and accept this gesture");
         AcceptGesture(blockedMember);
         return;
     }
 
-    LOGD("set the gesture %{public}s to be pending", AceType::TypeName((*blockedMember)));
-    (blockedMember)->SetRefereeState(RefereeState::PENDING);
-    (blockedMember)->OnPending(touchId_);
+    LOGD("set the gesture %{public}s to be pending", AceType::TypeName(blockedMember));
+    blockedMember->SetRefereeState(RefereeState::PENDING);
+    blockedMember->OnPending(touchId_);
 }
 
 void GestureScope::ForceClose()
 {
     LOGD("force close gesture scope of id %{public}zu", touchId_);
-    for (const auto& weakRejectedItem : lowRecognizers_) {
-        auto rejectedItem = weakRejectedItem.Upgrade();
-        if (rejectedItem) {
-            rejectedItem->OnRejected(touchId_);
+    for (auto priority : { GesturePriority::Low, GesturePriority::High, GesturePriority::Parallel }) {
+        // Take the members out first, the callbacks may delete members of the bucket.
+        Members rejectedMembers;
+        rejectedMembers.swap(GetMembers(priority));
+        for (const auto& weakRejectedItem : rejectedMembers) {
+            auto rejectedItem = weakRejectedItem.Upgrade();
+            if (rejectedItem) {
+                rejectedItem->OnRejected(touchId_);
+            }
+        }
+        // Give the storage back, so that the bucket keeps its capacity when the scope is recycled.
+        auto& members = GetMembers(priority);
+        if (members.empty()) {
+            rejectedMembers.clear();
+            members.swap(rejectedMembers);
         }
     }
-    lowRecognizers_.clear();
+}
 
-    for (const auto& weakRejectedItem : highRecognizers_) {
-        auto rejectedItem = weakRejectedItem.Upgrade();
-        if (rejectedItem) {
-            rejectedItem->OnRejected(touchId_);
+bool GestureScope::IsPending() const
+{
+    for (const auto& members : members_) {
+        auto pendingMember =
+            std::find_if(members.begin(), members.end(), [](const WeakPtr<GestureRecognizer>& member) {
+                auto strongMember = member.Upgrade();
+                return strongMember && strongMember->GetRefereeState() == RefereeState::PENDING;
+            });
+        if (pendingMember != members.end()) {
+            return true;
         }
     }
-    highRecognizers_.clear();
+    return false;
+}
 
-    for (const auto& weakRejectedItem : parallelRecognizers_) {
-        auto rejectedItem = weakRejectedItem.Upgrade();
-        if (rejectedItem) {
-            rejectedItem->OnRejected(touchId_);
+GestureScope* GestureReferee::FindScope(size_t touchId) const
+{
+    for (const auto& scope : gestureScopes_) {
+        // A scope cleaned during its disposal is done with its touch sequence, even though it is not recycled yet.
+        if (scope->GetTouchId() == touchId && !scope->IsRecyclePending()) {
+            return scope.get();
         }
     }
-    parallelRecognizers_.clear();
+    return nullptr;
 }
 
-bool GestureScope::IsPending() const
+GestureScope* GestureReferee::AcquireScope(size_t touchId)
 {
-    auto pendingMember = std::find_if(
-        std::begin(lowRecognizers_), std::end(lowRecognizers_), [](const WeakPtr<GestureRecognizer>& member) {
-            return member.Upgrade() && member.Upgrade()->GetRefereeState() == RefereeState::PENDING;
-        });
-    if (pendingMember != lowRecognizers_.end()) {
-        return true;
+    auto scope = FindScope(touchId);
+    if (scope) {
+        return scope;
     }
+    if (scopePool_.empty()) {
+        gestureScopes_.emplace_back(std::make_unique<GestureScope>(touchId));
+    } else {
+        gestureScopes_.emplace_back(std::move(scopePool_.back()));
+        scopePool_.pop_back();
+        gestureScopes_.back()->Reset(touchId);
+    }
+    return gestureScopes_.back().get();
+}
 
-    pendingMember = std::find_if(
-        std::begin(highRecognizers_), std::end(highRecognizers_), [](const WeakPtr<GestureRecognizer>& member) {
-            return member.Upgrade() && member.Upgrade()->GetRefereeState() == RefereeState::PENDING;
-        });
-    if (pendingMember != highRecognizers_.end()) {
-        return true;
+void GestureReferee::RecycleScope(GestureScope* scope)
+{
+    auto iter = std::find_if(gestureScopes_.begin(), gestureScopes_.end(),
+        [scope](const std::unique_ptr<GestureScope>& item) { return item.get() == scope; });
+    if (iter == gestureScopes_.end()) {
+        return;
+    }
+    if (scope->IsDisposing()) {
+        scope->SetRecyclePending();
+        return;
+    }
+    auto recycled = std::move(*iter);
+    gestureScopes_.erase(iter);
+    if (scopePool_.size() < MAX_POOLED_SCOPES) {
+        recycled->Reset(0);
+        scopePool_.emplace_back(std::move(recycled));
     }
+}
 
-    pendingMember = std::find_if(
-        std::begin(parallelRecognizers_), std::end(parallelRecognizers_), [](const WeakPtr<GestureRecognizer>& member) {
-            return member.Upgrade() && member.Upgrade()->GetRefereeState() == RefereeState::PENDING;
-        });
-    return pendingMember != parallelRecognizers_.end();
+void GestureReferee::FinishDisposal(GestureScope* scope, bool recycleIfEmpty)
+{
+    scope->EndDisposal();
+    if (scope->IsDisposing()) {
+        return;
+    }
+    if (scope->IsRecyclePending() || (recycleIfEmpty && scope->IsEmpty())) {
+        LOGD("clean the gesture referee of %{public}zu", scope->GetTouchId());
+        RecycleScope(scope);
+    }
 }
 
 void GestureReferee::AddGestureRecognizer(size_t touchId, const RefPtr<GestureRecognizer>& recognizer)
@@ -361,14 +410,7 @@ void GestureReferee::AddGestureRecognizer(size_t touchId, const RefPtr<GestureRe
         return;
     }
     LOGD("add gesture recognizer %{public}s into scope %{public}zu,", AceType::TypeName(recognizer), touchId);
-    const auto iter = gestureScopes_.find(touchId);
-    if (iter != gestureScopes_.end()) {
-        iter->second.AddMember(recognizer);
-    } else {
-        GestureScope gestureScope(touchId);
-        gestureScope.AddMember(recognizer);
-        gestureScopes_.try_emplace(touchId, std::move(gestureScope));
-    }
+    AcquireScope(touchId)->AddMember(recognizer);
 }
 
 void GestureReferee::DelGestureRecognizer(size_t touchId, const RefPtr<GestureRecognizer>& recognizer)
@@ -378,27 +420,32 @@ void GestureReferee::DelGestureRecognizer(size_t touchId, const RefPtr<GestureRe
         return;
     }
     LOGD("delete gesture recognizer %{public}s from scope %{public}zu ", AceType::TypeName(recognizer), touchId);
-    const auto iter = gestureScopes_.find(touchId);
-    if (iter == gestureScopes_.end()) {
+    auto scope = FindScope(touchId);
+    if (!scope) {
         return;
     }
 
-    iter->second.DelMember(recognizer);
+    // Deleting a member may unblock and accept another one.
+    scope->BeginDisposal();
+    scope->DelMember(recognizer);
+    FinishDisposal(scope, false);
 }
 
 void GestureReferee::CleanGestureScope(size_t touchId)
 {
-    const auto iter = gestureScopes_.find(touchId);
-    if (iter != gestureScopes_.end()) {
-        if (iter->second.IsPending()) {
+    auto scope = FindScope(touchId);
+    if (scope) {
+        if (scope->IsPending()) {
             LOGE("gesture scope of touch id %{public}zu is pending, do not clean this.", touchId);
             return;
         }
 
-        if (!iter->second.IsEmpty()) {
-            iter->second.ForceClose();
+        if (!scope->IsEmpty()) {
+            scope->BeginDisposal();
+            scope->ForceClose();
+            scope->EndDisposal();
         }
-        gestureScopes_.erase(iter);
+        RecycleScope(scope);
     }
 }
 
@@ -409,13 +456,11 @@ void GestureReferee::Adjudicate(size_t touchId, const RefPtr<GestureRecognizer>&
         return;
     }
 
-    const auto iter = gestureScopes_.find(touchId);
-    if (iter != gestureScopes_.end()) {
-        iter->second.HandleGestureDisposal(recognizer, disposal);
-        if (iter->second.IsEmpty()) {
-            LOGD("clean the gesture referee of %{public}zu", touchId);
-            gestureScopes_.erase(iter);
-        }
+    auto scope = FindScope(touchId);
+    if (scope) {
+        scope->BeginDisposal();
+        scope->HandleGestureDisposal(recognizer, disposal);
+        FinishDisposal(scope, true);
     } else {
         LOGE("fail to find the gesture scope for %{public}zu session id", touchId);
     }
@@ -16,11 +16,14 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_GESTURE_REFEREE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_GESTURE_REFEREE_H
 
-#include <list>
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
 
 #include "base/memory/ace_type.h"
 #include "base/utils/singleton.h"
+#include "core/gestures/gesture_info.h"
 
 namespace OHOS::Ace {
 
@@ -32,6 +35,8 @@ enum class GestureDisposal {
     PENDING,
 };
 
+// Members are kept in flat buckets indexed by priority. Scopes are recycled by the referee, so the buckets keep
+// their capacity across touch sequences.
 class GestureScope {
 public:
     explicit GestureScope(size_t touchId) : touchId_(touchId) {}
@@ -48,17 +53,64 @@ public:
 
     bool IsEmpty() const
     {
-        return highRecognizers_.empty() && lowRecognizers_.empty() && parallelRecognizers_.empty();
+        return std::all_of(members_.begin(), members_.end(), [](const Members& members) { return members.empty(); });
     }
 
     bool IsPending() const;
 
+    size_t GetTouchId() const
+    {
+        return touchId_;
+    }
+
+    // Rebinds a recycled scope to a new touch sequence.
+    void Reset(size_t touchId);
+
+    // Members are notified during a disposal and may clean the scope re-entrantly, so the scope is only recycled
+    // after the outermost disposal of it returns.
+    void BeginDisposal()
+    {
+        ++disposalDepth_;
+    }
+
+    void EndDisposal()
+    {
+        if (disposalDepth_ > 0) {
+            --disposalDepth_;
+        }
+    }
+
+    bool IsDisposing() const
+    {
+        return disposalDepth_ > 0;
+    }
+
+    void SetRecyclePending()
+    {
+        recyclePending_ = true;
+    }
+
+    bool IsRecyclePending() const
+    {
+        return recyclePending_;
+    }
+
 private:
+    using Members = std::vector<WeakPtr<GestureRecognizer>>;
+
+    static size_t GetBucketIndex(GesturePriority priority);
+
     bool Existed(const RefPtr<GestureRecognizer>& recognizer);
-    const std::list<WeakPtr<GestureRecognizer>>& GetMembersByRecognizer(const RefPtr<GestureRecognizer>& recognizer);
+    Members& GetMembersByRecognizer(const RefPtr<GestureRecognizer>& recognizer);
+    Members& GetMembers(GesturePriority priority)
+    {
+        return members_[GetBucketIndex(priority)];
+    }
+    static void RemoveMember(Members& members, const RefPtr<GestureRecognizer>& recognizer);
     bool CheckNeedBlocked(const RefPtr<GestureRecognizer>& recognizer);
     void AcceptGesture(const RefPtr<GestureRecognizer>& recognizer);
-    void UnBlockGesture(std::list<WeakPtr<GestureRecognizer>>& members);
+    void RejectMembers(Members& members, const RefPtr<GestureRecognizer>& acceptedRecognizer);
+    void UnBlockGesture(Members& members);
     void HandleParallelDisposal(const RefPtr<GestureRecognizer>& recognizer, GestureDisposal disposal);
     void HandleAcceptDisposal(const RefPtr<GestureRecognizer>& recognizer);
     void HandlePendingDisposal(const RefPtr<GestureRecognizer>& recognizer);
@@ -66,10 +118,11 @@ private:
     void RemoveAndUnBlockGesture(bool isPrevPending, const WeakPtr<GestureRecognizer>& recognizer);
 
     size_t touchId_ = 0;
+    int32_t disposalDepth_ = 0;
+    bool recyclePending_ = false;
 
-    std::list<WeakPtr<GestureRecognizer>> highRecognizers_;
-    std::list<WeakPtr<GestureRecognizer>> lowRecognizers_;
-    std::list<WeakPtr<GestureRecognizer>> parallelRecognizers_;
+    // Indexed by GesturePriority: Low, High, Parallel.
+    std::array<Members, static_cast<size_t>(GesturePriority::End)> members_;
 };
 
 class GestureReferee : public Singleton<GestureReferee> {
@@ -90,8 +143,15 @@ public:
     void Adjudicate(size_t touchId, const RefPtr<GestureRecognizer>& recognizer, GestureDisposal disposal);
 
 private:
-    // Stores gesture recognizer collection according to Id.
-    std::unordered_map<size_t, GestureScope> gestureScopes_;
+    GestureScope* FindScope(size_t touchId) const;
+    GestureScope* AcquireScope(size_t touchId);
+    void RecycleScope(GestureScope* scope);
+    void FinishDisposal(GestureScope* scope, bool recycleIfEmpty);
+
+    // Active scopes, one per touch id. There are only a few fingers down at a time, so a linear search is enough.
+    std::vector<std::unique_ptr<GestureScope>> gestureScopes_;
+    // Recycled scopes to avoid creating a scope on each touch down.
+    std::vector<std::unique_ptr<GestureScope>> scopePool_;
 };
 
 } // namespace OHOS::Ace
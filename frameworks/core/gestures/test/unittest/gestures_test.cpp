@@ -17,6 +17,7 @@
 
 #include "mock/gesture_mock.h"
 
+#include "base/utils/time_util.h"
 #include "core/common/platform_window.h"
 #include "core/common/window.h"
 #include "core/gestures/click_recognizer.h"
@@ -47,6 +48,18 @@ constexpr double LOCATION_Y2 = 600.0;
 constexpr double LOCATION_STATIC = 0.0;
 constexpr int32_t TIME_MILLISECOND = 1000;
 constexpr int32_t TIME_COUNTS = 500;
+constexpr int32_t ARENA_MEMBER_COUNT = 200;
+constexpr int32_t ARENA_HIGH_PRIORITY_STEP = 10;
+constexpr int32_t ARENA_ROUND_COUNT = 1000;
+
+// Recorded vertical fling at 120Hz, (milliseconds, y). The finger decelerates from 3000 to 2250 px/s.
+const std::vector<std::pair<int32_t, float>> FLING_TRACE = { { 0, 399.9f }, { 8, 423.6f }, { 16, 447.1f },
+    { 25, 472.4f }, { 33, 494.9f }, { 41, 516.6f }, { 50, 540.4f }, { 58, 561.4f }, { 66, 581.4f }, { 75, 603.9f },
+    { 83, 622.9f }, { 91, 641.7f }, { 100, 662.5f } };
+constexpr double FLING_END_VELOCITY = 2250.0;
+constexpr double FLING_VELOCITY_TOLERANCE = 50.0;
+constexpr double FLING_MIN_CONFIDENCE = 0.9;
+constexpr int32_t FLING_ROUND_INTERVAL = 1000;
 
 constexpr double MAX_THRESHOLD = 20.0;
 constexpr double MIN_PAN_DISTANCE = 15.0;
@@ -148,6 +161,45 @@ private:
     std::string gestureName_;
 };
 
+// Deletes itself from the referee once it is adjudicated, and cleans the scope after it is accepted, as recognizers
+// finishing their touch sequence do.
+class SelfRemovingRecognizer : public GestureRecognizer {
+    DECLARE_ACE_TYPE(SelfRemovingRecognizer, GestureRecognizer);
+
+public:
+    void OnAccepted(size_t touchId) override
+    {
+        ++acceptedCount_;
+        GestureReferee::GetInstance().DelGestureRecognizer(touchId, AceType::Claim(this));
+        GestureReferee::GetInstance().CleanGestureScope(touchId);
+    }
+
+    void OnRejected(size_t touchId) override
+    {
+        ++rejectedCount_;
+        GestureReferee::GetInstance().DelGestureRecognizer(touchId, AceType::Claim(this));
+    }
+
+    void HandleTouchDownEvent(const TouchEvent& event) override {}
+    void HandleTouchUpEvent(const TouchEvent& event) override {}
+    void HandleTouchMoveEvent(const TouchEvent& event) override {}
+    void HandleTouchCancelEvent(const TouchEvent& event) override {}
+
+    int32_t GetAcceptedCount() const
+    {
+        return acceptedCount_;
+    }
+
+    int32_t GetRejectedCount() const
+    {
+        return rejectedCount_;
+    }
+
+private:
+    int32_t acceptedCount_ = 0;
+    int32_t rejectedCount_ = 0;
+};
+
 class DragEventResult {
 public:
     DragEventResult() : dragStartInfo_(0), dragUpdateInfo_(0), dragEndInfo_(0) {}
@@ -639,6 +691,47 @@ HWTEST_F(GesturesTest, VelocityTracker003, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: VelocityTracker004
+ * @tc.desc: Replay a recorded fling trace, verify the estimated velocity and benchmark the estimation.
+ * @tc.type: PERF
+ */
+HWTEST_F(GesturesTest, VelocityTracker004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. replay the recorded trace into a vertical velocity tracker.
+     * @tc.expected: step1. the velocity matches the slope of the trace at the last sample with high confidence.
+     */
+    VelocityTracker velTracker(Axis::VERTICAL);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    auto replay = [&velTracker, startTime](int32_t round) {
+        velTracker.Reset();
+        for (const auto& point : FLING_TRACE) {
+            TouchEvent event { .x = LOCATION_X,
+                .y = point.second,
+                .type = TouchType::MOVE,
+                .time = startTime + std::chrono::milliseconds(point.first + round * FLING_ROUND_INTERVAL) };
+            velTracker.UpdateTouchPoint(event);
+        }
+        return velTracker.GetMainAxisVelocity();
+    };
+    auto velocity = replay(0);
+    ASSERT_NEAR(velocity, FLING_END_VELOCITY, FLING_VELOCITY_TOLERANCE);
+    ASSERT_GT(velTracker.GetConfidence(Axis::VERTICAL), FLING_MIN_CONFIDENCE);
+
+    /**
+     * @tc.steps: step2. replay the trace repeatedly.
+     * @tc.expected: step2. every round gives the same velocity.
+     */
+    int64_t beginTime = GetMicroTickCount();
+    for (int32_t round = 1; round <= TIME_COUNTS; ++round) {
+        ASSERT_NEAR(replay(round), velocity, FLING_VELOCITY_TOLERANCE);
+    }
+    int64_t costTime = GetMicroTickCount() - beginTime;
+    GTEST_LOG_(INFO) << "VelocityTracker004 " << static_cast<double>(costTime) / TIME_COUNTS
+                     << " us per trace of " << FLING_TRACE.size() << " samples";
+}
+
 /**
  * @tc.name: LongPressRecognizer001
  * @tc.desc: Verify the long press recognizer recognizes corresponding long press event.
@@ -1029,6 +1122,91 @@ HWTEST_F(GesturesTest, GestureReferee002, TestSize.Level1)
     ASSERT_TRUE(refereeResult.GetGestureName().empty());
 }
 
+/**
+ * @tc.name: GestureReferee003
+ * @tc.desc: Benchmark the gesture arena with many recognizers per touch down, as nested scroll containers with
+ *           many tappable items do.
+ * @tc.type: PERF
+ */
+HWTEST_F(GesturesTest, GestureReferee003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create low and high priority click recognizers.
+     */
+    std::vector<RefPtr<ClickRecognizer>> recognizers;
+    for (int32_t i = 0; i < ARENA_MEMBER_COUNT; ++i) {
+        auto recognizer = AceType::MakeRefPtr<ClickRecognizer>();
+        recognizer->SetPriority(i % ARENA_HIGH_PRIORITY_STEP == 0 ? GesturePriority::High : GesturePriority::Low);
+        recognizers.emplace_back(recognizer);
+    }
+    const auto& winner = recognizers.front();
+
+    /**
+     * @tc.steps: step2. build the arena on each touch down, reject all members but the first one and accept it.
+     * @tc.expected: step2. the first recognizer wins in every round.
+     */
+    size_t touchId = 0;
+    int64_t startTime = GetMicroTickCount();
+    for (int32_t round = 0; round < ARENA_ROUND_COUNT; ++round) {
+        ++touchId;
+        for (const auto& recognizer : recognizers) {
+            GestureReferee::GetInstance().AddGestureRecognizer(touchId, recognizer);
+        }
+        for (auto iter = recognizers.rbegin(); iter != recognizers.rend() - 1; ++iter) {
+            GestureReferee::GetInstance().Adjudicate(touchId, *iter, GestureDisposal::REJECT);
+        }
+        GestureReferee::GetInstance().Adjudicate(touchId, winner, GestureDisposal::ACCEPT);
+        ASSERT_EQ(winner->GetRefereeState(), RefereeState::SUCCEED);
+    }
+    int64_t costTime = GetMicroTickCount() - startTime;
+    GTEST_LOG_(INFO) << "GestureReferee003 arena of " << ARENA_MEMBER_COUNT << " members, "
+                     << static_cast<double>(costTime) / ARENA_ROUND_COUNT << " us per touch down";
+}
+
+/**
+ * @tc.name: GestureReferee004
+ * @tc.desc: Verify members which delete themselves and clean the scope while they are adjudicated are all notified.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTest, GestureReferee004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. add recognizers which delete themselves when they are adjudicated.
+     */
+    constexpr size_t touchId = 4;
+    constexpr int32_t rejectedMemberCount = 3;
+    std::vector<RefPtr<SelfRemovingRecognizer>> recognizers;
+    for (int32_t i = 0; i <= rejectedMemberCount; ++i) {
+        auto recognizer = AceType::MakeRefPtr<SelfRemovingRecognizer>();
+        GestureReferee::GetInstance().AddGestureRecognizer(touchId, recognizer);
+        recognizers.emplace_back(recognizer);
+    }
+    const auto& winner = recognizers.back();
+
+    /**
+     * @tc.steps: step2. accept the winner.
+     * @tc.expected: step2. every other member is rejected once and the winner is accepted, then cleans the scope.
+     */
+    GestureReferee::GetInstance().Adjudicate(touchId, winner, GestureDisposal::ACCEPT);
+    for (int32_t i = 0; i < rejectedMemberCount; ++i) {
+        EXPECT_EQ(recognizers[i]->GetRejectedCount(), 1);
+        EXPECT_EQ(recognizers[i]->GetRefereeState(), RefereeState::FAIL);
+    }
+    EXPECT_EQ(winner->GetAcceptedCount(), 1);
+    EXPECT_EQ(winner->GetRejectedCount(), 0);
+
+    /**
+     * @tc.steps: step3. add the recognizers for the next touch sequence of the same id.
+     * @tc.expected: step3. the cleaned scope is recycled, and another recognizer wins in the new scope.
+     */
+    for (const auto& recognizer : recognizers) {
+        GestureReferee::GetInstance().AddGestureRecognizer(touchId, recognizer);
+    }
+    GestureReferee::GetInstance().Adjudicate(touchId, recognizers.front(), GestureDisposal::ACCEPT);
+    EXPECT_EQ(recognizers.front()->GetAcceptedCount(), 1);
+    EXPECT_EQ(winner->GetRejectedCount(), 1);
+}
+
 /**
  * @tc.name: DragRecognizer001
  * @tc.desc: verify the drag recognizer corresponding vertical drag event
@@ -15,13 +15,80 @@
 
 #include "core/gestures/velocity_tracker.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+
+#include "base/utils/utils.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// Only samples in the last 100ms describe the motion at the moment the finger lifts.
+constexpr double HORIZON = 0.1;
+// Samples in the last 40ms get full weight, older ones fade to MIN_WEIGHT at the horizon.
+constexpr double RECENT_TIME = 0.04;
+constexpr double MIN_WEIGHT = 0.5;
+constexpr double PIVOT_EPSILON = 1.0e-9;
+constexpr int32_t QUADRATIC_PARAMS = 3;
+constexpr int32_t LINEAR_PARAMS = 2;
+
+double GetWeight(double age)
+{
+    if (age <= RECENT_TIME) {
+        return 1.0;
+    }
+    return 1.0 - (1.0 - MIN_WEIGHT) * (age - RECENT_TIME) / (HORIZON - RECENT_TIME);
+}
+
+// Solves the normal equations matrix * params = vector of size n by gaussian elimination with partial pivoting.
+template<int32_t N>
+bool SolveNormalEquations(double (&matrix)[N][N], double (&vector)[N], double (&params)[N])
+{
+    for (int32_t col = 0; col < N; ++col) {
+        int32_t pivot = col;
+        for (int32_t row = col + 1; row < N; ++row) {
+            if (std::abs(matrix[row][col]) > std::abs(matrix[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(matrix[pivot][col]) < PIVOT_EPSILON) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int32_t k = 0; k < N; ++k) {
+                std::swap(matrix[pivot][k], matrix[col][k]);
+            }
+            std::swap(vector[pivot], vector[col]);
+        }
+        for (int32_t row = col + 1; row < N; ++row) {
+            double factor = matrix[row][col] / matrix[col][col];
+            for (int32_t k = col; k < N; ++k) {
+                matrix[row][k] -= factor * matrix[col][k];
+            }
+            vector[row] -= factor * vector[col];
+        }
+    }
+    for (int32_t row = N - 1; row >= 0; --row) {
+        double sum = vector[row];
+        for (int32_t k = row + 1; k < N; ++k) {
+            sum -= matrix[row][k] * params[k];
+        }
+        params[row] = sum / matrix[row][row];
+    }
+    return true;
+}
+
+} // namespace
 
 void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
 {
     isVelocityDone_ = false;
+    if (!isFirstPoint_ && event.id != currentTrackPoint_.id) {
+        // Another finger takes over, the samples of the previous one do not describe the motion any more.
+        sampleCount_ = 0;
+        lastPosition_ = event.GetOffset();
+    }
     currentTrackPoint_ = event;
     if (isFirstPoint_) {
         firstTrackPoint_ = event;
@@ -40,9 +107,90 @@ void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
     }
     // nanoseconds duration to seconds.
     std::chrono::duration<double> duration = event.time - firstTrackPoint_.time;
-    auto seconds = duration.count();
-    xAxis_.UpdatePoint(seconds, event.x);
-    yAxis_.UpdatePoint(seconds, event.y);
+    AddSample(duration.count(), event.x, event.y);
+}
+
+void VelocityTracker::AddSample(double time, double x, double y)
+{
+    samples_[sampleHead_] = { time, x, y };
+    sampleHead_ = (sampleHead_ + 1) % MAX_SAMPLES;
+    sampleCount_ = std::min(sampleCount_ + 1, MAX_SAMPLES);
+}
+
+const VelocityTracker::Sample& VelocityTracker::GetSample(int32_t reverseIndex) const
+{
+    // reverseIndex 0 is the newest sample.
+    return samples_[(sampleHead_ - 1 - reverseIndex + MAX_SAMPLES) % MAX_SAMPLES];
+}
+
+bool VelocityTracker::EstimateAxis(int32_t count, bool isXAxis, double& velocity, double& confidence) const
+{
+    const auto& newest = GetSample(0);
+    auto position = [isXAxis](const Sample& sample) { return isXAxis ? sample.x : sample.y; };
+    if (count == LINEAR_PARAMS) {
+        const auto& oldest = GetSample(1);
+        auto duration = newest.time - oldest.time;
+        if (duration <= 0.0) {
+            return false;
+        }
+        velocity = (position(newest) - position(oldest)) / duration;
+        confidence = 1.0;
+        return true;
+    }
+
+    // Fit position = a0 + a1 * u + a2 * u^2 with u = (time - newest) / HORIZON in [-1, 0], which keeps the normal
+    // equations well conditioned. The velocity at the newest sample is a1 / HORIZON.
+    double matrix[QUADRATIC_PARAMS][QUADRATIC_PARAMS] = {};
+    double vector[QUADRATIC_PARAMS] = {};
+    double weightSum = 0.0;
+    double weightedPosSum = 0.0;
+    for (int32_t i = 0; i < count; ++i) {
+        const auto& sample = GetSample(i);
+        double age = newest.time - sample.time;
+        double weight = GetWeight(age);
+        double u = -age / HORIZON;
+        double powers[QUADRATIC_PARAMS] = { 1.0, u, u * u };
+        for (int32_t row = 0; row < QUADRATIC_PARAMS; ++row) {
+            for (int32_t col = 0; col < QUADRATIC_PARAMS; ++col) {
+                matrix[row][col] += weight * powers[row] * powers[col];
+            }
+            vector[row] += weight * powers[row] * position(sample);
+        }
+        weightSum += weight;
+        weightedPosSum += weight * position(sample);
+    }
+
+    double params[QUADRATIC_PARAMS] = {};
+    double linearMatrix[LINEAR_PARAMS][LINEAR_PARAMS] = { { matrix[0][0], matrix[0][1] },
+        { matrix[1][0], matrix[1][1] } };
+    double linearVector[LINEAR_PARAMS] = { vector[0], vector[1] };
+    if (!SolveNormalEquations(matrix, vector, params)) {
+        // Samples at too few distinct times for a curve, fall back to a line.
+        double linearParams[LINEAR_PARAMS] = {};
+        if (!SolveNormalEquations(linearMatrix, linearVector, linearParams)) {
+            return false;
+        }
+        params[0] = linearParams[0];
+        params[1] = linearParams[1];
+        params[2] = 0.0;
+    }
+    velocity = params[1] / HORIZON;
+
+    // Weighted coefficient of determination of the fit.
+    double mean = weightedPosSum / weightSum;
+    double totalSquares = 0.0;
+    double residualSquares = 0.0;
+    for (int32_t i = 0; i < count; ++i) {
+        const auto& sample = GetSample(i);
+        double age = newest.time - sample.time;
+        double weight = GetWeight(age);
+        double u = -age / HORIZON;
+        double fitted = params[0] + params[1] * u + params[2] * u * u;
+        totalSquares += weight * (position(sample) - mean) * (position(sample) - mean);
+        residualSquares += weight * (position(sample) - fitted) * (position(sample) - fitted);
+    }
+    confidence = NearZero(totalSquares) ? 1.0 : std::clamp(1.0 - residualSquares / totalSquares, 0.0, 1.0);
+    return true;
 }
 
 void VelocityTracker::UpdateVelocity()
@@ -50,24 +198,36 @@ void VelocityTracker::UpdateVelocity()
     if (isVelocityDone_) {
         return;
     }
-    // the least square method three params curve is 0 * x^3 + a2 * x^2 + a1 * x + a0
-    // the velocity is 2 * a2 * x + a1;
-    static const int32_t linearParam = 2;
-    std::vector<double> xAxis { 3, 0 };
-    auto xValue = xAxis_.GetXVals().back();
+    velocity_.Reset();
+    confidence_.Reset();
+    isVelocityDone_ = true;
+    if (sampleCount_ < LINEAR_PARAMS) {
+        return;
+    }
+
+    const auto& newest = GetSample(0);
+    int32_t count = 1;
+    while (count < sampleCount_ && newest.time - GetSample(count).time <= HORIZON) {
+        ++count;
+    }
+    if (count < LINEAR_PARAMS) {
+        return;
+    }
+
     double xVelocity = 0.0;
-    if (xAxis_.GetLeastSquareParams(xAxis)) {
-        xVelocity = linearParam * xAxis[0] * xValue + xAxis[1];
+    double xConfidence = 0.0;
+    if (!EstimateAxis(count, true, xVelocity, xConfidence)) {
+        xVelocity = 0.0;
+        xConfidence = 0.0;
     }
-    std::vector<double> yAxis { 3, 0 };
-    auto yValue = yAxis_.GetXVals().back();
     double yVelocity = 0.0;
-    if (yAxis_.GetLeastSquareParams(yAxis)) {
-        yVelocity = linearParam * yAxis[0] * yValue + yAxis[1];
+    double yConfidence = 0.0;
+    if (!EstimateAxis(count, false, yVelocity, yConfidence)) {
+        yVelocity = 0.0;
+        yConfidence = 0.0;
     }
-
     velocity_.SetOffsetPerSecond({ xVelocity, yVelocity });
-    isVelocityDone_ = true;
+    confidence_ = Offset(xConfidence, yConfidence);
 }
 
 } // namespace OHOS::Ace
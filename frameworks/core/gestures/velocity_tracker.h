@@ -16,14 +16,18 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_VELOCITY_TRACKER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_GESTURES_VELOCITY_TRACKER_H
 
+#include <algorithm>
+#include <array>
+
 #include "base/geometry/axis.h"
-#include "base/geometry/least_square_impl.h"
 #include "base/geometry/offset.h"
 #include "core/event/touch_event.h"
 #include "core/gestures/velocity.h"
 
 namespace OHOS::Ace {
 
+// Keeps the recent samples of one pointer in a fixed-capacity ring buffer, and estimates the velocity by a weighted
+// least square fit of a quadratic curve on each axis. No allocation happens per sample.
 class VelocityTracker final {
 public:
     VelocityTracker() = default;
@@ -36,8 +40,10 @@ public:
         velocity_.Reset();
         delta_.Reset();
         isFirstPoint_ = true;
-        xAxis_.Reset();
-        yAxis_.Reset();
+        sampleHead_ = 0;
+        sampleCount_ = 0;
+        confidence_.Reset();
+        isVelocityDone_ = false;
     }
 
     void UpdateTouchPoint(const TouchEvent& event, bool end = false);
@@ -96,6 +102,22 @@ public:
         }
     }
 
+    // Goodness of fit of the velocity on the axis, in [0, 1]. Low confidence means the samples are too few or noisy.
+    double GetConfidence(Axis axis)
+    {
+        UpdateVelocity();
+        switch (axis) {
+            case Axis::FREE:
+                return std::min(confidence_.GetX(), confidence_.GetY());
+            case Axis::HORIZONTAL:
+                return confidence_.GetX();
+            case Axis::VERTICAL:
+                return confidence_.GetY();
+            default:
+                return 0.0;
+        }
+    }
+
     double GetMainAxisVelocity()
     {
         UpdateVelocity();
@@ -112,6 +134,19 @@ public:
     }
 
 private:
+    struct Sample {
+        // seconds since the first track point.
+        double time = 0.0;
+        double x = 0.0;
+        double y = 0.0;
+    };
+
+    // Enough for 100ms of samples at 120Hz, with margin for batched events.
+    static constexpr int32_t MAX_SAMPLES = 20;
+
+    void AddSample(double time, double x, double y);
+    const Sample& GetSample(int32_t reverseIndex) const;
+    bool EstimateAxis(int32_t count, bool isXAxis, double& velocity, double& confidence) const;
     void UpdateVelocity();
 
     Axis mainAxis_ { Axis::FREE };
@@ -119,12 +154,14 @@ private:
     TouchEvent currentTrackPoint_;
     Offset lastPosition_;
     Velocity velocity_;
+    Offset confidence_;
     Offset delta_;
     Offset offset_;
     bool isFirstPoint_ = true;
     TimeStamp lastTimePoint_;
-    LeastSquareImpl xAxis_ { 3, 5 };
-    LeastSquareImpl yAxis_ { 3, 5 };
+    std::array<Sample, MAX_SAMPLES> samples_;
+    int32_t sampleHead_ = 0;
+    int32_t sampleCount_ = 0;
     bool isVelocityDone_ = false;
 };
 
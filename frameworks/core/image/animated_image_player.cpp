@@ -19,19 +19,73 @@
 #include "third_party/skia/include/core/SkPixelRef.h"
 
 #include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
 #include "core/components/image/flutter_render_image.h"
 #include "core/image/image_provider.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// Decoded frames of all animated images share this budget, so that many players on screen can't exhaust memory.
+constexpr size_t FRAME_CACHE_BUDGET = 64 * 1024 * 1024;
+// Frames decoded in background ahead of the playing one.
+constexpr int32_t LOOK_AHEAD_FRAMES = 3;
+
+std::atomic<size_t> g_frameCacheBytes { 0 };
+
+bool AcquireFrameCacheBytes(size_t bytes)
+{
+    size_t used = g_frameCacheBytes.load(std::memory_order_relaxed);
+    do {
+        if (used + bytes > FRAME_CACHE_BUDGET) {
+            return false;
+        }
+    } while (!g_frameCacheBytes.compare_exchange_weak(used, used + bytes, std::memory_order_relaxed));
+    return true;
+}
+
+void ReleaseFrameCacheBytes(size_t bytes)
+{
+    g_frameCacheBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+} // namespace
+
+AnimatedImagePlayer::~AnimatedImagePlayer()
+{
+    ReleaseFrameCacheBytes(cacheBytes_);
+}
 
 void AnimatedImagePlayer::Pause()
 {
-    animator_->Pause();
+    if (animator_) {
+        animator_->Pause();
+    }
+    // Never wait for decoding on the ui thread, frames are released in background.
+    if (paused_.exchange(true)) {
+        return;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [weak = AceType::WeakClaim(this)] {
+            auto player = weak.Upgrade();
+            if (!player) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(player->decodeMutex_);
+            // Give the budget to players on screen, frames others are decoded on are kept to restart quickly.
+            if (player->paused_) {
+                player->ReleaseFrames(true);
+            }
+        },
+        BgTaskPriority::LOW);
 }
 
 void AnimatedImagePlayer::Resume()
 {
-    animator_->Resume();
+    paused_ = false;
+    if (animator_) {
+        animator_->Resume();
+    }
 }
 
 void AnimatedImagePlayer::RenderFrame(const int32_t& index)
@@ -41,6 +95,7 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
         LOGW("Context may be destroyed!");
         return;
     }
+    playIndex_ = index;
     auto taskExecutor = context->GetTaskExecutor();
     taskExecutor->PostTask(
         [weak = AceType::WeakClaim(this), index, dstWidth = dstWidth_, dstHeight = dstHeight_, taskExecutor] {
@@ -50,6 +105,7 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
             }
             auto canvasImage = flutter::CanvasImage::Create();
             sk_sp<SkImage> skImage = player->DecodeFrameImage(index);
+            player->PostLookAheadTask(index);
             if (dstWidth > 0 && dstHeight > 0) {
                 skImage = ImageProvider::ApplySizeToSkImage(skImage, dstWidth, dstHeight);
             }
@@ -67,15 +123,37 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
 }
 
 sk_sp<SkImage> AnimatedImagePlayer::DecodeFrameImage(const int32_t& index)
+{
+    SkBitmap bitmap;
+    {
+        std::lock_guard<std::mutex> lock(decodeMutex_);
+        if (!DecodeFrameBitmap(index, bitmap)) {
+            return nullptr;
+        }
+    }
+#ifndef GPU_DISABLED
+    // weak reference of io manager must be check and used on io thread, because io manager is created on io thread.
+    if (ioManager_) {
+        auto resourceContext = ioManager_->GetResourceContext();
+        if (resourceContext) {
+            SkPixmap pixmap(bitmap.info(), bitmap.pixelRef()->pixels(), bitmap.pixelRef()->rowBytes());
+            return SkImage::MakeCrossContextFromPixmap(resourceContext.get(), pixmap, true, pixmap.colorSpace());
+        }
+    }
+#endif
+    return SkImage::MakeFromBitmap(bitmap);
+}
+
+bool AnimatedImagePlayer::DecodeFrameBitmap(int32_t index, SkBitmap& bitmap)
 {
     // first seek in cache
-    auto iterator = cachedFrame_.find(index);
-    if (iterator != cachedFrame_.end() && iterator->second != nullptr) {
+    auto iterator = frameCache_.find(index);
+    if (iterator != frameCache_.end()) {
         LOGD("index %{private}d found in cache.", index);
-        return SkImage::MakeFromBitmap(*iterator->second);
+        bitmap = iterator->second;
+        return true;
     }
 
-    SkBitmap bitmap;
     SkImageInfo info = codec_->getInfo().makeColorType(kN32_SkColorType);
     bitmap.allocPixels(info);
     SkCodec::Options options;
@@ -87,9 +165,8 @@ sk_sp<SkImage> AnimatedImagePlayer::DecodeFrameImage(const int32_t& index)
             options.fPriorFrame = requiredFrame;
         } else if (requiredFrame != lastRequiredFrameIndex_) {
             // find requiredFrame in cached frame.
-            auto iter = cachedFrame_.find(requiredFrame);
-            if (iter != cachedFrame_.end() && iter->second != nullptr &&
-                CopyTo(&bitmap, iter->second->colorType(), *iter->second)) {
+            auto iter = frameCache_.find(requiredFrame);
+            if (iter != frameCache_.end() && CopyTo(&bitmap, iter->second.colorType(), iter->second)) {
                 options.fPriorFrame = requiredFrame;
             }
         }
@@ -97,29 +174,118 @@ sk_sp<SkImage> AnimatedImagePlayer::DecodeFrameImage(const int32_t& index)
 
     if (SkCodec::kSuccess != codec_->getPixels(info, bitmap.getPixels(), bitmap.rowBytes(), &options)) {
         LOGW("Could not getPixels for frame %{public}d:", index);
-        return nullptr;
+        return false;
     }
+    // pixels are shared by cache and images, never write them after decoding.
+    bitmap.setImmutable();
 
     if (frameInfos_[index].fDisposalMethod != SkCodecAnimation::DisposalMethod::kRestorePrevious) {
         lastRequiredBitmap_ = std::make_unique<SkBitmap>(bitmap);
         lastRequiredFrameIndex_ = index;
     }
+    // Frames still being decoded when the player pauses are not kept, as if they were released.
+    if (!paused_ || requiredFrames_.count(index) > 0) {
+        CacheFrame(index, bitmap);
+    }
+    return true;
+}
 
-    if (iterator != cachedFrame_.end() && iterator->second == nullptr) {
-        LOGD("index %{private}d cached.", index);
-        iterator->second = std::make_unique<SkBitmap>(bitmap);
+bool AnimatedImagePlayer::CacheFrame(int32_t index, const SkBitmap& bitmap)
+{
+    size_t bytes = bitmap.computeByteSize();
+    while (!AcquireFrameCacheBytes(bytes)) {
+        if (!EvictFrameFor(index)) {
+            return false;
+        }
     }
-#ifndef GPU_DISABLED
-    // weak reference of io manager must be check and used on io thread, because io manager is created on io thread.
-    if (ioManager_) {
-        auto resourceContext = ioManager_->GetResourceContext();
-        if (resourceContext) {
-            SkPixmap pixmap(bitmap.info(), bitmap.pixelRef()->pixels(), bitmap.pixelRef()->rowBytes());
-            return SkImage::MakeCrossContextFromPixmap(resourceContext.get(), pixmap, true, pixmap.colorSpace());
+    LOGD("index %{private}d cached.", index);
+    frameCache_[index] = bitmap;
+    cacheBytes_ += bytes;
+    return true;
+}
+
+int32_t AnimatedImagePlayer::GetFramePriority(int32_t index) const
+{
+    // Frames played sooner are more valuable, frames others are decoded on are more valuable than all the others.
+    int32_t distance = (index - playIndex_.load(std::memory_order_relaxed) + frameCount_) % frameCount_;
+    int32_t priority = frameCount_ - distance;
+    return requiredFrames_.count(index) > 0 ? priority + frameCount_ : priority;
+}
+
+bool AnimatedImagePlayer::EvictFrameFor(int32_t index)
+{
+    if (frameCache_.empty()) {
+        return false;
+    }
+    auto victim = frameCache_.begin();
+    int32_t victimPriority = GetFramePriority(victim->first);
+    for (auto iter = std::next(frameCache_.begin()); iter != frameCache_.end(); ++iter) {
+        int32_t priority = GetFramePriority(iter->first);
+        if (priority < victimPriority) {
+            victim = iter;
+            victimPriority = priority;
+        }
+    }
+    if (victimPriority >= GetFramePriority(index)) {
+        return false;
+    }
+    size_t bytes = victim->second.computeByteSize();
+    ReleaseFrameCacheBytes(bytes);
+    cacheBytes_ -= bytes;
+    frameCache_.erase(victim);
+    return true;
+}
+
+void AnimatedImagePlayer::ReleaseFrames(bool keepRequired)
+{
+    for (auto iter = frameCache_.begin(); iter != frameCache_.end();) {
+        if (keepRequired && requiredFrames_.count(iter->first) > 0) {
+            ++iter;
+            continue;
+        }
+        size_t bytes = iter->second.computeByteSize();
+        ReleaseFrameCacheBytes(bytes);
+        cacheBytes_ -= bytes;
+        iter = frameCache_.erase(iter);
+    }
+}
+
+void AnimatedImagePlayer::PostLookAheadTask(int32_t index)
+{
+    if (frameCount_ <= 1 || lookAheadPosted_.exchange(true)) {
+        return;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask(
+        [weak = AceType::WeakClaim(this), index] {
+            auto player = weak.Upgrade();
+            if (!player) {
+                return;
+            }
+            player->LookAhead(index);
+            player->lookAheadPosted_ = false;
+        },
+        BgTaskPriority::LOW);
+}
+
+void AnimatedImagePlayer::LookAhead(int32_t index)
+{
+    for (int32_t step = 1; step <= LOOK_AHEAD_FRAMES; ++step) {
+        int32_t next = (index + step) % frameCount_;
+        // Decode frame by frame, so that the io thread is never blocked for long.
+        std::lock_guard<std::mutex> lock(decodeMutex_);
+        if (paused_) {
+            // Frames ahead would be released before they are played.
+            return;
+        }
+        if (frameCache_.find(next) != frameCache_.end()) {
+            continue;
+        }
+        SkBitmap bitmap;
+        if (!DecodeFrameBitmap(next, bitmap) || frameCache_.find(next) == frameCache_.end()) {
+            // Out of budget, frames ahead would be dropped anyway.
+            return;
         }
     }
-#endif
-    return SkImage::MakeFromBitmap(bitmap);
 }
 
 bool AnimatedImagePlayer::CopyTo(SkBitmap* dst, SkColorType dstColorType, const SkBitmap& src)
@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_IMAGE_PLAYER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_IMAGE_PLAYER_H
 
-#include <unordered_map>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_set>
 
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/lib/ui/painting/image.h"
@@ -55,7 +58,6 @@ public:
             animator_ = AceType::MakeRefPtr<Animator>(context);
             auto pictureAnimation = AceType::MakeRefPtr<PictureAnimation<int32_t>>();
             float totalFrameDuration = 0.0f;
-            int32_t lastRequiredIndex = -1;
             for (int32_t index = 0; index < frameCount_; index++) {
                 LOGD("frame[%{public}d] duration is %{public}d", index, frameInfos_[index].fDuration);
                 // if frame duration is 0, set this frame duration as 100ms
@@ -66,18 +68,13 @@ public:
 
                 // process required frame index.
                 int32_t requiredIndex = frameInfos_[index].fRequiredFrame;
-                // if requiredIndex is valid
+                // if requiredIndex is valid, other frames are decoded on it, keep it in cache as long as possible.
                 if (requiredIndex >= 0 && requiredIndex < frameCount_) {
                     LOGD("now index: %{private}d require prior frame: %{private}d", index, requiredIndex);
-                    // if require prior frame before last frame, cache it after first loop.
-                    if (requiredIndex < lastRequiredIndex) {
-                        LOGD("requiredIndex < lastRequiredIndex, lastRequiredIndex: %{private}d ", lastRequiredIndex);
-                        cachedFrame_.emplace(requiredIndex, nullptr);
-                    }
-                    lastRequiredIndex = requiredIndex;
+                    requiredFrames_.emplace(requiredIndex);
                 }
             }
-            LOGD("frame cached size: %{private}d", static_cast<int32_t>(cachedFrame_.size()));
+            LOGD("required frame size: %{private}d", static_cast<int32_t>(requiredFrames_.size()));
             LOGD("animatied image total duration: %{public}f", totalFrameDuration);
             for (int32_t index = 0; index < frameCount_; index++) {
                 pictureAnimation->AddPicture(
@@ -98,7 +95,7 @@ public:
         }
     }
 
-    ~AnimatedImagePlayer() override = default;
+    ~AnimatedImagePlayer() override;
 
     void Pause();
     void Resume();
@@ -112,6 +109,13 @@ public:
 
 private:
     sk_sp<SkImage> DecodeFrameImage(const int32_t& index);
+    bool DecodeFrameBitmap(int32_t index, SkBitmap& bitmap);
+    bool CacheFrame(int32_t index, const SkBitmap& bitmap);
+    bool EvictFrameFor(int32_t index);
+    int32_t GetFramePriority(int32_t index) const;
+    void ReleaseFrames(bool keepRequired);
+    void PostLookAheadTask(int32_t index);
+    void LookAhead(int32_t index);
     static bool CopyTo(SkBitmap* dst, SkColorType dstColorType, const SkBitmap& src);
 
     ImageSourceInfo imageSource_;
@@ -131,8 +135,18 @@ private:
     int32_t dstWidth_ = -1;
     int32_t dstHeight_ = -1;
 
-    // used to cache required frame.
-    std::unordered_map<int32_t, std::unique_ptr<SkBitmap>> cachedFrame_;
+    // frames which other frames are decoded on.
+    std::unordered_set<int32_t> requiredFrames_;
+
+    // guards codec and frame cache, which are used on io thread and in look-ahead tasks.
+    std::mutex decodeMutex_;
+    // decoded frames, their bytes are counted in the budget shared by all players.
+    std::map<int32_t, SkBitmap> frameCache_;
+    size_t cacheBytes_ = 0;
+    std::atomic<int32_t> playIndex_ { 0 };
+    std::atomic<bool> lookAheadPosted_ { false };
+    // set on ui thread, frames are released where decoding happens.
+    std::atomic<bool> paused_ { false };
 
     // used to cache last required frame. this will be reset during looping.
     std::unique_ptr<SkBitmap> lastRequiredBitmap_;
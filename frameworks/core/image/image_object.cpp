@@ -44,6 +44,9 @@ RefPtr<ImageObject> ImageObject::BuildImageObject(
         auto color = source.GetFillColor();
         if (!useSkiaSvg) {
             auto svgDom = SvgDom::CreateSvgDom(*svgStream, context, color);
+            if (svgDom) {
+                svgDom->SetSource(source.GetSrc());
+            }
             return svgDom ? MakeRefPtr<SvgImageObject>(source, Size(), 1, svgDom) : nullptr;
         } else {
             uint64_t colorValue = 0;
@@ -152,7 +155,7 @@ void StaticImageObject::UploadToGpuForRender(
                 return;
             }
         }
-        auto rawImage = SkImage::MakeFromEncoded(skData);
+        auto rawImage = ImageProvider::DecodeAtTargetSize(skData, imageSource.GetSrc(), imageSize);
         if (!rawImage) {
             LOGE("static image MakeFromEncoded fail! imageSource: %{private}s", imageSource.ToString().c_str());
             taskExecutor->PostTask(
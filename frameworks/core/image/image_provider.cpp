@@ -15,7 +15,12 @@
 
 #include "core/image/image_provider.h"
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
 #include "experimental/svg/model/SkSVGDOM.h"
+#include "third_party/skia/include/codec/SkAndroidCodec.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/skia/include/core/SkStream.h"
 
@@ -33,9 +38,173 @@ namespace {
 constexpr double RESIZE_MAX_PROPORTION = 0.5 * 0.5; // Cache image when resize exceeds 25%
 // If a picture is a wide color gamut picture, its area value will be larger than this threshold.
 constexpr double SRGB_GAMUT_AREA = 0.104149;
+// Jpeg decoders scale natively by 1/2, 1/4 and 1/8, larger sample sizes are done by sampling rows.
+constexpr int32_t MAX_SAMPLE_SIZE = 32;
 
 } // namespace
 
+std::mutex ImageProvider::pendingFetchMutex_;
+std::unordered_map<std::string, ImageProvider::PendingFetch> ImageProvider::pendingFetches_;
+uint64_t ImageProvider::nextFetchId_ = 0;
+
+std::string ImageProvider::MakeFetchKey(const ImageSourceInfo& imageInfo, bool useSkiaSvg, bool needAutoResize)
+{
+    // Source info string contains the source size, which is also the target size of decoding. Svg images are parsed
+    // with their fill color, so it is part of the key too.
+    auto fillColor = imageInfo.GetFillColor();
+    return std::to_string(Container::CurrentId()) + ":" + imageInfo.ToString() +
+           (fillColor ? ":fill" + std::to_string(fillColor->GetValue()) : "") + (useSkiaSvg ? ":svg" : "") +
+           (needAutoResize ? ":resize" : "");
+}
+
+std::optional<BgTaskPriority> ImageProvider::JoinPendingFetch(
+    const std::string& key, FetchWaiter&& waiter, uint64_t& fetchId)
+{
+    std::lock_guard<std::mutex> lock(pendingFetchMutex_);
+    auto& fetch = pendingFetches_[key];
+    if (fetch.id == 0) {
+        fetch.id = ++nextFetchId_;
+    }
+    fetchId = fetch.id;
+    std::optional<BgTaskPriority> priority;
+    if (!fetch.started) {
+        if (waiter.isVisible && !fetch.urgent) {
+            // A visible node waits for a prefetch, post it again with default priority, the first run wins.
+            fetch.urgent = true;
+            priority = BgTaskPriority::DEFAULT;
+        } else if (!waiter.isVisible && !fetch.urgent && !fetch.deferred) {
+            fetch.deferred = true;
+            priority = BgTaskPriority::LOW;
+        }
+    }
+    fetch.waiters.emplace_back(std::move(waiter));
+    return priority;
+}
+
+bool ImageProvider::StartPendingFetch(
+    const std::string& key, uint64_t fetchId, BgTaskPriority priority, bool& needDefer)
+{
+    std::lock_guard<std::mutex> lock(pendingFetchMutex_);
+    auto iter = pendingFetches_.find(key);
+    // The fetch may have been run by the task posted with another priority.
+    if (iter == pendingFetches_.end() || iter->second.id != fetchId || iter->second.started) {
+        return false;
+    }
+    auto& fetch = iter->second;
+    bool hasVisibleWaiter = false;
+    bool hasWaiter = false;
+    for (const auto& waiter : fetch.waiters) {
+        if (!waiter.delivery.IsCanceled()) {
+            hasWaiter = true;
+            hasVisibleWaiter = hasVisibleWaiter || waiter.isVisible;
+        }
+    }
+    if (!hasWaiter) {
+        LOGD("all requesters of image have gone, skip fetching.");
+        pendingFetches_.erase(iter);
+        return false;
+    }
+    if (priority == BgTaskPriority::DEFAULT) {
+        fetch.urgent = false;
+        if (!hasVisibleWaiter) {
+            // Visible requesters have scrolled out and canceled, leave the fetch to a task of low priority.
+            needDefer = !fetch.deferred;
+            fetch.deferred = true;
+            return false;
+        }
+    } else {
+        fetch.deferred = false;
+    }
+    fetch.started = true;
+    return true;
+}
+
+std::vector<ImageProvider::FetchWaiter> ImageProvider::FinishPendingFetch(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(pendingFetchMutex_);
+    std::vector<FetchWaiter> waiters;
+    auto iter = pendingFetches_.find(key);
+    if (iter != pendingFetches_.end()) {
+        waiters = std::move(iter->second.waiters);
+        pendingFetches_.erase(iter);
+    }
+    return waiters;
+}
+
+void ImageProvider::PostPendingFetch(const std::string& key, uint64_t fetchId, BgTaskPriority priority,
+    const ImageSourceInfo& imageInfo, const WeakPtr<PipelineContext>& context, bool useSkiaSvg, bool needAutoResize,
+    const RefPtr<FlutterRenderTaskHolder>& renderTaskHolder)
+{
+    auto task = [key, fetchId, priority, imageInfo, context, useSkiaSvg, needAutoResize, renderTaskHolder,
+                    id = Container::CurrentId()]() {
+        ContainerScope scope(id);
+        RunPendingFetch(key, fetchId, priority, imageInfo, context, useSkiaSvg, needAutoResize, renderTaskHolder);
+    };
+    BackgroundTaskExecutor::GetInstance().PostTask(std::move(task), priority);
+}
+
+void ImageProvider::RunPendingFetch(const std::string& key, uint64_t fetchId, BgTaskPriority priority,
+    const ImageSourceInfo& imageInfo, const WeakPtr<PipelineContext>& context, bool useSkiaSvg, bool needAutoResize,
+    const RefPtr<FlutterRenderTaskHolder>& renderTaskHolder)
+{
+    bool needDefer = false;
+    if (!StartPendingFetch(key, fetchId, priority, needDefer)) {
+        if (needDefer) {
+            PostPendingFetch(key, fetchId, BgTaskPriority::LOW, imageInfo, context, useSkiaSvg, needAutoResize,
+                renderTaskHolder);
+        }
+        return;
+    }
+    RefPtr<ImageObject> imageObj;
+    auto pipelineContext = context.Upgrade();
+    if (pipelineContext) {
+        imageObj = QueryImageObjectFromCache(imageInfo, pipelineContext);
+        if (!imageObj) { // if image object is not in cache, generate a new one.
+            imageObj = GeneraterAceImageObject(imageInfo, pipelineContext, useSkiaSvg);
+        }
+    } else {
+        LOGE("pipline context has been released. imageInfo: %{private}s", imageInfo.ToString().c_str());
+    }
+    // Requests coming after this point start a new fetch, which hits the image cache.
+    auto waiters = FinishPendingFetch(key);
+    if (!pipelineContext) {
+        return;
+    }
+    for (const auto& waiter : waiters) {
+        waiter.result->imageObj = imageObj;
+        waiter.delivery();
+    }
+    if (!imageObj || needAutoResize || imageObj->GetFrameCount() != 1) {
+        return;
+    }
+    // Upload once for all requesters which have not canceled.
+    std::vector<UploadSuccessCallback> uploadSuccessCallbacks;
+    std::vector<FailedCallback> failedCallbacks;
+    for (const auto& waiter : waiters) {
+        if (!waiter.delivery.IsCanceled()) {
+            uploadSuccessCallbacks.emplace_back(waiter.uploadSuccessCallback);
+            failedCallbacks.emplace_back(waiter.failedCallback);
+        }
+    }
+    if (uploadSuccessCallbacks.empty()) {
+        return;
+    }
+    auto uploadSuccessCallback = [uploadSuccessCallbacks](
+                                     ImageSourceInfo info, const fml::RefPtr<flutter::CanvasImage>& image) {
+        for (const auto& callback : uploadSuccessCallbacks) {
+            callback(info, image);
+        }
+    };
+    auto failedCallback = [failedCallbacks](ImageSourceInfo info) {
+        for (const auto& callback : failedCallbacks) {
+            callback(info);
+        }
+    };
+    bool forceResize = (!imageObj->IsSvg()) && (imageInfo.IsSourceDimensionValid());
+    FlutterRenderImage::UploadImageObjToGpuForRender(imageObj, context, renderTaskHolder, uploadSuccessCallback,
+        failedCallback, imageObj->GetImageSize(), forceResize, true);
+}
+
 void ImageProvider::FetchImageObject(
     ImageSourceInfo imageInfo,
     ImageObjSuccessCallback successCallback,
@@ -46,11 +215,51 @@ void ImageProvider::FetchImageObject(
     bool useSkiaSvg,
     bool needAutoResize,
     RefPtr<FlutterRenderTaskHolder>& renderTaskHolder,
-    OnPostBackgroundTask onBackgroundTaskPostCallback)
+    OnPostBackgroundTask onBackgroundTaskPostCallback,
+    bool isVisible)
 {
-    auto task = [context, imageInfo, successCallback, failedCallback, useSkiaSvg, renderTaskHolder,
-                    uploadSuccessCallback, needAutoResize, id = Container::CurrentId(), syncMode]() mutable {
-        ContainerScope scope(id);
+    if (!syncMode) {
+        FetchImageObjectAsync(imageInfo, successCallback, uploadSuccessCallback, failedCallback, context, useSkiaSvg,
+            needAutoResize, renderTaskHolder, onBackgroundTaskPostCallback, isVisible);
+        return;
+    }
+    auto pipelineContext = context.Upgrade();
+    if (!pipelineContext) {
+        LOGE("pipline context has been released. imageInfo: %{private}s", imageInfo.ToString().c_str());
+        return;
+    }
+    RefPtr<ImageObject> imageObj = QueryImageObjectFromCache(imageInfo, pipelineContext);
+    if (!imageObj) { // if image object is not in cache, generate a new one.
+        imageObj = GeneraterAceImageObject(imageInfo, pipelineContext, useSkiaSvg);
+    }
+    if (!imageObj) { // if it fails to generate an image object, trigger fail callback.
+        failedCallback(imageInfo);
+        return;
+    }
+    successCallback(imageInfo, imageObj);
+    bool canStartUploadImageObj = !needAutoResize && (imageObj->GetFrameCount() == 1);
+    if (canStartUploadImageObj) {
+        bool forceResize = (!imageObj->IsSvg()) && (imageInfo.IsSourceDimensionValid());
+        FlutterRenderImage::UploadImageObjToGpuForRender(imageObj, context, renderTaskHolder, uploadSuccessCallback,
+            failedCallback, imageObj->GetImageSize(), forceResize, true);
+    }
+}
+
+void ImageProvider::FetchImageObjectAsync(
+    const ImageSourceInfo& imageInfo,
+    const ImageObjSuccessCallback& successCallback,
+    const UploadSuccessCallback& uploadSuccessCallback,
+    const FailedCallback& failedCallback,
+    const WeakPtr<PipelineContext>& context,
+    bool useSkiaSvg,
+    bool needAutoResize,
+    const RefPtr<FlutterRenderTaskHolder>& renderTaskHolder,
+    const OnPostBackgroundTask& onBackgroundTaskPostCallback,
+    bool isVisible)
+{
+    auto key = MakeFetchKey(imageInfo, useSkiaSvg, needAutoResize);
+    auto result = std::make_shared<FetchResult>();
+    CancelableTask delivery([result, imageInfo, successCallback, failedCallback, context]() {
         auto pipelineContext = context.Upgrade();
         if (!pipelineContext) {
             LOGE("pipline context has been released. imageInfo: %{private}s", imageInfo.ToString().c_str());
@@ -61,41 +270,27 @@ void ImageProvider::FetchImageObject(
             LOGE("task executor is null. imageInfo: %{private}s", imageInfo.ToString().c_str());
             return;
         }
-        RefPtr<ImageObject> imageObj = QueryImageObjectFromCache(imageInfo, pipelineContext);
-        if (!imageObj) { // if image object is not in cache, generate a new one.
-            imageObj = GeneraterAceImageObject(imageInfo, pipelineContext, useSkiaSvg);
-        }
+        auto imageObj = result->imageObj;
         if (!imageObj) { // if it fails to generate an image object, trigger fail callback.
-            if (syncMode) {
-                failedCallback(imageInfo);
-                return;
-            }
             taskExecutor->PostTask(
                 [failedCallback, imageInfo] { failedCallback(imageInfo); }, TaskExecutor::TaskType::UI);
             return;
         }
-        if (syncMode) {
-            successCallback(imageInfo, imageObj);
-        } else {
-            taskExecutor->PostTask([successCallback, imageInfo, imageObj]() { successCallback(imageInfo, imageObj); },
-                TaskExecutor::TaskType::UI);
-        }
-        bool canStartUploadImageObj = !needAutoResize && (imageObj->GetFrameCount() == 1);
-        if (canStartUploadImageObj) {
-            bool forceResize = (!imageObj->IsSvg()) && (imageInfo.IsSourceDimensionValid());
-            FlutterRenderImage::UploadImageObjToGpuForRender(imageObj, context, renderTaskHolder, uploadSuccessCallback,
-                failedCallback, imageObj->GetImageSize(), forceResize, true);
-        }
-    };
-    if (syncMode) {
-        task();
-        return;
-    }
-    CancelableTask cancelableTask(std::move(task));
+        taskExecutor->PostTask([successCallback, imageInfo, imageObj]() { successCallback(imageInfo, imageObj); },
+            TaskExecutor::TaskType::UI);
+    });
+    uint64_t fetchId = 0;
+    auto priority = JoinPendingFetch(
+        key, FetchWaiter { delivery, result, uploadSuccessCallback, failedCallback, isVisible }, fetchId);
+    // Canceling the delivery only detaches this requester, the fetch is skipped when all requesters have gone, and is
+    // left to a task of low priority when no visible requester is left.
     if (onBackgroundTaskPostCallback) {
-        onBackgroundTaskPostCallback(cancelableTask);
+        onBackgroundTaskPostCallback(delivery);
+    }
+    if (priority) {
+        PostPendingFetch(
+            key, fetchId, priority.value(), imageInfo, context, useSkiaSvg, needAutoResize, renderTaskHolder);
     }
-    BackgroundTaskExecutor::GetInstance().PostTask(cancelableTask);
 }
 
 RefPtr<ImageObject> ImageProvider::QueryImageObjectFromCache(
@@ -342,6 +537,65 @@ sk_sp<SkImage> ImageProvider::ResizeSkImage(
         ImageObject::GenerateCacheKey(ImageSourceInfo(src), imageSize));
 }
 
+sk_sp<SkImage> ImageProvider::DecodeAtTargetSize(
+    const sk_sp<SkData>& data,
+    const std::string& src,
+    Size imageSize)
+{
+    if (!data) {
+        return nullptr;
+    }
+    if (!imageSize.IsValid()) {
+        return SkImage::MakeFromEncoded(data);
+    }
+    auto codec = SkAndroidCodec::MakeFromData(data);
+    // Rotated images are left to the image generator, which applies the origin.
+    if (!codec || codec->codec()->getOrigin() != SkEncodedOrigin::kTopLeft_SkEncodedOrigin) {
+        return SkImage::MakeFromEncoded(data);
+    }
+    int32_t dstWidth = static_cast<int32_t>(imageSize.Width() + 0.5);
+    int32_t dstHeight = static_cast<int32_t>(imageSize.Height() + 0.5);
+    // Take the largest sample size whose output still covers the target size, the rest is done by resizing.
+    int32_t sampleSize = 1;
+    SkISize sampledSize = codec->getInfo().dimensions();
+    for (int32_t nextSize = sampleSize * 2; nextSize <= MAX_SAMPLE_SIZE; nextSize *= 2) {
+        auto nextSampledSize = codec->getSampledDimensions(nextSize);
+        if (nextSampledSize.width() < dstWidth || nextSampledSize.height() < dstHeight) {
+            break;
+        }
+        sampleSize = nextSize;
+        sampledSize = nextSampledSize;
+    }
+    if (sampleSize == 1) {
+        return SkImage::MakeFromEncoded(data);
+    }
+
+    auto colorType = codec->computeOutputColorType(kN32_SkColorType);
+    auto alphaType = codec->computeOutputAlphaType(false);
+    auto sampledInfo = SkImageInfo::Make(sampledSize.width(), sampledSize.height(), colorType, alphaType,
+        codec->computeOutputColorSpace(colorType));
+    SkBitmap bitmap;
+    if (!bitmap.tryAllocPixels(sampledInfo)) {
+        LOGE("Could not allocate bitmap for sampled decoding. src: %{private}s, sample size: %{public}d", src.c_str(),
+            sampleSize);
+        return SkImage::MakeFromEncoded(data);
+    }
+    SkAndroidCodec::AndroidOptions options;
+    options.fSampleSize = sampleSize;
+    auto result = codec->getAndroidPixels(sampledInfo, bitmap.getPixels(), bitmap.rowBytes(), &options);
+    if (result != SkCodec::kSuccess && result != SkCodec::kIncompleteInput) {
+        LOGE("Sampled decoding failed. src: %{private}s, result: %{public}d", src.c_str(),
+            static_cast<int32_t>(result));
+        return SkImage::MakeFromEncoded(data);
+    }
+    LOGD("decode %{private}s with sample size %{public}d, [%{public}d x %{public}d] -> [%{public}d x %{public}d]",
+        src.c_str(), sampleSize, codec->getInfo().width(), codec->getInfo().height(), sampledSize.width(),
+        sampledSize.height());
+    // Marking this as immutable makes the MakeFromBitmap call share the pixels instead of copying.
+    bitmap.setImmutable();
+    return SkImage::MakeFromBitmap(bitmap);
+}
+
 sk_sp<SkImage> ImageProvider::ApplySizeToSkImage(
     const sk_sp<SkImage>& rawImage,
     int32_t dstWidth,
@@ -406,7 +660,7 @@ sk_sp<SkImage> ImageProvider::GetSkImage(
         LOGE("fetch data failed. src: %{private}s", src.c_str());
         return nullptr;
     }
-    auto rawImage = SkImage::MakeFromEncoded(imageSkData);
+    auto rawImage = DecodeAtTargetSize(imageSkData, src, targetSize);
     if (!rawImage) {
         LOGE("MakeFromEncoded failed! src: %{private}s", src.c_str());
         return nullptr;
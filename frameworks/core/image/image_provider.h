@@ -16,7 +16,11 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PROVIDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PROVIDER_H
 
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/lib/ui/painting/image.h"
@@ -24,6 +28,7 @@
 
 #include "base/memory/ace_type.h"
 #include "base/resource/internal_resource.h"
+#include "base/thread/background_task_executor.h"
 #include "core/components/common/layout/constants.h"
 #include "core/image/image_source_info.h"
 #include "core/image/image_loader.h"
@@ -98,7 +103,21 @@ public:
         bool useSkiaSvg,
         bool needAutoResize,
         RefPtr<FlutterRenderTaskHolder>& renderTaskHolder,
-        OnPostBackgroundTask onBackgroundTaskPostCallback = nullptr);
+        OnPostBackgroundTask onBackgroundTaskPostCallback = nullptr,
+        bool isVisible = true);
+
+    // Requests for the same image share one background fetch, each of them gets its own cancelable delivery.
+    static void FetchImageObjectAsync(
+        const ImageSourceInfo& imageInfo,
+        const ImageObjSuccessCallback& successCallback,
+        const UploadSuccessCallback& uploadSuccessCallback,
+        const FailedCallback& failedCallback,
+        const WeakPtr<PipelineContext>& context,
+        bool useSkiaSvg,
+        bool needAutoResize,
+        const RefPtr<FlutterRenderTaskHolder>& renderTaskHolder,
+        const OnPostBackgroundTask& onBackgroundTaskPostCallback,
+        bool isVisible);
 
     static sk_sp<SkImage> ResizeSkImage(
         const sk_sp<SkImage>& rawImage,
@@ -106,6 +125,13 @@ public:
         Size imageSize,
         bool forceResize = false);
 
+    // Decodes with the codec's native downsampling to get close to imageSize, so that a big picture shown small is
+    // never fully decoded. The result is not smaller than imageSize and still needs ResizeSkImage to get exact size.
+    static sk_sp<SkImage> DecodeAtTargetSize(
+        const sk_sp<SkData>& data,
+        const std::string& src,
+        Size imageSize);
+
     static sk_sp<SkImage> ApplySizeToSkImage(
         const sk_sp<SkImage>& rawImage,
         int32_t dstWidth,
@@ -138,6 +164,51 @@ public:
     static SkAlphaType AlphaTypeToSkAlphaType(const RefPtr<PixelMap>& pixmap);
     static SkImageInfo MakeSkImageInfoFromPixelMap(const RefPtr<PixelMap>& pixmap);
     static sk_sp<SkColorSpace> ColorSpaceToSkColorSpace(const RefPtr<PixelMap>& pixmap);
+
+private:
+    struct FetchResult {
+        RefPtr<ImageObject> imageObj;
+    };
+
+    struct FetchWaiter {
+        // Delivers the result to one requester, the requester cancels it to stop waiting.
+        CancelableTask delivery;
+        // Filled in before the delivery runs.
+        std::shared_ptr<FetchResult> result;
+        UploadSuccessCallback uploadSuccessCallback;
+        FailedCallback failedCallback;
+        // Whether the node of the requester is in viewport.
+        bool isVisible = false;
+    };
+
+    // Image objects being fetched in background, requests for the same image wait for the same fetch.
+    struct PendingFetch {
+        uint64_t id = 0;
+        std::vector<FetchWaiter> waiters;
+        bool started = false;
+        // Whether a task of each priority is waiting to run the fetch.
+        bool urgent = false;
+        bool deferred = false;
+    };
+
+    static std::string MakeFetchKey(const ImageSourceInfo& imageInfo, bool useSkiaSvg, bool needAutoResize);
+    // Adds a requester to the fetch of |key|. Returns the priority of the task to post for the fetch, or nullopt if a
+    // task of that priority is waiting already.
+    static std::optional<BgTaskPriority> JoinPendingFetch(
+        const std::string& key, FetchWaiter&& waiter, uint64_t& fetchId);
+    // Returns false if the fetch has been run or dropped, or should be left to a task of low priority.
+    static bool StartPendingFetch(const std::string& key, uint64_t fetchId, BgTaskPriority priority, bool& needDefer);
+    static std::vector<FetchWaiter> FinishPendingFetch(const std::string& key);
+    static void PostPendingFetch(const std::string& key, uint64_t fetchId, BgTaskPriority priority,
+        const ImageSourceInfo& imageInfo, const WeakPtr<PipelineContext>& context, bool useSkiaSvg,
+        bool needAutoResize, const RefPtr<FlutterRenderTaskHolder>& renderTaskHolder);
+    static void RunPendingFetch(const std::string& key, uint64_t fetchId, BgTaskPriority priority,
+        const ImageSourceInfo& imageInfo, const WeakPtr<PipelineContext>& context, bool useSkiaSvg,
+        bool needAutoResize, const RefPtr<FlutterRenderTaskHolder>& renderTaskHolder);
+
+    static std::mutex pendingFetchMutex_;
+    static std::unordered_map<std::string, PendingFetch> pendingFetches_;
+    static uint64_t nextFetchId_;
 };
 
 } // namespace OHOS::Ace
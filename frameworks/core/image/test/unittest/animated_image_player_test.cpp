@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "include/codec/SkCodec.h"
+#include "include/core/SkData.h"
+
+#define private public
+#include "core/image/animated_image_player.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+// A gif of 2 x 1 pixels. The first frame covers the image, the second one only covers the right pixel, so it is
+// decoded on the first one.
+const uint8_t TWO_FRAME_GIF[] = { 0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x02, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x21, 0xff, 0x0b, 0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45, 0x32, 0x2e,
+    0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xf9, 0x04, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x02, 0x02, 0x04, 0x0a, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x2c,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x02, 0x02, 0x4c, 0x01, 0x00, 0x3b };
+constexpr int32_t FRAME_COUNT = 2;
+constexpr auto WAIT_TIMEOUT = std::chrono::seconds(1);
+constexpr auto WAIT_INTERVAL = std::chrono::milliseconds(10);
+
+RefPtr<AnimatedImagePlayer> CreatePlayer()
+{
+    auto codec = SkCodec::MakeFromData(SkData::MakeWithoutCopy(TWO_FRAME_GIF, sizeof(TWO_FRAME_GIF)));
+    if (!codec) {
+        return nullptr;
+    }
+    // Without a context, the player is not played by an animator, frames are decoded by the test.
+    auto player = AceType::MakeRefPtr<AnimatedImagePlayer>(ImageSourceInfo(""),
+        [](ImageSourceInfo, const fml::RefPtr<flutter::CanvasImage>&) {}, WeakPtr<PipelineContext>(),
+        fml::WeakPtr<flutter::IOManager>(), fml::RefPtr<flutter::SkiaUnrefQueue>(), std::move(codec));
+    // Frames others are decoded on are only collected for the animator.
+    for (const auto& frameInfo : player->frameInfos_) {
+        if (frameInfo.fRequiredFrame >= 0 && frameInfo.fRequiredFrame < FRAME_COUNT) {
+            player->requiredFrames_.emplace(frameInfo.fRequiredFrame);
+        }
+    }
+    return player;
+}
+
+void DecodeAllFrames(const RefPtr<AnimatedImagePlayer>& player)
+{
+    std::lock_guard<std::mutex> lock(player->decodeMutex_);
+    for (int32_t index = 0; index < FRAME_COUNT; ++index) {
+        SkBitmap bitmap;
+        EXPECT_TRUE(player->DecodeFrameBitmap(index, bitmap));
+    }
+}
+
+size_t WaitForCachedFrames(const RefPtr<AnimatedImagePlayer>& player, size_t count)
+{
+    auto deadline = std::chrono::steady_clock::now() + WAIT_TIMEOUT;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(player->decodeMutex_);
+            if (player->frameCache_.size() == count || std::chrono::steady_clock::now() > deadline) {
+                return player->frameCache_.size();
+            }
+        }
+        std::this_thread::sleep_for(WAIT_INTERVAL);
+    }
+}
+
+} // namespace
+
+class AnimatedImagePlayerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: Pause001
+ * @tc.desc: Test pausing does not wait for decoding, and frames are released in background.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatedImagePlayerTest, Pause001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Decode all frames of the gif.
+     * @tc.expected: step1. All frames are cached, the first one is required by the second one.
+     */
+    auto player = CreatePlayer();
+    ASSERT_TRUE(player);
+    DecodeAllFrames(player);
+    EXPECT_EQ(player->frameCache_.size(), static_cast<size_t>(FRAME_COUNT));
+    EXPECT_EQ(player->requiredFrames_.count(0), 1UL);
+
+    /**
+     * @tc.steps: step2. Pause the player in another thread while the frames are locked for decoding.
+     * @tc.expected: step2. Pausing returns at once, frames are kept until decoding is done.
+     */
+    std::unique_lock<std::mutex> decodeLock(player->decodeMutex_);
+    auto paused = std::async(std::launch::async, [player] { player->Pause(); });
+    EXPECT_EQ(paused.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_TRUE(player->paused_);
+    EXPECT_EQ(player->frameCache_.size(), static_cast<size_t>(FRAME_COUNT));
+    decodeLock.unlock();
+
+    /**
+     * @tc.steps: step3. Wait for frames to be released.
+     * @tc.expected: step3. Only the frame others are decoded on is kept.
+     */
+    EXPECT_EQ(WaitForCachedFrames(player, 1), 1UL);
+    EXPECT_EQ(player->frameCache_.count(0), 1UL);
+}
+
+/**
+ * @tc.name: Pause002
+ * @tc.desc: Test frames are not decoded ahead or kept while paused, and are kept again after resuming.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatedImagePlayerTest, Pause002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Pause the player, then decode frames and look ahead.
+     * @tc.expected: step1. Only the frame others are decoded on is kept.
+     */
+    auto player = CreatePlayer();
+    ASSERT_TRUE(player);
+    player->Pause();
+    EXPECT_EQ(WaitForCachedFrames(player, 0), 0UL);
+    DecodeAllFrames(player);
+    player->LookAhead(0);
+    EXPECT_EQ(WaitForCachedFrames(player, 1), 1UL);
+    EXPECT_EQ(player->frameCache_.count(0), 1UL);
+
+    /**
+     * @tc.steps: step2. Resume the player and look ahead.
+     * @tc.expected: step2. The next frame is cached.
+     */
+    player->Resume();
+    EXPECT_FALSE(player->paused_);
+    player->LookAhead(0);
+    EXPECT_EQ(WaitForCachedFrames(player, FRAME_COUNT), static_cast<size_t>(FRAME_COUNT));
+}
+
+} // namespace OHOS::Ace
@@ -14,6 +14,7 @@
  */
 
 #include "gtest/gtest.h"
+#include "third_party/skia/include/codec/SkAndroidCodec.h"
 
 #include "adapter/aosp/entrance/java/jni/jni_environment.h"
 #include "core/image/test/unittest/image_provider_test_utils.h"
@@ -38,12 +39,46 @@ Platform::JniEnvironment& Platform::JniEnvironment::GetInstance()
     return jniEnvironment;
 }
 
+namespace {
+
+const std::string FETCH_KEY = "ImageProviderTest:fetch";
+
+// Makes a requester of a fetch which counts its deliveries, |delivery| is kept to cancel it.
+ImageProvider::FetchWaiter MakeFetchWaiter(bool isVisible, int32_t& deliveredCount, CancelableTask& delivery)
+{
+    ImageProvider::FetchWaiter waiter;
+    waiter.delivery.Reset([&deliveredCount]() { ++deliveredCount; }, false);
+    waiter.result = std::make_shared<ImageProvider::FetchResult>();
+    waiter.isVisible = isVisible;
+    delivery = waiter.delivery;
+    return waiter;
+}
+
+void RunFetch(const RefPtr<PipelineContext>& context, uint64_t fetchId, BgTaskPriority priority)
+{
+    // Image objects are not uploaded when auto resized.
+    ImageProvider::RunPendingFetch(
+        FETCH_KEY, fetchId, priority, ImageSourceInfo(FILE_PNG), context, false, true, nullptr);
+}
+
+bool IsFetchPending()
+{
+    std::lock_guard<std::mutex> lock(ImageProvider::pendingFetchMutex_);
+    return ImageProvider::pendingFetches_.count(FETCH_KEY) > 0;
+}
+
+} // namespace
+
 class ImageProviderTest : public testing::Test {
 public:
     static void SetUpTestCase() {}
     static void TearDownTestCase() {}
     void SetUp() override {}
-    void TearDown() override {}
+    void TearDown() override
+    {
+        std::lock_guard<std::mutex> lock(ImageProvider::pendingFetchMutex_);
+        ImageProvider::pendingFetches_.erase(FETCH_KEY);
+    }
 };
 
 /**
@@ -226,4 +261,188 @@ HWTEST_F(ImageProviderTest, WrongImageData001, TestSize.Level1)
     }
 }
 
-} // namespace OHOS::Ace
\ No newline at end of file
+/**
+ * @tc.name: DecodeAtTargetSize001
+ * @tc.desc: Verify pictures shown as thumbnails are decoded with downsampling.
+ * @tc.type: PERF
+ */
+HWTEST_F(ImageProviderTest, DecodeAtTargetSize001, TestSize.Level1)
+{
+    constexpr int32_t thumbnailScale = 4;
+    std::vector<std::string> fileImages = { FILE_JPG, FILE_PNG, FILE_WEBP };
+    for (const auto& file : fileImages) {
+        /**
+         * @tc.steps: step1. decode the full picture.
+         */
+        auto imageLoader = FileImageLoader();
+        auto data = imageLoader.LoadImageData(ImageSourceInfo(file));
+        ASSERT_TRUE(data);
+        auto fullImage = SkImage::MakeFromEncoded(data);
+        ASSERT_TRUE(fullImage);
+
+        /**
+         * @tc.steps: step2. decode the picture for a thumbnail of a quarter of its size.
+         * @tc.expected: step2. the image is decoded with the sample size of the thumbnail, it covers the thumbnail
+         *                      and takes less memory than the full picture.
+         */
+        Size thumbnailSize(fullImage->width() / thumbnailScale, fullImage->height() / thumbnailScale);
+        auto image = ImageProvider::DecodeAtTargetSize(data, file, thumbnailSize);
+        ASSERT_TRUE(image);
+        auto codec = SkAndroidCodec::MakeFromData(data);
+        ASSERT_TRUE(codec);
+        auto sampledSize = codec->getSampledDimensions(thumbnailScale);
+        EXPECT_EQ(image->width(), sampledSize.width());
+        EXPECT_EQ(image->height(), sampledSize.height());
+        EXPECT_GE(image->width(), static_cast<int32_t>(thumbnailSize.Width()));
+        EXPECT_GE(image->height(), static_cast<int32_t>(thumbnailSize.Height()));
+        auto fullBytes = fullImage->imageInfo().computeMinByteSize();
+        auto bytes = image->imageInfo().computeMinByteSize();
+        EXPECT_LT(bytes, fullBytes);
+        GTEST_LOG_(INFO) << file << " decoded bytes: " << bytes << ", full: " << fullBytes;
+    }
+}
+
+/**
+ * @tc.name: FetchImageObject001
+ * @tc.desc: Verify requests for the same image share one fetch, and svg of other fill colors are fetched apart.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTest, FetchImageObject001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. make keys of an svg in different fill colors.
+     * @tc.expected: step1. the keys are different.
+     */
+    ImageSourceInfo redSvg("/data/icon.svg");
+    redSvg.SetFillColor(Color::RED);
+    ImageSourceInfo blueSvg("/data/icon.svg");
+    blueSvg.SetFillColor(Color::BLUE);
+    EXPECT_NE(ImageProvider::MakeFetchKey(redSvg, false, false), ImageProvider::MakeFetchKey(blueSvg, false, false));
+    EXPECT_NE(ImageProvider::MakeFetchKey(redSvg, false, false),
+        ImageProvider::MakeFetchKey(ImageSourceInfo("/data/icon.svg"), false, false));
+
+    /**
+     * @tc.steps: step2. request an image twice before it is fetched.
+     * @tc.expected: step2. only the first request posts a task, both wait for the same fetch.
+     */
+    int32_t firstCount = 0;
+    int32_t secondCount = 0;
+    CancelableTask first;
+    CancelableTask second;
+    uint64_t firstId = 0;
+    uint64_t secondId = 0;
+    EXPECT_EQ(ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, firstCount, first), firstId),
+        BgTaskPriority::DEFAULT);
+    EXPECT_FALSE(ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, secondCount, second), secondId));
+    EXPECT_EQ(firstId, secondId);
+
+    /**
+     * @tc.steps: step3. run the fetch.
+     * @tc.expected: step3. the result is delivered to both requests once, and the fetch is done.
+     */
+    RunFetch(GetMockContext(), firstId, BgTaskPriority::DEFAULT);
+    EXPECT_EQ(firstCount, 1);
+    EXPECT_EQ(secondCount, 1);
+    EXPECT_FALSE(IsFetchPending());
+    RunFetch(GetMockContext(), firstId, BgTaskPriority::DEFAULT);
+    EXPECT_EQ(firstCount, 1);
+
+    /**
+     * @tc.steps: step4. request the image again.
+     * @tc.expected: step4. a new fetch is started.
+     */
+    int32_t thirdCount = 0;
+    CancelableTask third;
+    uint64_t thirdId = 0;
+    EXPECT_EQ(ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, thirdCount, third), thirdId),
+        BgTaskPriority::DEFAULT);
+    EXPECT_NE(thirdId, firstId);
+}
+
+/**
+ * @tc.name: FetchImageObject002
+ * @tc.desc: Verify canceled requests are not delivered, and the fetch is skipped when all requests have canceled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTest, FetchImageObject002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. request an image twice, cancel the first request and run the fetch.
+     * @tc.expected: step1. only the second request gets the result.
+     */
+    int32_t firstCount = 0;
+    int32_t secondCount = 0;
+    CancelableTask first;
+    CancelableTask second;
+    uint64_t fetchId = 0;
+    ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, firstCount, first), fetchId);
+    ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, secondCount, second), fetchId);
+    first.Cancel();
+    RunFetch(GetMockContext(), fetchId, BgTaskPriority::DEFAULT);
+    EXPECT_EQ(firstCount, 0);
+    EXPECT_EQ(secondCount, 1);
+
+    /**
+     * @tc.steps: step2. request the image again, cancel the request and run the fetch.
+     * @tc.expected: step2. the fetch is dropped without delivering.
+     */
+    int32_t thirdCount = 0;
+    CancelableTask third;
+    ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, thirdCount, third), fetchId);
+    EXPECT_TRUE(IsFetchPending());
+    third.Cancel();
+    RunFetch(GetMockContext(), fetchId, BgTaskPriority::DEFAULT);
+    EXPECT_EQ(thirdCount, 0);
+    EXPECT_FALSE(IsFetchPending());
+}
+
+/**
+ * @tc.name: FetchImageObject003
+ * @tc.desc: Verify images of visible nodes are fetched with default priority, and are left to low priority after
+ *           the visible nodes scroll out.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTest, FetchImageObject003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. request an image for two offscreen nodes.
+     * @tc.expected: step1. a task of low priority is posted for the first one.
+     */
+    int32_t offscreenCount = 0;
+    CancelableTask offscreen;
+    CancelableTask otherOffscreen;
+    uint64_t fetchId = 0;
+    EXPECT_EQ(ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(false, offscreenCount, offscreen), fetchId),
+        BgTaskPriority::LOW);
+    EXPECT_FALSE(
+        ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(false, offscreenCount, otherOffscreen), fetchId));
+
+    /**
+     * @tc.steps: step2. request the image for a visible node.
+     * @tc.expected: step2. a task of default priority is posted.
+     */
+    int32_t visibleCount = 0;
+    CancelableTask visible;
+    EXPECT_EQ(ImageProvider::JoinPendingFetch(FETCH_KEY, MakeFetchWaiter(true, visibleCount, visible), fetchId),
+        BgTaskPriority::DEFAULT);
+
+    /**
+     * @tc.steps: step3. the visible node scrolls out and cancels, then the task of default priority runs.
+     * @tc.expected: step3. the fetch is not run, it is left to the task of low priority.
+     */
+    visible.Cancel();
+    RunFetch(GetMockContext(), fetchId, BgTaskPriority::DEFAULT);
+    EXPECT_EQ(offscreenCount, 0);
+    EXPECT_TRUE(IsFetchPending());
+
+    /**
+     * @tc.steps: step4. the task of low priority runs.
+     * @tc.expected: step4. the result is delivered to the offscreen nodes.
+     */
+    RunFetch(GetMockContext(), fetchId, BgTaskPriority::LOW);
+    EXPECT_EQ(offscreenCount, 2);
+    EXPECT_EQ(visibleCount, 0);
+    EXPECT_FALSE(IsFetchPending());
+}
+
+} // namespace OHOS::Ace
@@ -53,6 +53,18 @@ public:
         return renderNode_->ProvideRestoreInfo();
     }
 
+    // Binds the render node to the accessibility node created after mounted, returns true if a new node is bound.
+    bool BindAccessibilityNode()
+    {
+        if (composeId_.empty() || !renderNode_) {
+            return false;
+        }
+        auto boundNode = renderNode_->GetAccessibilityNode().Upgrade();
+        SetAccessibilityNodeById(composeId_);
+        auto accessibilityNode = renderNode_->GetAccessibilityNode().Upgrade();
+        return accessibilityNode && accessibilityNode != boundNode;
+    }
+
 protected:
     void UpdateAccessibilityNode();
     virtual RefPtr<RenderNode> CreateRenderNode();
@@ -16,6 +16,7 @@
 #include "core/pipeline/base/render_node.h"
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <sstream>
 #include <unistd.h>
@@ -48,6 +49,10 @@ namespace {
 
 constexpr float PRESS_KEYFRAME_START = 0.0f;
 constexpr float PRESS_KEYFRAME_END = 1.0f;
+// Flex lays out a child with at most a loose, a tight and a stretched layout param.
+constexpr size_t MAX_LAYOUT_CACHE_SIZE = 4;
+
+std::atomic<uint64_t> g_layoutCacheHitCount { 0 };
 
 struct ZIndexCompartor {
     bool operator()(const RefPtr<RenderNode>& left, const RefPtr<RenderNode>& right) const
@@ -442,6 +447,7 @@ void RenderNode::PaintChild(const RefPtr<RenderNode>& child, RenderContext& cont
 
 void RenderNode::MarkNeedLayout(bool selfOnly, bool forceParent)
 {
+    ClearLayoutCache();
     bool addSelf = false;
     auto context = context_.Upgrade();
     if (context != nullptr) {
@@ -498,14 +504,31 @@ void RenderNode::OnLayout()
         Size parentViewPort = parent->GetChildViewPort();
         if (viewPort_ != parentViewPort) {
             viewPort_ = parentViewPort;
+            ClearLayoutCache();
+            needLayout_ = true;
+        }
+    }
+    if (hasCachedLayout_) {
+        // The size is restored from the cache, but the subtree is still laid out with another layout param.
+        hasCachedLayout_ = false;
+        if (layoutParam_ != performedLayoutParam_) {
+            layoutParamChanged_ = true;
             needLayout_ = true;
         }
     }
     if (NeedLayout()) {
         PrepareLayout();
         PerformLayout();
+        if (cacheChildrenLayout_) {
+            // Whichever way PerformLayout returns, no child is left laid out with another layout param.
+            for (const auto& child : children_) {
+                child->FlushCachedLayout();
+            }
+        }
         layoutParamChanged_ = false;
         SetNeedLayout(false);
+        performedLayoutParam_ = layoutParam_;
+        SaveLayoutToCache();
         pendingDispatchLayoutReady_ = true;
         MarkNeedRender();
     }
@@ -513,6 +536,110 @@ void RenderNode::OnLayout()
 
 void RenderNode::PrepareLayout() {}
 
+bool RenderNode::CanCacheLayout() const
+{
+    // The parent flushes the cached layout of children after it lays them out.
+    auto parent = parent_.Upgrade();
+    return parent && parent->cacheChildrenLayout_ && parent->NeedLayout();
+}
+
+RenderNode::LayoutCacheEntry* RenderNode::FindLayoutCacheEntry(const LayoutParam& layoutParam)
+{
+    auto iter = std::find_if(layoutCache_.begin(), layoutCache_.end(),
+        [&layoutParam](const LayoutCacheEntry& entry) { return entry.layoutParam == layoutParam; });
+    return iter == layoutCache_.end() ? nullptr : &(*iter);
+}
+
+bool RenderNode::RestoreLayoutFromCache(const LayoutParam& layoutParam)
+{
+    if (layoutCache_.empty() || !CanCacheLayout()) {
+        return false;
+    }
+    auto parent = parent_.Upgrade();
+    if (parent->GetChildViewPort() != viewPort_) {
+        return false;
+    }
+    auto entry = FindLayoutCacheEntry(layoutParam);
+    if (!entry) {
+        return false;
+    }
+    // The subtree is left as it is, until the parent flushes the cached layout.
+    layoutParam_ = layoutParam;
+    hasCachedLayout_ = true;
+    SetLayoutSize(entry->layoutSize);
+    g_layoutCacheHitCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void RenderNode::SaveLayoutToCache()
+{
+    if (!CanCacheLayout()) {
+        ClearLayoutCache();
+        return;
+    }
+    auto entry = FindLayoutCacheEntry(layoutParam_);
+    if (!entry) {
+        if (layoutCache_.size() >= MAX_LAYOUT_CACHE_SIZE) {
+            layoutCache_.erase(layoutCache_.begin());
+        }
+        entry = &layoutCache_.emplace_back();
+        entry->layoutParam = layoutParam_;
+    }
+    entry->layoutSize = GetLayoutSize();
+    entry->alphabeticBaseline.reset();
+    entry->ideographicBaseline.reset();
+    entry->contentSize.reset();
+}
+
+void RenderNode::FlushCachedLayout()
+{
+    if (hasCachedLayout_) {
+        OnLayout();
+    }
+}
+
+double RenderNode::GetCachedBaselineDistance(TextBaseline textBaseline)
+{
+    bool isCached = textBaseline == TextBaseline::ALPHABETIC || textBaseline == TextBaseline::IDEOGRAPHIC;
+    auto entry = isCached ? FindLayoutCacheEntry(layoutParam_) : nullptr;
+    if (entry) {
+        auto& baseline =
+            textBaseline == TextBaseline::ALPHABETIC ? entry->alphabeticBaseline : entry->ideographicBaseline;
+        if (baseline) {
+            return baseline.value();
+        }
+    }
+    FlushCachedLayout();
+    double distance = GetBaselineDistance(textBaseline);
+    entry = isCached ? FindLayoutCacheEntry(layoutParam_) : nullptr;
+    if (entry) {
+        auto& baseline =
+            textBaseline == TextBaseline::ALPHABETIC ? entry->alphabeticBaseline : entry->ideographicBaseline;
+        baseline = distance;
+    }
+    return distance;
+}
+
+Size RenderNode::GetCachedContentSize()
+{
+    auto entry = FindLayoutCacheEntry(layoutParam_);
+    if (entry && entry->contentSize) {
+        return entry->contentSize.value();
+    }
+    FlushCachedLayout();
+    Size contentSize = GetContentSize();
+    entry = FindLayoutCacheEntry(layoutParam_);
+    if (entry) {
+        entry->contentSize = contentSize;
+    }
+    return contentSize;
+}
+
+uint64_t RenderNode::GetLayoutCacheHitCount()
+{
+    return g_layoutCacheHitCount.load(std::memory_order_relaxed);
+}
+
 void RenderNode::SetPosition(const Offset& offset)
 {
     Offset selfOffset;
@@ -1399,6 +1526,9 @@ void RenderNode::ClearRenderObject()
     isTailRenderNode_ = false;
     accessibilityText_ = "";
     layoutParam_ = LayoutParam();
+    performedLayoutParam_ = LayoutParam();
+    hasCachedLayout_ = false;
+    layoutCache_.clear();
     paintRect_ = Rect();
     paintX_ = Dimension();
     paintY_ = Dimension();
@@ -17,6 +17,8 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_BASE_RENDER_NODE_H
 
 #include <list>
+#include <optional>
+#include <vector>
 
 #include "base/geometry/dimension.h"
 #include "base/geometry/rect.h"
@@ -141,6 +143,9 @@ public:
 
     void SetNeedLayout(bool needLayout)
     {
+        if (needLayout) {
+            ClearLayoutCache();
+        }
         needLayout_ = needLayout;
     }
 
@@ -178,10 +183,27 @@ public:
 
         bool dipScaleChange = !NearEqual(pipeline->GetDipScale(), dipScale_);
         dipScale_ = pipeline->GetDipScale();
+        if (dipScaleChange || needLayout_) {
+            ClearLayoutCache();
+        }
+        if (hasCachedLayout_ && !dipScaleChange && !needLayout_ && layoutParam_ == layoutParam) {
+            // Laid out again with the layout param restored from the cache, it is still left to be flushed.
+            if (onChangeCallback_) {
+                onChangeCallback_();
+            }
+            return;
+        }
         if (dipScaleChange || layoutParam_ != layoutParam) {
+            if (!dipScaleChange && RestoreLayoutFromCache(layoutParam)) {
+                if (onChangeCallback_) {
+                    onChangeCallback_();
+                }
+                return;
+            }
             layoutParam_ = layoutParam;
             layoutParamChanged_ = true;
-            SetNeedLayout(true);
+            // Keep the layouts cached with other layout params, which are still valid.
+            needLayout_ = true;
         }
 
         if (onChangeCallback_) {
@@ -205,6 +227,20 @@ public:
         return layoutParam_;
     }
 
+    // Performs the layout skipped by the layout cache, if the subtree is still laid out with other layout params.
+    // A node restored from the cache only has its layout param and size updated. Its parent may flush it earlier to
+    // read the subtree, otherwise it is flushed when the parent finishes PerformLayout, or when the node itself is
+    // laid out by the pipeline, so the subtree is never painted with another layout param.
+    void FlushCachedLayout();
+
+    // Same as GetBaselineDistance and GetContentSize, but answered by the layout cache if the subtree is still laid
+    // out with other layout params.
+    double GetCachedBaselineDistance(TextBaseline textBaseline);
+    Size GetCachedContentSize();
+
+    // Count of layouts skipped by the layout cache in all instances.
+    static uint64_t GetLayoutCacheHitCount();
+
     // Each subclass should override this function for actual layout operation.
     virtual void PerformLayout() = 0;
 
@@ -1254,7 +1290,22 @@ protected:
     // Compute multiSelect zone
     Rect ComputeSelectedZone(const Offset& startOffset, const Offset& endOffset);
 
+    // Parents which lay out children repeatedly with alternating layout params, like flex measures children with loose
+    // constraints and then with tight ones, cache the layout of children for each layout param.
+    void SetCacheChildrenLayout(bool cacheChildrenLayout)
+    {
+        cacheChildrenLayout_ = cacheChildrenLayout;
+    }
+
 private:
+    struct LayoutCacheEntry {
+        LayoutParam layoutParam;
+        Size layoutSize;
+        std::optional<double> alphabeticBaseline;
+        std::optional<double> ideographicBaseline;
+        std::optional<Size> contentSize;
+    };
+
     void AddDirtyRenderBoundaryNode()
     {
         if (visible_ && !hidden_ && IsRepaintBoundary()) {
@@ -1272,6 +1323,15 @@ private:
     void RSNodeAddChild(const RefPtr<RenderNode>& child);
     void MarkParentNeedRender() const;
 
+    bool CanCacheLayout() const;
+    LayoutCacheEntry* FindLayoutCacheEntry(const LayoutParam& layoutParam);
+    bool RestoreLayoutFromCache(const LayoutParam& layoutParam);
+    void SaveLayoutToCache();
+    void ClearLayoutCache()
+    {
+        layoutCache_.clear();
+    }
+
     std::list<RefPtr<RenderNode>> hoverChildren_;
     std::list<RefPtr<RenderNode>> children_;
     std::string accessibilityText_;
@@ -1289,6 +1349,14 @@ private:
     bool needUpdateTouchRect_ = false;
     bool hasShadow_ = false;
 
+    // Layouts of the latest layout params, valid until the node is marked need layout.
+    std::vector<LayoutCacheEntry> layoutCache_;
+    // Layout param of the last PerformLayout, which the subtree is laid out with.
+    LayoutParam performedLayoutParam_;
+    // Set when the size is restored from the cache, until the node is laid out again.
+    bool hasCachedLayout_ = false;
+    bool cacheChildrenLayout_ = false;
+
     double flexWeight_ = 0.0;
     int32_t displayIndex_ = 1;
 
@@ -79,6 +79,7 @@
 #include "core/components/stage/stage_component.h"
 #include "core/components/stage/stage_element.h"
 #include "core/components/theme/app_theme.h"
+#include "core/components_v2/inspector/inspector.h"
 #include "core/components_v2/inspector/inspector_composed_element.h"
 #include "core/components_v2/inspector/shape_composed_element.h"
 #include "core/components_v2/list/render_list.h"
@@ -927,8 +928,12 @@ void PipelineContext::Dump(const std::vector<std::string>& params) const
     } else if (params[0] == "-memory") {
         MemoryMonitor::GetInstance().Dump();
 #endif
+    } else if (params[0] == "-tracker") {
+        AceTracker::Dump(params);
     } else if (params[0] == "-accessibility" || params[0] == "-inspector") {
         DumpAccessibility(params);
+    } else if (params[0] == "-inspectortree") {
+        DumpInspectorTree(params);
     } else if (params[0] == "-rotation" && params.size() >= 2) {
         DumpLog::GetInstance().Print("Dump rotation");
         RotationEvent event { static_cast<double>(StringUtils::StringToInt(params[1])) };
@@ -1848,6 +1853,9 @@ void PipelineContext::OnIdle(int64_t deadline)
     if (front && GetIsDeclarative()) {
         if (deadline != 0) {
             FlushPredictLayout(deadline);
+            if (idleCallback_) {
+                idleCallback_(deadline);
+            }
         }
         return;
     }
@@ -2440,6 +2448,7 @@ void PipelineContext::Destroy()
     sharedImageManager_.Reset();
     window_->Destroy();
     touchPluginPipelineContext_.clear();
+    V2::Inspector::RemoveInspectorTreeSnapshot(instanceId_);
     LOGI("PipelineContext::Destroy end.");
 }
 
@@ -2598,6 +2607,14 @@ void PipelineContext::SetAnimationCallback(AnimationCallback&& callback)
     animationCallback_ = std::move(callback);
 }
 
+void PipelineContext::SetIdleCallback(IdleCallback&& callback)
+{
+    if (!callback) {
+        return;
+    }
+    idleCallback_ = std::move(callback);
+}
+
 #ifndef WEARABLE_PRODUCT
 void PipelineContext::SetMultimodalSubscriber(const RefPtr<MultimodalSubscriber>& multimodalSubscriber)
 {
@@ -2953,6 +2970,31 @@ void PipelineContext::DumpAccessibility(const std::vector<std::string>& params)
     }
 }
 
+void PipelineContext::DumpInspectorTree(const std::vector<std::string>& params) const
+{
+    const auto& dumpFile = DumpLog::GetInstance().GetDumpFile();
+    if (!dumpFile) {
+        LOGE("dump file is null");
+        return;
+    }
+    // -inspectortree [-key <key>] [-depth <depth>] [-diff]
+    V2::InspectorTreeOptions options;
+    for (size_t i = 1; i < params.size(); ++i) {
+        if (params[i] == "-key" && i + 1 < params.size()) {
+            options.key = params[++i];
+        } else if (params[i] == "-depth" && i + 1 < params.size()) {
+            options.depth = StringUtils::StringToInt(params[++i]);
+        } else if (params[i] == "-diff") {
+            options.changedOnly = true;
+        }
+    }
+    if (!V2::Inspector::ExportInspectorTree(AceType::Claim(const_cast<PipelineContext*>(this)), options, *dumpFile)) {
+        DumpLog::GetInstance().Print("Error: failed to export inspector tree");
+        return;
+    }
+    *dumpFile << std::endl;
+}
+
 void PipelineContext::UpdateWindowBlurRegion(
     int32_t id, RRect rRect, float progress, WindowBlurStyle style, const std::vector<RRect>& coords)
 {
@@ -107,6 +107,7 @@ public:
     using TimeProvider = std::function<int64_t(void)>;
     using OnPageShowCallBack = std::function<void()>;
     using AnimationCallback = std::function<void()>;
+    using IdleCallback = std::function<void(int64_t)>;
     using GetViewScaleCallback = std::function<bool(float&, float&)>;
     using SurfaceChangedCallbackMap =
         std::unordered_map<int32_t, std::function<void(int32_t, int32_t, int32_t, int32_t)>>;
@@ -511,6 +512,9 @@ public:
 
     void SetAnimationCallback(AnimationCallback&& callback);
 
+    // Called when the ui thread is idle before the deadline of next vsync.
+    void SetIdleCallback(IdleCallback&& callback);
+
     bool IsLastPage();
 
     void SetRootSize(double density, int32_t width, int32_t height);
@@ -1256,6 +1260,7 @@ private:
     void FlushBuildAndLayoutBeforeSurfaceReady();
     void FlushAnimationTasks();
     void DumpAccessibility(const std::vector<std::string>& params) const;
+    void DumpInspectorTree(const std::vector<std::string>& params) const;
     void FlushWindowBlur();
     void MakeThreadStuck(const std::vector<std::string>& params) const;
     void DumpFrontend() const;
@@ -1373,6 +1378,7 @@ private:
     RefPtr<Component> contextMenu_;
     // animation frame callback
     AnimationCallback animationCallback_;
+    IdleCallback idleCallback_;
 
     // window blur region
     std::unordered_map<int32_t, WindowBlurInfo> windowBlurRegions_;